@@ -405,6 +405,9 @@ private:
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
+  unsigned long Unst_AdjointCheckpoints;  /*!< \brief Number of in-memory primal checkpoints for the unsteady adjoint (0 reads restart files). */
+  long Unst_AdjointCheckpointStart;       /*!< \brief First time step recomputed from checkpoints, earlier ones are read from files. */
+  unsigned long Unst_AdjointPrimalIter;   /*!< \brief Inner iterations of the primal when recomputing time steps for the unsteady adjoint. */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
   unsigned short nLevels_TimeAccurateLTS;   /*!< \brief Number of time levels for time accurate local time stepping. */
@@ -423,6 +426,8 @@ private:
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
+  bool MG_InterfaceAgglomeration; /*!< \brief Agglomerate the multigrid levels independently of the partitioning. */
+  bool MG_Turb;                /*!< \brief Solve the turbulence equations with the (FAS) multigrid cycle. */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
   su2double
   CFLRedCoeff_Turb,            /*!< \brief CFL reduction coefficient on the LevelSet problem. */
@@ -468,6 +473,7 @@ private:
   ENUM_MULTIZONE Kind_MZSolver;    /*!< \brief Kind of multizone solver.  */
   INC_DENSITYMODEL Kind_DensityModel; /*!< \brief Kind of the density model for incompressible flows. */
   CHT_COUPLING Kind_CHT_Coupling;  /*!< \brief Kind of coupling method used at CHT interfaces. */
+  bool CHT_SolidNoPseudoTime;      /*!< \brief Solve the solid conduction of CHT problems without pseudo time stepping. */
   VISCOSITYMODEL Kind_ViscosityModel; /*!< \brief Kind of the Viscosity Model*/
   CONDUCTIVITYMODEL Kind_ConductivityModel; /*!< \brief Kind of the Thermal Conductivity Model */
   CONDUCTIVITYMODEL_TURB Kind_ConductivityModel_Turb; /*!< \brief Kind of the Turbulent Thermal Conductivity Model */
@@ -533,6 +539,8 @@ private:
   BGS_RELAXATION Kind_BGS_RelaxMethod; /*!< \brief Kind of relaxation method for Block Gauss Seidel method in FSI problems. */
   bool ReconstructionGradientRequired; /*!< \brief Enable or disable a second gradient calculation for upwind reconstruction only. */
   bool LeastSquaresRequired;    /*!< \brief Enable or disable memory allocation for least-squares gradient methods. */
+  bool EdgeBasedGradients;      /*!< \brief Compute gradients with a (colored) loop over edges instead of a loop over points. */
+  bool PrecomputeLSWeights;     /*!< \brief Store the geometric least-squares weights instead of recomputing them for every gradient. */
   bool Energy_Equation;         /*!< \brief Solve the energy equation for incompressible flows. */
 
   bool MUSCL,              /*!< \brief MUSCL scheme .*/
@@ -541,6 +549,7 @@ private:
   MUSCL_Heat,              /*!< \brief MUSCL scheme for the (fvm) heat equation.*/
   MUSCL_AdjFlow,           /*!< \brief MUSCL scheme for the adj flow equations.*/
   MUSCL_AdjTurb,           /*!< \brief MUSCL scheme for the adj turbulence equations.*/
+  FusedLimiter_Flow,       /*!< \brief Compute the reconstruction gradient and limiter of the flow equations in one sweep.*/
   Use_Accurate_Jacobians;  /*!< \brief Use numerically computed Jacobians for AUSM+up(2) and SLAU(2). */
   bool EulerPersson;       /*!< \brief Boolean to determine whether this is an Euler simulation with Persson shock capturing. */
   bool FSI_Problem = false,/*!< \brief Boolean to determine whether the simulation is FSI or not. */
@@ -549,6 +558,8 @@ private:
 
   bool AD_Mode;             /*!< \brief Algorithmic Differentiation support. */
   bool AD_Preaccumulation;  /*!< \brief Enable or disable preaccumulation in the AD mode. */
+  bool AD_ExternalGradients;  /*!< \brief Record the gradient computations as external functions in the AD mode. */
+  bool DiscAdj_JacobianGuess; /*!< \brief Initialize the discrete adjoint with the transposed primal Jacobian system. */
   STRUCT_COMPRESS Kind_Material_Compress;  /*!< \brief Determines if the material is compressible or incompressible (structural analysis). */
   STRUCT_MODEL Kind_Material;              /*!< \brief Determines the material model to be used (structural analysis). */
   STRUCT_DEFORMATION Kind_Struct_Solver;   /*!< \brief Determines the geometric condition (small or large deformations) for structural analysis. */
@@ -604,8 +615,14 @@ private:
   Max_Beta_RoeTurkel;               /*!< \brief Maximum value of Beta for the Roe-Turkel low Mach preconditioner. */
   unsigned long GridDef_Nonlinear_Iter;  /*!< \brief Number of nonlinear increments for grid deformation. */
   unsigned short Deform_StiffnessType;   /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
+  DEFORM_METHOD Deform_Method;           /*!< \brief Method of the volumetric mesh deformation. */
+  su2double Deform_RBF_Radius;           /*!< \brief Support radius of the RBF mesh deformation. */
+  su2double Deform_RBF_Tolerance;        /*!< \brief Relative tolerance of the greedy selection of RBF control points. */
+  unsigned long Deform_RBF_MaxPoints;    /*!< \brief Maximum number of RBF control points. */
   bool Deform_Mesh;                      /*!< \brief Determines whether the mesh will be deformed. */
   bool Deform_Output;                    /*!< \brief Print the residuals during mesh deformation to the console. */
+  bool Deform_ReuseSystem;               /*!< \brief Reuse the mesh deformation matrix, preconditioner, and solution. */
+  bool Deform_CacheStiffness;            /*!< \brief Cache the element stiffness matrices of the mesh deformation. */
   su2double Deform_Tol_Factor;       /*!< \brief Factor to multiply smallest volume for deform tolerance (0.001 default) */
   su2double Deform_Coeff;            /*!< \brief Deform coeffienct */
   su2double Deform_Limit;            /*!< \brief Deform limit */
@@ -679,6 +696,9 @@ private:
 
   unsigned short  nConfig_Files;          /*!< \brief Number of config files for multiphysics problems. */
   string *Config_Filenames;               /*!< \brief List of names for configuration files. */
+  bool Concurrent_Zones;                  /*!< \brief Solve the zones concurrently on disjoint groups of ranks. */
+  unsigned short nZone_CostWeights;       /*!< \brief Number of zone cost weights. */
+  su2double *Zone_CostWeights;            /*!< \brief Relative cost of each zone, used to distribute the ranks. */
   WALL_FUNCTIONS  *Kind_WallFunctions;        /*!< \brief The kind of wall function to use for the corresponding markers. */
   unsigned short  **IntInfo_WallFunctions;    /*!< \brief Additional integer information for the wall function markers. */
   su2double       **DoubleInfo_WallFunctions; /*!< \brief Additional double information for the wall function markers. */
@@ -724,6 +744,13 @@ private:
   unsigned short nCFL_AdaptParam;     /*!< \brief Number of CFL parameters provided in config. */
   bool CFL_Adapt;        /*!< \brief Use adaptive CFL number. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
+  unsigned short HB_InstanceGroups; /*!< \brief Number of groups of ranks over which the harmonic balance instances are distributed. */
+  bool HB_CoupledImplicit;  /*!< \brief Solve the linear systems of all harmonic balance instances as one coupled system. */
+  unsigned short Parareal_TimeSlices;  /*!< \brief Number of time slices solved concurrently by the parareal driver. */
+  unsigned long Parareal_CoarseSteps,  /*!< \brief Number of time steps of the coarse propagator per time slice. */
+  Parareal_Iter,                       /*!< \brief Maximum number of parareal iterations. */
+  Parareal_SliceBegin = 0;             /*!< \brief First time iteration of the time slice of this rank. */
+  su2double Parareal_Tol;              /*!< \brief Tolerance on the relative change of the slice states between parareal iterations. */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
   RefSharpEdges,         /*!< \brief Reference coefficient for detecting sharp edges. */
@@ -963,6 +990,8 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  unsigned long RadialBasisFunction_LocalPoints; /*!< \brief Number of donors of local RBF stencils (0 for global RBF). */
+  bool SlidingMesh_PeriodicCache;            /*!< \brief Reuse the sliding mesh coefficients after each revolution. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -976,7 +1005,9 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
-  unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
+  unsigned short DirectDiff;        /*!< \brief Direct Differentation mode (variable of the first direction). */
+  unsigned short *DirectDiff_List,  /*!< \brief Variables of the direct differentiation, one per tangent direction. */
+  nDirectDiff;                      /*!< \brief Number of direct differentiation variables. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
   WINDOW_FUNCTION Kind_WindowFct;      /*!< \brief Type of window (weight) function for objective functional. */
@@ -1356,6 +1387,15 @@ public:
    */
   static unsigned short GetnDim(string val_mesh_filename, unsigned short val_format);
 
+  /*!
+   * \brief Gets the number of elements of a zone in the mesh file (without reading the mesh).
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_format - Format of the file with the grid information.
+   * \param[in] val_iZone - Zone of interest, for files that contain multiple zones.
+   * \return Number of elements of the zone, 0 if it cannot be determined.
+   */
+  static unsigned long GetnElem(string val_mesh_filename, unsigned short val_format, unsigned short val_iZone);
+
   /*!
    * \brief Initializes pointers to null
    */
@@ -2614,6 +2654,19 @@ public:
    */
   void SetMGLevels(unsigned short val_nMGLevels) { nMGLevels = val_nMGLevels; }
 
+  /*!
+   * \brief Get whether the multigrid levels are agglomerated independently of the partitioning,
+   *        the partitions are then aligned with the coarse control volumes.
+   * \return <code>TRUE</code> if the partition independent agglomeration is used.
+   */
+  bool GetMG_InterfaceAgglomeration(void) const { return MG_InterfaceAgglomeration; }
+
+  /*!
+   * \brief Get whether the turbulence equations are solved with the FAS multigrid cycle.
+   * \return <code>TRUE</code> if multigrid is used for the turbulence equations.
+   */
+  bool GetMG_Turb(void) const { return MG_Turb; }
+
   /*!
    * \brief Get the index of the finest grid.
    * \return Index of the finest grid in a multigrid strategy, this is 0 unless we are
@@ -2944,6 +2997,23 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Get the number of primal checkpoints kept in memory by the unsteady discrete adjoint.
+   * \return Number of checkpoints, 0 if the primal solution of each time step is read from file.
+   */
+  unsigned long GetUnst_AdjointCheckpoints(void) const { return Unst_AdjointCheckpoints; }
+
+  /*!
+   * \brief Get the first time step that the unsteady discrete adjoint recomputes from checkpoints.
+   * \note The two time steps before it are read from restart files (or set to free-stream if negative).
+   */
+  long GetUnst_AdjointCheckpointStart(void) const { return Unst_AdjointCheckpointStart; }
+
+  /*!
+   * \brief Get the number of inner iterations of the primal time steps recomputed by the unsteady adjoint.
+   */
+  unsigned long GetUnst_AdjointPrimalIter(void) const { return Unst_AdjointPrimalIter; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3901,6 +3971,30 @@ public:
    */
   bool GetLeastSquaresRequired(void) const { return LeastSquaresRequired; }
 
+  /*!
+   * \brief Get whether gradients are computed with an edge loop (each edge visited once).
+   * \return <code>TRUE</code> for edge-based gradients, <code>FALSE</code> for point-based.
+   */
+  bool GetEdgeBasedGradients(void) const { return EdgeBasedGradients; }
+
+  /*!
+   * \brief Set whether gradients are computed with an edge loop.
+   * \param[in] edgeBased - <code>TRUE</code> for edge-based gradients.
+   */
+  void SetEdgeBasedGradients(bool edgeBased) { EdgeBasedGradients = edgeBased; }
+
+  /*!
+   * \brief Get whether the least-squares weights are precomputed and stored (trading memory for speed).
+   * \return <code>TRUE</code> if the weights are stored.
+   */
+  bool GetPrecomputeLSWeights(void) const { return PrecomputeLSWeights; }
+
+  /*!
+   * \brief Set whether the least-squares weights are precomputed and stored.
+   * \param[in] precompute - <code>TRUE</code> to store the weights.
+   */
+  void SetPrecomputeLSWeights(bool precompute) { PrecomputeLSWeights = precompute; }
+
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -4046,6 +4140,12 @@ public:
    */
   unsigned short GetKind_DiscAdj_Linear_Prec(void) const { return Kind_DiscAdj_Linear_Prec; }
 
+  /*!
+   * \brief Get whether the discrete adjoint is initialized by solving the transposed primal Jacobian system.
+   * \return <code>TRUE</code> if the Jacobian-based initial adjoint is used.
+   */
+  bool GetDiscAdj_JacobianGuess(void) const { return DiscAdj_JacobianGuess; }
+
   /*!
    * \brief Get the kind of preconditioner for the implicit solver.
    * \return Numerical preconditioner for implicit formulation (solving the linear system).
@@ -4100,6 +4200,20 @@ public:
    */
   bool GetDeform_Output(void) const { return Deform_Output; }
 
+  /*!
+   * \brief Get whether the stiffness matrix, preconditioner, and displacements of the mesh
+   *        deformation are reused when the same grid is deformed again.
+   * \return <code>TRUE</code> if the linear system is reused.
+   */
+  bool GetDeform_ReuseSystem(void) const { return Deform_ReuseSystem; }
+
+  /*!
+   * \brief Get whether the element stiffness matrices of the mesh deformation are cached,
+   *        such that only the elements that moved are recomputed during assembly.
+   * \return <code>TRUE</code> if the element matrices are cached.
+   */
+  bool GetDeform_CacheStiffness(void) const { return Deform_CacheStiffness; }
+
   /*!
    * \brief Get factor to multiply smallest volume for deform tolerance.
    * \return Factor to multiply smallest volume for deform tolerance.
@@ -4129,6 +4243,26 @@ public:
    */
   unsigned short GetDeform_Stiffness_Type(void) const { return Deform_StiffnessType; }
 
+  /*!
+   * \brief Get the method of the volumetric mesh deformation.
+   */
+  DEFORM_METHOD GetDeform_Method(void) const { return Deform_Method; }
+
+  /*!
+   * \brief Get the support radius of the RBF mesh deformation (0 for automatic).
+   */
+  su2double GetDeform_RBF_Radius(void) const { return Deform_RBF_Radius; }
+
+  /*!
+   * \brief Get the tolerance of the greedy selection of RBF control points, relative to the largest displacement.
+   */
+  su2double GetDeform_RBF_Tolerance(void) const { return Deform_RBF_Tolerance; }
+
+  /*!
+   * \brief Get the maximum number of RBF control points.
+   */
+  unsigned long GetDeform_RBF_MaxPoints(void) const { return Deform_RBF_MaxPoints; }
+
   /*!
    * \brief Get the size of the layer of highest stiffness for wall distance-based mesh stiffness.
    */
@@ -4435,6 +4569,12 @@ public:
    */
   unsigned short GetKind_SlopeLimit_Flow(void) const { return Kind_SlopeLimit_Flow; }
 
+  /*!
+   * \brief Get whether the reconstruction gradient and the limiter of the flow equations are fused.
+   * \return <code>TRUE</code> if they are computed in a single sweep over the grid points.
+   */
+  bool GetFusedLimiter_Flow(void) const { return FusedLimiter_Flow; }
+
   /*!
    * \brief Get the method for limiting the spatial gradients.
    * \return Method for limiting the spatial gradients solving the turbulent equation.
@@ -5689,6 +5829,55 @@ public:
    */
   bool GetHB_Precondition(void) const { return HB_Precondition; }
 
+  /*!
+   * \brief Get the number of groups of ranks over which the harmonic balance instances are distributed.
+   * \return Number of instance groups (1 solves all instances on all ranks).
+   */
+  unsigned short GetHB_InstanceGroups(void) const { return HB_InstanceGroups; }
+
+  /*!
+   * \brief Get if the implicit systems of the harmonic balance instances are solved as one system,
+   *        i.e. with the spectral operator in the matrix.
+   * \return yes or no to the coupled implicit harmonic balance solver.
+   */
+  bool GetHB_CoupledImplicit(void) const { return HB_CoupledImplicit; }
+
+  /*!
+   * \brief Get the number of time slices that are solved concurrently (parareal), 1 disables time parallelism.
+   * \return Number of time slices.
+   */
+  unsigned short GetParareal_TimeSlices(void) const { return Parareal_TimeSlices; }
+
+  /*!
+   * \brief Get the number of time steps of the coarse propagator in each time slice.
+   * \return Number of coarse time steps per slice.
+   */
+  unsigned long GetParareal_CoarseSteps(void) const { return Parareal_CoarseSteps; }
+
+  /*!
+   * \brief Get the maximum number of parareal iterations.
+   * \return Maximum number of iterations (0 means the number of time slices, for which the method is exact).
+   */
+  unsigned long GetParareal_Iter(void) const { return Parareal_Iter; }
+
+  /*!
+   * \brief Get the tolerance on the relative change of the slice states between parareal iterations.
+   * \return Parareal convergence tolerance.
+   */
+  su2double GetParareal_Tol(void) const { return Parareal_Tol; }
+
+  /*!
+   * \brief Get the first time iteration of the time slice solved by this rank.
+   * \return Time iteration where the slice begins.
+   */
+  unsigned long GetParareal_SliceBegin(void) const { return Parareal_SliceBegin; }
+
+  /*!
+   * \brief Set the first time iteration of the time slice solved by this rank.
+   * \param[in] iter - Time iteration where the slice begins.
+   */
+  void SetParareal_SliceBegin(unsigned long iter) { Parareal_SliceBegin = iter; }
+
   /*!
    * \brief Get if we should update the motion origin.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -8345,6 +8534,19 @@ public:
    */
   unsigned short GetDirectDiff() const { return DirectDiff;}
 
+  /*!
+   * \brief Get the number of direct differentiation variables (tangent directions).
+   * \return Number of variables listed in DIRECT_DIFF.
+   */
+  unsigned short GetnDirectDiff() const { return nDirectDiff;}
+
+  /*!
+   * \brief Get the variable differentiated in a tangent direction.
+   * \param[in] iDir - Index of the direction.
+   * \return Direct differentiation variable.
+   */
+  unsigned short GetDirectDiff(unsigned short iDir) const { return DirectDiff_List[iDir];}
+
   /*!
    * \brief Get the indicator whether we are solving an discrete adjoint problem.
    * \return the discrete adjoint indicator.
@@ -8732,6 +8934,16 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the number of donor points of the local RBF stencil of each target point (0 for global RBF).
+   */
+  unsigned long GetRadialBasisFunctionLocalPoints(void) const { return RadialBasisFunction_LocalPoints; }
+
+  /*!
+   * \brief Get whether the sliding mesh coefficients of a constant speed rotation are stored and reused.
+   */
+  bool GetSlidingMeshPeriodicCache(void) const { return SlidingMesh_PeriodicCache; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -8845,6 +9057,12 @@ public:
    */
   bool GetAD_Preaccumulation(void) const { return AD_Preaccumulation;}
 
+  /*!
+   * \brief Get if the Green-Gauss and least-squares gradients are recorded as external functions.
+   * \return <code>TRUE</code> if the tape stores only their inputs and outputs.
+   */
+  bool GetAD_ExternalGradients(void) const { return AD_ExternalGradients; }
+
   /*!
    * \brief Get the heat equation.
    * \return YES if weakly coupled heat equation for inc. flow is enabled.
@@ -8857,6 +9075,13 @@ public:
    */
   CHT_COUPLING GetKind_CHT_Coupling() const { return Kind_CHT_Coupling; }
 
+  /*!
+   * \brief Get if the solid conduction of CHT problems is solved without pseudo time stepping, with the
+   *        linearized (Robin) heat flux of the fluid, the fluid side of the interface is lagged.
+   * \return YES if the pseudo time term of the solid is dropped.
+   */
+  bool GetCHT_SolidNoPseudoTime() const { return CHT_SolidNoPseudoTime; }
+
   /*!
    * \brief Check if values passed to the BC_HeatFlux-Routine are already integrated.
    * \return YES if the passed values is the integrated heat flux over the marker's surface.
@@ -8934,6 +9159,25 @@ public:
    */
   unsigned short GetnConfigFiles(void) const { return nConfig_Files; }
 
+  /*!
+   * \brief Check if the zones of a multizone problem are solved concurrently on disjoint groups of ranks.
+   * \return YES if the zones run concurrently.
+   */
+  bool GetConcurrent_Zones(void) const { return Concurrent_Zones; }
+
+  /*!
+   * \brief Get the number of zone cost weights.
+   * \return Number of values in ZONE_COST_WEIGHTS (0 if the costs are estimated from the meshes).
+   */
+  unsigned short GetnZone_CostWeights(void) const { return nZone_CostWeights; }
+
+  /*!
+   * \brief Get the relative cost of a zone.
+   * \param[in] val_zone - Index of the zone.
+   * \return Weight used to distribute the ranks among the zones.
+   */
+  su2double GetZone_CostWeights(unsigned short val_zone) const { return Zone_CostWeights[val_zone]; }
+
   /*!
    * \brief Check if the multizone problem is solved for time domain.
    * \return YES if time-domain is considered.
@@ -30,6 +30,7 @@
 #include "./CADTBaseClass.hpp"
 #include "./CBBoxTargetClass.hpp"
 #include "../parallelization/omp_structure.hpp"
+#include "../parallelization/mpi_structure.hpp"
 
 /*!
  * \class CADTElemClass
@@ -78,6 +79,7 @@ public:
    * \param[in]     val_elemID   Local element IDs of the elements.
    * \param[in]     globalTree   Whether or not a global tree must be built. If false
                                  a local ADT is built.
+   * \param[in]     comm         Communicator over which the global tree is gathered.
    */
   CADTElemClass(unsigned short         val_nDim,
                 vector<su2double>      &val_coor,
@@ -85,7 +87,8 @@ public:
                 vector<unsigned short> &val_VTKElem,
                 vector<unsigned short> &val_markerID,
                 vector<unsigned long>  &val_elemID,
-                const bool             globalTree);
+                const bool             globalTree,
+                SU2_MPI::Comm          comm = SU2_MPI::GetComm());
 
   /*!
    * \brief Function, which determines the element that contains the given coordinate.
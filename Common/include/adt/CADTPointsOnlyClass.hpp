@@ -75,6 +75,24 @@ public:
                               coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the k nearest nodes in the ADT for the given coordinate.
+   * \note The local point IDs are used to break ties, fewer nodes are returned if the ADT is smaller.
+   * \param[in]  coor    Coordinate for which the nearest nodes in the ADT must be determined.
+   * \param[in]  k       Number of nodes to determine.
+   * \param[out] dist2   Distances squared to the nearest nodes, in increasing order.
+   * \param[out] pointID Local point IDs of the nearest nodes.
+   * \param[out] rankID  Ranks on which the nearest nodes are stored.
+   */
+  inline void DetermineNearestNodes(const su2double       *coor,
+                                    unsigned long         k,
+                                    vector<su2double>     &dist2,
+                                    vector<unsigned long> &pointID,
+                                    vector<int>           &rankID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNearestNodes_impl(FrontLeaves[iThread], coor, k, dist2, pointID, rankID);
+  }
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -91,4 +109,15 @@ private:
                                  su2double       &dist,
                                  unsigned long   &pointID,
                                  int             &rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNearestNodes.
+   * \note Working variable (first) passed explicitly for thread safety.
+   */
+  void DetermineNearestNodes_impl(vector<unsigned long> &stackLeaves,
+                                  const su2double       *coor,
+                                  unsigned long         k,
+                                  vector<su2double>     &dist2,
+                                  vector<unsigned long> &pointID,
+                                  vector<int>           &rankID) const;
 };
@@ -83,9 +83,53 @@ namespace SU2_TYPE {
    */
   void SetDerivative(su2double &data, const passivedouble &val);
 
+  /*!
+   * \brief Number of tangent directions carried by the datatype (more than 1 for vector forward mode).
+   * \note The functions above act on the first direction.
+   */
+#if defined(CODI_FORWARD_DIRS)
+  constexpr unsigned short nDirections = CODI_FORWARD_DIRS;
+#else
+  constexpr unsigned short nDirections = 1;
+#endif
+
+  /*!
+   * \brief Get the derivative value of the datatype in one of the tangent directions.
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] iDir - Index of the direction (< nDirections).
+   * \return The derivative value.
+   */
+  passivedouble GetDerivative(const su2double &data, unsigned short iDir);
+
+  /*!
+   * \brief Set the derivative value of the datatype in one of the tangent directions.
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] val - The value of the derivative.
+   * \param[in] iDir - Index of the direction (< nDirections).
+   */
+  void SetDerivative(su2double &data, const passivedouble &val, unsigned short iDir);
+
   /*--- Implementation of the above for the different types. ---*/
 
-#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+#if defined(CODI_FORWARD_DIRS)
+
+  FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data.setValue(val);}
+
+  FORCEINLINE passivedouble GetValue(const su2double& data) {return data.getValue();}
+
+  FORCEINLINE void SetSecondary(su2double& data, const passivedouble &val) {data.gradient()[0] = val;}
+
+  FORCEINLINE void SetDerivative(su2double& data, const passivedouble &val) {data.gradient()[0] = val;}
+
+  FORCEINLINE passivedouble GetSecondary(const su2double& data) {return data.getGradient()[0];}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double& data) {return data.getGradient()[0];}
+
+  FORCEINLINE void SetDerivative(su2double& data, const passivedouble &val, unsigned short iDir) {data.gradient()[iDir] = val;}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double& data, unsigned short iDir) {return data.getGradient()[iDir];}
+
+#elif defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
 
   FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data.setValue(val);}
 
@@ -99,6 +143,10 @@ namespace SU2_TYPE {
 
   FORCEINLINE passivedouble GetDerivative(const su2double& data) {return data.getGradient();}
 
+  FORCEINLINE void SetDerivative(su2double& data, const passivedouble &val, unsigned short) {data.setGradient(val);}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double& data, unsigned short) {return data.getGradient();}
+
 #else // passive type, no AD
 
   FORCEINLINE void SetValue(su2double& data, const passivedouble &val) {data = val;}
@@ -112,6 +160,10 @@ namespace SU2_TYPE {
   FORCEINLINE passivedouble GetSecondary(const su2double&) {return 0.0;}
 
   FORCEINLINE void SetDerivative(su2double &, const passivedouble &) {}
+
+  FORCEINLINE passivedouble GetDerivative(const su2double&, unsigned short) {return 0.0;}
+
+  FORCEINLINE void SetDerivative(su2double &, const passivedouble &, unsigned short) {}
 #endif
 
   /*!
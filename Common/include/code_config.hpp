@@ -94,7 +94,11 @@ using su2double = codi::RealReverse;
 #endif
 #elif defined(CODI_FORWARD_TYPE) // forward mode AD
 #include "codi.hpp"
+#if defined(CODI_FORWARD_DIRS) // vector mode, multiple tangent directions per evaluation
+using su2double = codi::RealForwardVec<CODI_FORWARD_DIRS>;
+#else
 using su2double = codi::RealForward;
+#endif
 
 #else // primal / direct / no AD
 using su2double = double;
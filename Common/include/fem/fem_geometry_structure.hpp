@@ -1217,9 +1217,10 @@ protected:
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] comm - Communicator of the ranks that build the (global) tree.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config, SU2_MPI::Comm comm) const override;
 
   /*!
    * \brief Set wall distances a specific value
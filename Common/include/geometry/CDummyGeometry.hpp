@@ -45,5 +45,14 @@ public:
    */
   CDummyGeometry(CConfig *config);
 
+  /*!
+   * \brief Build an empty ADT of the viscous walls, the construction of the (global) tree is collective,
+   *        this allows ranks with dummy geometries to take part in the wall distance computation of other ranks.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] comm - Communicator of the ranks that build the (global) tree.
+   * \return Empty ADT.
+   */
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config, SU2_MPI::Comm comm) const override;
+
 };
 
@@ -177,16 +177,25 @@ protected:
 
   CEdgeToNonZeroMapUL edgeToCSRMap;      /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
 
-  /*--- Edge and element colorings. ---*/
+  /*--- Edge, element, and point colorings. ---*/
 
   CCompressedSparsePatternUL
   edgeColoring,                          /*!< \brief Edge coloring structure for thread-based parallelization. */
-  elemColoring;                          /*!< \brief Element coloring structure for thread-based parallelization. */
+  elemColoring,                          /*!< \brief Element coloring structure for thread-based parallelization. */
+  pointColoring;                         /*!< \brief Coloring of the domain points by closed neighborhood (see GetPointColoring). */
   unsigned long edgeColorGroupSize{1};   /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize{1};   /*!< \brief Size of the element groups within each color. */
+  unsigned long pointColorGroupSize{1};  /*!< \brief Size of the point groups within each color. */
 
   ColMajorMatrix<uint8_t> CoarseGridColor_;  /*!< \brief Coarse grid levels, colorized. */
 
+  /*--- Precomputed least-squares weights, [0] unweighted, [1] inverse-distance weighted. ---*/
+
+  su2activematrix LSWeights[2];          /*!< \brief Weights (nDim) of each point-neighbor pair, same layout as nodes->GetPoints(). */
+  bool LSWeightsValid[2] = {false,false}; /*!< \brief Whether the weights correspond to the current coordinates. */
+
+  short passiveRecording{-1};  /*!< \brief Whether the grid metrics are passive in the current AD recording (-1 not known yet). */
+
 public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -915,6 +924,12 @@ public:
    */
   inline virtual void SetRestricted_GridVelocity(CGeometry *fine_mesh, const CConfig *config) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] fine_mesh - Geometry of the fine mesh.
+   */
+  inline virtual void SetRestricted_WallDistance(const CGeometry *fine_mesh) {}
+
   /*!
    * \brief Check if a boundary is straight(2D) / plane(3D) for EULER_WALL and SYMMETRY_PLANE
    *        only and store the information in bound_is_straight. For all other boundary types
@@ -1648,12 +1663,81 @@ public:
    */
   inline unsigned long GetElementColorGroupSize(void) const { return elemColorGroupSize; }
 
+  /*!
+   * \brief Get the coloring of the domain points, two points of the same color (and different
+   *        groups) are not neighbors and have no common neighbors, i.e. they share no edge data.
+   * \note This method computes the coloring if that has not been done yet, it is only computed
+   *       when using threads and it is empty if the coloring fails (there is no natural fallback).
+   * \param[out] efficiency - optional output of the coloring efficiency.
+   * \return Reference to the coloring.
+   */
+  const CCompressedSparsePatternUL& GetPointColoring(su2double* efficiency = nullptr);
+
+  /*!
+   * \brief Get the group size used in point coloring.
+   * \return Group size.
+   */
+  inline unsigned long GetPointColorGroupSize(void) const { return pointColorGroupSize; }
+
+  /*!
+   * \brief Get the colors to loop over the domain points in routines that read neighbor data (gradients, limiters).
+   * \note When recording the AD tape with threads (and if GetPointColoring was called before the parallel
+   *       region) the colors of the point coloring are used, the points of a color can then be preaccumulated
+   *       and recorded without shared reading. Otherwise the natural order is used (one color).
+   *       Only the recording is colored, the reverse sweep of the tape is not parallelized by this.
+   * \param[out] colored - True if the point coloring is used.
+   * \param[in] allowColoring - False for loops that cannot be colored (e.g. they read global data).
+   * \return The colors, loop over them with a worksharing loop of chunk size multiple of the group size.
+   */
+  vector<OptionalGridColor<> > GetPointLoopColors(bool& colored, bool allowColoring = true) const;
+
+  /*!
+   * \brief Get the storage for the precomputed least-squares weights of each point-neighbor pair.
+   * \note The storage is allocated on first call (not thread-safe), the weights are computed by
+   *       the gradient routines, which use GetLeastSquaresWeightsValid to decide when to do it.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   * \return Reference to the weights, the row of (iPoint, jPoint) is nodes->GetPoints().outerPtr()[iPoint] + jNeigh.
+   */
+  su2activematrix& GetLeastSquaresWeights(bool weighted);
+
+  /*!
+   * \brief Get whether the stored least-squares weights are up to date.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   */
+  inline bool GetLeastSquaresWeightsValid(bool weighted) const { return LSWeightsValid[weighted]; }
+
+  /*!
+   * \brief Mark the stored least-squares weights as up to date (or not).
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   * \param[in] valid - New status.
+   */
+  inline void SetLeastSquaresWeightsValid(bool weighted, bool valid) { LSWeightsValid[weighted] = valid; }
+
+  /*!
+   * \brief Invalidate the least-squares weights after grid movement, they are recomputed
+   *        in place (i.e. without re-allocating) the next time they are used.
+   */
+  inline void InvalidateLeastSquaresWeights() { LSWeightsValid[0] = LSWeightsValid[1] = false; }
+
+  /*!
+   * \brief Get whether the grid metrics (volumes and normals) are passive in the current AD recording.
+   * \return 1 if passive, 0 if active, -1 if not known yet.
+   */
+  inline short GetPassiveRecording() const { return passiveRecording; }
+
+  /*!
+   * \brief Set whether the grid metrics are passive in the current AD recording.
+   * \param[in] passive - 1 if passive, 0 if active, -1 to decide again when a new recording starts.
+   */
+  inline void SetPassiveRecording(short passive) { passiveRecording = passive; }
+
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] comm - Communicator of the ranks that build the (global) tree.
    * \return pointer to the ADT
    */
-  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const { return nullptr; }
+  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config, SU2_MPI::Comm comm) const { return nullptr; }
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
@@ -1675,8 +1759,10 @@ public:
    * \brief Compute the distances to the closest vertex on viscous walls over the entire domain
    * \param[in] config_container - Definition of the particular problem.
    * \param[in] geometry_container - Geometrical definition of the problem.
+   * \param[in] comm - Communicator of the ranks that hold all the zones.
    */
-  static void ComputeWallDistance(const CConfig * const *config_container, CGeometry ****geometry_container);
+  static void ComputeWallDistance(const CConfig * const *config_container, CGeometry ****geometry_container,
+                                  SU2_MPI::Comm comm = SU2_MPI::GetComm());
 
   /*!
    * \brief Set the amount of nonconvex elements in the mesh.
@@ -71,6 +71,15 @@ public:
    */
   bool GeometricalCheck(unsigned long iPoint, CGeometry *fine_grid, CConfig *config);
 
+  /*!
+   * \brief Agglomerate the domain points of the fine grid with the partition independent
+   *        algorithm of CMultiGridGraph (MG_INTERFACE_AGGLOMERATION).
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Number of coarse control volumes.
+   */
+  unsigned long SetGraphAgglomeration(CGeometry *fine_grid, const CConfig *config);
+
   /*!
    * \brief Determine if a CVPoint van be agglomerated, if it have the same marker point as the seed.
    * \param[in] Suitable_Indirect_Neighbors - List of Indirect Neighbours that can be agglomerated.
@@ -151,6 +160,13 @@ public:
    */
   void SetRestricted_GridVelocity(CGeometry *fine_mesh, const CConfig *config) override;
 
+  /*!
+   * \brief Set the wall distance at each node in the coarse mesh level as the
+   *        volume-weighted average of the distances of its children.
+   * \param[in] fine_mesh - Geometry container for the finer mesh level.
+   */
+  void SetRestricted_WallDistance(const CGeometry *fine_mesh) override;
+
   /*!
    * \brief Find and store the closest neighbor to a vertex.
    * \param[in] config - Definition of the particular problem.
@@ -0,0 +1,118 @@
+/*!
+ * \file CMultiGridGraph.hpp
+ * \brief Header of the distributed graph used to agglomerate the multigrid levels
+ *        independently of the partitioning.
+ *        The subroutines and functions are in the <i>CMultiGridGraph.cpp</i> file.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CMultiGridGraph
+ * \brief Graph of control volumes distributed over the ranks, each rank stores the nodes it owns
+ *        and the global index of their neighbors (which may be owned by other ranks).
+ * \note The nodes are agglomerated with their neighbors around the seeds of distance-2 maximal
+ *       independent sets, the priority of a node is a hash of its global index. Hence the
+ *       agglomeration only depends on the global graph, and not on how it is partitioned.
+ */
+class CMultiGridGraph {
+public:
+  using OwnerFunction = std::function<int(unsigned long)>;
+
+private:
+  vector<unsigned long> globalIndex;        /*!< \brief Global index of the nodes owned by this rank. */
+  vector<unsigned long> tag;                /*!< \brief Physical markers of each node (see MarkerTag). */
+  vector<vector<unsigned long> > neighbors; /*!< \brief Global index of the neighbors of each node. */
+  unordered_map<unsigned long, unsigned long> localIndex; /*!< \brief Global to local index of the owned nodes. */
+  OwnerFunction owner;                      /*!< \brief Rank that owns a node, given its global index. */
+
+  /*!
+   * \brief Neighbors of the owned nodes that are owned by other ranks.
+   * \param[out] adjacency - Neighbors of each node, local index of the owned nodes followed by the ghosts.
+   * \return Global index of the ghosts.
+   */
+  vector<unsigned long> GetGhosts(vector<vector<unsigned long> >& adjacency) const;
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] idx - Global index of the nodes owned by this rank.
+   * \param[in] tags - Physical markers of each node, only nodes with the same tag are agglomerated.
+   * \param[in] adjacency - Global index of the neighbors of each node.
+   * \param[in] ownerFunction - Rank that owns a node, for the nodes and all their neighbors.
+   */
+  CMultiGridGraph(vector<unsigned long> idx, vector<unsigned long> tags,
+                  vector<vector<unsigned long> > adjacency, OwnerFunction ownerFunction);
+
+  /*!
+   * \brief No default construction.
+   */
+  CMultiGridGraph() = delete;
+
+  /*!
+   * \brief Get the number of nodes owned by this rank.
+   */
+  inline unsigned long GetnNode() const { return globalIndex.size(); }
+
+  /*!
+   * \brief Get the global index of an owned node.
+   */
+  inline unsigned long GetGlobalIndex(unsigned long iNode) const { return globalIndex[iNode]; }
+
+  /*!
+   * \brief Get values of nodes owned by any rank (collective).
+   * \param[in] idx - Global index of the nodes whose values are requested.
+   * \param[in] values - Values of the owned nodes.
+   * \return The values of idx.
+   */
+  vector<unsigned long> Query(const vector<unsigned long>& idx, const vector<unsigned long>& values) const;
+
+  /*!
+   * \brief Agglomerate the nodes with their neighbors around the seeds of distance-2 maximal independent
+   *        sets of the nodes not yet agglomerated (collective).
+   * \return The global index of the seed of each owned node.
+   */
+  vector<unsigned long> Agglomerate() const;
+
+  /*!
+   * \brief Build the graph of the agglomerated nodes (collective), its nodes are the seeds, they keep
+   *        their global index, owner, and tag, and two seeds are neighbors if any of their nodes are.
+   * \param[in] seed - Seed of each owned node, see Agglomerate.
+   * \return The coarse graph.
+   */
+  CMultiGridGraph Coarsen(const vector<unsigned long>& seed) const;
+
+  /*!
+   * \brief Combine the physical markers of a node into a tag.
+   * \param[in] markers - Index (in the config file) of the physical markers of the node.
+   * \return The tag, 0 for interior nodes.
+   */
+  static unsigned long MarkerTag(vector<unsigned short> markers);
+};
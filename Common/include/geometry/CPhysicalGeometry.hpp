@@ -506,6 +506,14 @@ public:
    */
   void SetColorGrid_Parallel(const CConfig *config) override;
 
+  /*!
+   * \brief Move the points of each multigrid control volume of the partition independent
+   *        agglomeration (MG_INTERFACE_AGGLOMERATION) to the rank of its seed, so that no
+   *        control volume of any level is split between ranks.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetColorGrid_Agglomeration(const CConfig *config);
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
@@ -753,9 +761,10 @@ public:
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] comm - Communicator of the ranks that build the (global) tree.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config, SU2_MPI::Comm comm) const override;
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
@@ -49,15 +49,33 @@ protected:
   unsigned long nIterMesh;  /*!< \brief Number of iterations in the mesh update. +*/
 
 #ifndef CODI_FORWARD_TYPE
-  CSysMatrix<su2mixedfloat> StiffMatrix; /*!< \brief Stiffness matrix of the elasticity problem. */
-  CSysSolve<su2mixedfloat>  System;      /*!< \brief Linear solver/smoother. */
+  using MatrixType = su2mixedfloat;
 #else
-  CSysMatrix<su2double> StiffMatrix;
-  CSysSolve<su2double>  System;
+  using MatrixType = su2double;
 #endif
+  CSysMatrix<MatrixType> StiffMatrix; /*!< \brief Stiffness matrix of the elasticity problem. */
+  CSysSolve<MatrixType>  System;      /*!< \brief Linear solver/smoother. */
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  enum : size_t {OMP_MIN_SIZE = 32}; /*!< \brief Chunk size for small loops. */
+
+  vector<unsigned long> ElemBlockPtr;  /*!< \brief Start of the node pairs of each element in ElemBlocks. */
+  vector<MatrixType*> ElemBlocks;      /*!< \brief Blocks of StiffMatrix for each pair of element nodes (scatter map). */
+  vector<passivedouble> ElemStiffness; /*!< \brief Cached element stiffness matrices, stored as the blocks of ElemBlocks. */
+  su2passivematrix ElemCacheKey;       /*!< \brief Corner coordinates (and wall distance) of the cached matrices. */
+
+  su2passivematrix AssembledCoord;  /*!< \brief Coordinates of the grid for which StiffMatrix was last assembled. */
+  su2double AssembledMinVolume = 0; /*!< \brief Minimum volume computed during that assembly. */
+  bool SystemReused = false;        /*!< \brief Whether the last deformation reused the assembled system. */
+
+  /*!
+   * \brief Check if the grid is the one for which the stiffness matrix was last assembled.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \return True if the coordinates did not change.
+   */
+  bool SameGridAsAssembled(const CGeometry *geometry) const;
+
 public:
 
   /*!
@@ -225,13 +243,30 @@ public:
   su2double GetQuadrilateral_Area(su2double CoordCorners[8][3]) const;
 
   /*!
-   * \brief Add the stiffness matrix for a 2-D triangular element to the global stiffness matrix for the entire mesh (node-based).
+   * \brief Compute the displacements of all points (in LinSysSol) by RBF interpolation of the boundary displacements.
+   * \note The control points are selected greedily from the boundary points, the interpolation uses Wendland C2
+   *       functions, whose compact support allows evaluating it at each point with a cell-list search.
    * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] StiffMatrix_Elem - Element stiffness matrix to be filled.
-   * \param[in] PointCorners - Index values for element corners
-   * \param[in] nNodes - Number of nodes defining the element.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] MaxError - Largest interpolation error at the boundary points.
+   * \return Number of control points.
    */
-  void AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes);
+  unsigned long SetRBF_Displacements(CGeometry *geometry, CConfig *config, su2double &MaxError);
+
+  /*!
+   * \brief Get the coordinate axis normal to a symmetry plane.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iMarker - Index of the symmetry marker.
+   * \return Index of the axis.
+   */
+  unsigned short GetSymmetryAxis(const CGeometry *geometry, unsigned short iMarker) const;
+
+  /*!
+   * \brief Build the map from the node pairs of each element to the blocks of the global stiffness matrix.
+   * \note Blocks that do not exist in the matrix (e.g. between halo nodes) are mapped to nullptr.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetElemScatterMap(const CGeometry *geometry);
 
   /*!
    * \brief Check for negative volumes (all elements) after performing grid deformation.
@@ -351,15 +386,17 @@ public:
    * \brief Set the derivatives of the boundary nodes.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] iDir - Tangent direction of the forward AD type.
    */
-  void SetBoundaryDerivatives(CGeometry *geometry, CConfig *config);
+  void SetBoundaryDerivatives(CGeometry *geometry, CConfig *config, unsigned short iDir = 0);
 
   /*!
    * \brief Update the derivatives of the coordinates after the grid movement.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] iDir - Tangent direction of the forward AD type.
    */
-  void UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config);
+  void UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config, unsigned short iDir = 0);
 
   /*!
    * \brief Store the number of iterations when moving the mesh.
@@ -373,6 +410,11 @@ public:
    */
   inline unsigned long Get_nIterMesh() const { return nIterMesh; }
 
+  /*!
+   * \brief Whether the last call to SetVolume_Deformation reused the stiffness matrix and preconditioner.
+   */
+  inline bool GetSystemReused() const { return SystemReused; }
+
   /*!
    * \brief Set the boundary dependencies in the mesh side of the problem
    * \param[in] geometry - Geometrical definition of the problem.
@@ -29,6 +29,7 @@
 #include "../../include/basic_types/datatype_structure.hpp"
 #include "../../include/containers/C2DContainer.hpp"
 #include "../../include/containers/container_decorators.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
 #include <vector>
 #include <algorithm>
 
@@ -45,8 +46,9 @@ using namespace std;
  */
 class CInterpolator {
 protected:
-  const int rank;            /*!< \brief MPI Rank. */
-  const int size;            /*!< \brief MPI Size. */
+  const SU2_MPI::Comm comm;  /*!< \brief Communicator of the ranks of both zones. */
+  const int rank;            /*!< \brief MPI Rank (in comm). */
+  const int size;            /*!< \brief MPI Size (of comm). */
   const unsigned donorZone;  /*!< \brief Index of donor zone. */
   const unsigned targetZone; /*!< \brief Index of target zone. */
 
@@ -83,6 +85,8 @@ protected:
   CGeometry* const donor_geometry;   /*! \brief Donor geometry. */
   CGeometry* const target_geometry;  /*! \brief Target geometry. */
 
+  unsigned long nTransferCoeffUpdates = 0; /*!< \brief Number of times the transfer coefficients were computed. */
+
 public:
   struct CDonorInfo {
     vector<int> processor;
@@ -105,9 +109,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iZone - index of the donor zone.
    * \param[in] jZone - index of the target zone.
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
   CInterpolator(CGeometry ****geometry_container, const CConfig* const* config,
-                unsigned int iZone, unsigned int jZone);
+                unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm);
 
   /*!
    * \brief No default construction allowed to force zones and geometry to always be set.
@@ -126,6 +131,17 @@ public:
    */
   virtual void SetTransferCoeff(const CConfig* const* config) = 0;
 
+  /*!
+   * \brief Number of times the transfer coefficients were (re)computed, the interfaces use
+   *        this to know when their communication patterns need to be rebuilt.
+   */
+  inline unsigned long GetnTransferCoeffUpdates() const { return nTransferCoeffUpdates; }
+
+  /*!
+   * \brief Communicator of the interpolation, the donor processors are ranks in it.
+   */
+  inline SU2_MPI::Comm GetComm() const { return comm; }
+
   /*!
    * \brief Print information about the interpolation.
    */
@@ -135,15 +151,17 @@ public:
    * \brief Check whether an interface should be processed or not, i.e. if it is part of the zones.
    * \param[in] val_markDonor  - Marker tag from donor zone.
    * \param[in] val_markTarget - Marker tag from target zone.
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
-  static bool CheckInterfaceBoundary(int val_markDonor, int val_markTarget);
+  static bool CheckInterfaceBoundary(int val_markDonor, int val_markTarget, SU2_MPI::Comm comm);
 
   /*!
    * \brief Check whether two zones have a common interface.
    * \param[in] donor - Configuration of the donor zone.
    * \param[in] target - Configuration of the target zone.
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
-  static bool CheckZonesInterface(const CConfig* donor, const CConfig* target);
+  static bool CheckZonesInterface(const CConfig* donor, const CConfig* target, SU2_MPI::Comm comm);
 
 protected:
   /*!
@@ -185,4 +203,27 @@ protected:
   unsigned long Collect_ElementInfo(int markDonor, unsigned short nDim, bool compress,
                                     vector<unsigned long>& allNumElem, vector<unsigned short>& numNodes,
                                     su2matrix<long>& idxNodes) const;
+
+  /*!
+   * \brief Donor point found by FindNearestDonors.
+   */
+  struct CNearbyDonor {
+    su2double dist2 = 0.0;        /*!< \brief Distance squared to the target point. */
+    unsigned long globalPoint = 0; /*!< \brief Global index of the donor point. */
+    int processor = 0;            /*!< \brief Rank that owns the donor point. */
+    su2double coord[3] = {0.0};   /*!< \brief Coordinates of the donor point. */
+  };
+
+  /*!
+   * \brief Find the k closest donor points of each target vertex of an interface, without gathering
+   *        the donor points on all ranks. Each target is sent to the ranks whose bounding box of donors
+   *        may contain its closest donors, these ranks search their donors with a local ADT.
+   * \note Collective, ties are broken by global index such that the result does not depend on the partitions.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nDonor - Number of donors to find (limited by the total number of donor points).
+   * \param[out] nearby - Closest donors of each target vertex (empty for halo vertices), in increasing distance.
+   */
+  void FindNearestDonors(int markDonor, int markTarget, unsigned long nDonor,
+                         vector<vector<CNearbyDonor> >& nearby) const;
 };
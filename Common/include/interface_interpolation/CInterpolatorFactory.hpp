@@ -42,6 +42,7 @@ namespace CInterpolatorFactory {
  * \param[in] transpInterpolator - Transpose interpolator.
  * \param[in] iZone - Index of the donor zone.
  * \param[in] jZone - Index of the target zone.
+ * \param[in] comm - Communicator of the ranks of both zones.
  * \param[in] verbose - If true, print information to screen.
  * \return Pointer to interpolator on the heap, caller is responsible for deletion.
  */
@@ -49,6 +50,7 @@ CInterpolator* CreateInterpolator(CGeometry ****geometry_container,
                                   const CConfig* const* config,
                                   const CInterpolator* transpInterpolator,
                                   unsigned iZone, unsigned jZone,
+                                  SU2_MPI::Comm comm,
                                   bool verbose = true);
 
 }
@@ -55,9 +55,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iZone - index of the donor zone.
    * \param[in] jZone - index of the target zone.
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
   CIsoparametric(CGeometry ****geometry_container, const CConfig* const* config,
-                 unsigned int iZone, unsigned int jZone);
+                 unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm = SU2_MPI::GetComm());
 
   /*!
    * \brief Set up transfer matrix defining relation between two meshes
@@ -45,9 +45,11 @@ public:
    * \param[in] interpolator - Transpose interpolator
    * \param[in] iZone - First zone
    * \param[in] jZone - Second zone
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
   CMirror(CGeometry ****geometry_container, const CConfig* const* config,
-          const CInterpolator* interpolator, unsigned int iZone, unsigned int jZone);
+          const CInterpolator* interpolator, unsigned int iZone, unsigned int jZone,
+          SU2_MPI::Comm comm = SU2_MPI::GetComm());
 
   /*!
    * \brief Set up transfer matrix defining relation between two meshes
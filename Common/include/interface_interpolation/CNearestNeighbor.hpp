@@ -30,23 +30,13 @@
 
 /*!
  * \brief Nearest Neighbor(s) interpolation.
- * \note The closest k neighbors are used for IDW interpolation, the computational
- * cost of setting up the interpolation is O(N^2 log(k)), this can be improved
- * by using a kd-tree.
+ * \note The closest k neighbors are used for IDW interpolation, they are found without
+ * gathering the donor points (see CInterpolator::FindNearestDonors).
  */
 class CNearestNeighbor final : public CInterpolator {
 private:
   su2double AvgDistance = 0.0, MaxDistance = 0.0;
 
-  /*! \brief Helper struct to (partially) sort neighbours according to distance while
-   *         keeping track of the origin of the point (i.e. index and processor). */
-  struct DonorInfo {
-    su2double dist;
-    unsigned pidx;
-    int proc;
-    DonorInfo(su2double d = 0.0, unsigned i = 0, int p = 0) : dist(d), pidx(i), proc(p) { }
-  };
-
 public:
   /*!
    * \brief Constructor of the class.
@@ -54,9 +44,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iZone - index of the donor zone.
    * \param[in] jZone - index of the target zone.
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
   CNearestNeighbor(CGeometry ****geometry_container, const CConfig* const* config,
-                   unsigned int iZone, unsigned int jZone);
+                   unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm = SU2_MPI::GetComm());
 
   /*!
    * \brief Set up transfer matrix defining relation between two meshes.
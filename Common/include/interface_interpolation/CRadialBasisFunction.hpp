@@ -46,9 +46,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iZone - index of the donor zone.
    * \param[in] jZone - index of the target zone.
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
   CRadialBasisFunction(CGeometry ****geometry_container, const CConfig* const* config,
-                       unsigned int iZone, unsigned int jZone);
+                       unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm = SU2_MPI::GetComm());
 
   /*!
    * \brief Set up transfer matrix defining relation between two meshes
@@ -99,6 +100,22 @@ public:
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix &P);
 
 private:
+  /*!
+   * \brief Set up the transfer matrix with local interpolations, each target point uses the RBF
+   *        interpolation of its closest donor points (RADIAL_BASIS_FUNCTION_LOCAL_POINTS). This avoids
+   *        the dense generator matrix of all the donor points, and the setup does not gather the donors.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLocalTransferCoeff(const CConfig* const* config);
+
+  /*!
+   * \brief Reduce the interpolation statistics over all ranks and check the interpolation is valid.
+   * \param[in] totalTargetPoints - Number of target points of this rank.
+   * \param[in] totalDonorPoints - Number of donors (i.e. non-zeros) of the target points of this rank.
+   * \param[in] denseSize - Size of the dense interpolation matrix for the target points of this rank.
+   */
+  void FinalizeStatistics(unsigned long totalTargetPoints, unsigned long totalDonorPoints, unsigned long denseSize);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
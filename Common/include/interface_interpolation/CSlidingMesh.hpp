@@ -32,8 +32,38 @@
  * \brief Sliding mesh approach.
  * \note The algorithm is based on Rinaldi et al. "Flux-conserving treatment of non-conformal interfaces
  *       for finite-volume discritization of conservation laws" 2015, Comp. Fluids, 120, pp 126-139
+ * \note The reconstructed boundaries are kept between updates (the surface connectivity does not
+ *       change when the zones slide), only their coordinates are gathered again, and the search for
+ *       the closest donor of each target point starts from the one of the previous update.
  */
 class CSlidingMesh final : public CInterpolator {
+private:
+  /*!
+   * \brief One side of an interface reconstructed on all ranks (see ReconstructBoundary).
+   */
+  struct CBoundaryCache {
+    unsigned long nLocalVertex = 0;   /*!< \brief Number of domain vertices of this rank. */
+    unsigned long nGlobalVertex = 0;  /*!< \brief Number of vertices of the reconstructed boundary. */
+    vector<int> nCoordRank;           /*!< \brief Number of coordinates gathered from each rank. */
+    vector<int> displCoordRank;       /*!< \brief Displacement of the coordinates of each rank. */
+    su2vector<unsigned long> globalPoint, nLinkedNodes, startLinkedNodes, linkedNodes, proc;
+    su2activematrix coord;
+  };
+
+  /*!
+   * \brief Data of a pair of interface markers kept between updates.
+   */
+  struct CInterfaceCache {
+    bool valid = false;
+    CBoundaryCache target, donor;
+    vector<unsigned long> targetIndex;  /*!< \brief Index of each target vertex in the reconstructed target boundary. */
+    vector<unsigned long> startDonor;   /*!< \brief Closest donor of each target vertex at the last update. */
+  };
+  vector<CInterfaceCache> interfaceCache;  /*!< \brief Cached data of each interface. */
+
+  unsigned long periodSteps = 0;  /*!< \brief Time steps per revolution of the relative rotation (0 if not periodic). */
+  vector<vector<vector<CDonorInfo> > > periodicCache;  /*!< \brief Coefficients of each step of one revolution. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -41,9 +71,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iZone - index of the donor zone.
    * \param[in] jZone - index of the target zone.
+   * \param[in] comm - Communicator of the ranks of both zones.
    */
   CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config,
-               unsigned int iZone, unsigned int jZone);
+               unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm = SU2_MPI::GetComm());
 
   /*!
    * \brief Set up transfer matrix defining relation between two meshes
@@ -51,7 +82,43 @@ public:
    */
   void SetTransferCoeff(const CConfig* const* config) override;
 
+  /*!
+   * \brief Get the number of time steps per revolution of the periodic cache (0 if the cache is disabled).
+   */
+  inline unsigned long GetPeriodSteps() const { return periodSteps; }
+
 private:
+  /*!
+   * \brief Number of time steps per revolution of the donor zone relative to the target zone.
+   * \note Only for rigid rotations at constant speed (about a common origin), with an integer number
+   *       of steps per revolution, returns 0 if the cache is not enabled or the motion is not periodic.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long ComputePeriodSteps(const CConfig* const* config) const;
+
+  /*!
+   * \brief Reconstruct one side of the interface, or only gather its coordinates if the cached
+   *        connectivity is still valid.
+   * \param[in] val_zone - Zone of the boundary.
+   * \param[in] val_marker - Marker of the boundary (-1 if not on this rank).
+   * \param[in] reconstruct - Reconstruct the connectivity too.
+   * \param[in,out] boundary - Cached boundary.
+   */
+  void UpdateBoundary(unsigned int val_zone, int val_marker, bool reconstruct, CBoundaryCache& boundary);
+
+  /*!
+   * \brief Find the closest donor point, walking on the donor surface from "start" when possible.
+   * \note Falls back to a brute force search if there is no start point or if the walk stops
+   *       at a point that is not the closest (e.g. non-convex surface).
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] coord - Coordinates of the target point.
+   * \param[in] donor - Reconstructed donor boundary.
+   * \param[in] start - Index of the start point (>= number of donor points to not use it).
+   * \return Index of the closest donor point.
+   */
+  static unsigned long FindClosestDonor(unsigned short nDim, const su2double* coord,
+                                        const CBoundaryCache& donor, unsigned long start);
+
   /*!
    * \brief For 3-Dimensional grids, build the dual surface element
    * \param[in] map         - array containing the index of the boundary points connected to the node
@@ -0,0 +1,282 @@
+/*!
+ * \file CInstanceCoupledOperators.hpp
+ * \brief Matrix-vector product and preconditioner of a linear system that couples
+ *        several instances of the same problem (e.g. the time instances of harmonic
+ *        balance) through a dense operator applied point by point.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include "CMatrixVectorProduct.hpp"
+#include "CPreconditioner.hpp"
+
+/*!
+ * \class CInstanceCoupledOperator
+ * \brief Common part of the operators of the coupled system, maps the vectors of the coupled system
+ *        to the vectors of each instance, which are used with the methods of CSysMatrix.
+ * \note The vectors of the coupled system hold the domain points of all instances, one instance after
+ *       the other, the instances must have the same number of domain points.
+ */
+template<class ScalarType>
+class CInstanceCoupledOperator {
+protected:
+  enum : size_t {OMP_MIN_SIZE = 32};                    /*!< \brief Chunk size for small loops. */
+
+  const std::vector<CSysMatrix<ScalarType>*> matrices; /*!< \brief Matrix of each instance (the diagonal blocks). */
+  const std::vector<CGeometry*> geometries;             /*!< \brief Geometry of each instance. */
+  const CConfig *config;                                /*!< \brief Config of the problem. */
+  const unsigned long nPointDomain;                     /*!< \brief Number of domain points of each instance. */
+  const unsigned long nVar;                             /*!< \brief Number of variables per point. */
+  mutable std::vector<CSysVector<ScalarType> > input;   /*!< \brief Work vector (with halos) of each instance. */
+  mutable std::vector<CSysVector<ScalarType> > output;  /*!< \brief Work vector (with halos) of each instance. */
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrices_ref - Matrix of each instance.
+   * \param[in] geometries_ref - Geometry of each instance.
+   * \param[in] config_ref - Config of the problem.
+   * \param[in] numVar - Number of variables per point.
+   */
+  CInstanceCoupledOperator(const std::vector<CSysMatrix<ScalarType>*>& matrices_ref,
+                           const std::vector<CGeometry*>& geometries_ref,
+                           const CConfig *config_ref, unsigned long numVar) :
+    matrices(matrices_ref),
+    geometries(geometries_ref),
+    config(config_ref),
+    nPointDomain(geometries_ref[0]->GetnPointDomain()),
+    nVar(numVar),
+    input(matrices_ref.size()),
+    output(matrices_ref.size())
+  {
+    if (matrices.size() != geometries.size())
+      SU2_MPI::Error("One geometry per instance is required.", CURRENT_FUNCTION);
+
+    for (auto iInst = 0ul; iInst < matrices.size(); ++iInst) {
+      if (geometries[iInst]->GetnPointDomain() != nPointDomain)
+        SU2_MPI::Error("The instances must have the same number of domain points.", CURRENT_FUNCTION);
+
+      const auto nPoint = geometries[iInst]->GetnPoint();
+      input[iInst].Initialize(nPoint, nPointDomain, nVar, 0.0);
+      output[iInst].Initialize(nPoint, nPointDomain, nVar, 0.0);
+    }
+  }
+
+  /*!
+   * \brief Handle type conversion when copying between the instances and the coupled system,
+   *        preserving derivative information (if supported by types).
+   */
+  template<class DstType, class SrcType, su2enable_if<std::is_arithmetic<DstType>::value> = 0>
+  FORCEINLINE static DstType Assign(const SrcType& val) { return SU2_TYPE::GetValue(val); }
+
+  template<class DstType, class SrcType, su2enable_if<!std::is_arithmetic<DstType>::value> = 0>
+  FORCEINLINE static DstType Assign(const SrcType& val) { return val; }
+
+public:
+  /*!
+   * \brief Copy the block of an instance from the coupled vector, the halos of "inst" are not modified.
+   * \param[in] coupled - Vector of the coupled system.
+   * \param[in] iInst - Index of the instance.
+   * \param[out] inst - Vector of the instance.
+   */
+  template<class T>
+  void GetInstance(const CSysVector<ScalarType>& coupled, unsigned long iInst, CSysVector<T>& inst) const {
+    const auto offset = iInst * nPointDomain * nVar;
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i)
+      inst[i] = Assign<T>(coupled[offset + i]);
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief Copy the domain part of the vector of an instance into its block of the coupled vector.
+   * \param[in] inst - Vector of the instance.
+   * \param[in] iInst - Index of the instance.
+   * \param[out] coupled - Vector of the coupled system.
+   */
+  template<class T>
+  void SetInstance(const CSysVector<T>& inst, unsigned long iInst, CSysVector<ScalarType>& coupled) const {
+    const auto offset = iInst * nPointDomain * nVar;
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i)
+      coupled[offset + i] = Assign<ScalarType>(inst[i]);
+    END_SU2_OMP_FOR
+  }
+};
+
+/*!
+ * \class CInstanceCoupledProduct
+ * \brief Product with the coupled system, the diagonal blocks are the matrices of the instances, block
+ *        (i,j) is the coupling coefficient c_ij times the volume of each point (times the identity).
+ * \note For harmonic balance c is the spectral operator, i.e. the derivative of the source term.
+ */
+template<class ScalarType>
+class CInstanceCoupledProduct final : public CMatrixVectorProduct<ScalarType>,
+                                      public CInstanceCoupledOperator<ScalarType> {
+private:
+  using Base = CInstanceCoupledOperator<ScalarType>;
+  using Base::matrices;
+  using Base::geometries;
+  using Base::config;
+  using Base::nPointDomain;
+  using Base::nVar;
+  using Base::input;
+  using Base::output;
+  using Base::OMP_MIN_SIZE;
+
+  std::vector<ScalarType> coupling;  /*!< \brief Coupling coefficients (row major, nInst x nInst). */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrices_ref - Matrix of each instance.
+   * \param[in] geometries_ref - Geometry of each instance.
+   * \param[in] config_ref - Config of the problem.
+   * \param[in] numVar - Number of variables per point.
+   * \param[in] coeff - Coupling coefficients, coeff[i][j] is the derivative of instance i w.r.t. instance j.
+   */
+  CInstanceCoupledProduct(const std::vector<CSysMatrix<ScalarType>*>& matrices_ref,
+                          const std::vector<CGeometry*>& geometries_ref,
+                          const CConfig *config_ref, unsigned long numVar, const su2double* const* coeff) :
+    Base(matrices_ref, geometries_ref, config_ref, numVar) {
+    SetCoupling(coeff);
+  }
+
+  /*!
+   * \brief Set the coupling coefficients, the matrices of the instances are used by reference.
+   * \param[in] coeff - Coupling coefficients, coeff[i][j] is the derivative of instance i w.r.t. instance j.
+   */
+  void SetCoupling(const su2double* const* coeff) {
+    const auto nInst = matrices.size();
+    coupling.resize(nInst * nInst);
+    for (auto iInst = 0ul; iInst < nInst; ++iInst)
+      for (auto jInst = 0ul; jInst < nInst; ++jInst)
+        coupling[iInst * nInst + jInst] = SU2_TYPE::GetValue(coeff[iInst][jInst]);
+  }
+
+  /*!
+   * \brief Operator that defines the matrix-vector product.
+   * \param[in] u - CSysVector that is being multiplied by the coupled matrix.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+
+    const auto nInst = matrices.size();
+
+    /*--- Diagonal blocks, the halos of the input are needed by the product. ---*/
+
+    for (auto iInst = 0ul; iInst < nInst; ++iInst) {
+      this->GetInstance(u, iInst, input[iInst]);
+      CSysMatrixComms::Initiate(input[iInst], geometries[iInst], config);
+      CSysMatrixComms::Complete(input[iInst], geometries[iInst], config);
+
+      matrices[iInst]->MatrixVectorProduct(input[iInst], output[iInst], geometries[iInst], config);
+      this->SetInstance(output[iInst], iInst, v);
+    }
+
+    /*--- Off-diagonal blocks, point by point. ---*/
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (auto iInst = 0ul; iInst < nInst; ++iInst) {
+        const ScalarType volume = SU2_TYPE::GetValue(geometries[iInst]->nodes->GetVolume(iPoint));
+        const auto i = (iInst * nPointDomain + iPoint) * nVar;
+
+        for (auto jInst = 0ul; jInst < nInst; ++jInst) {
+          const ScalarType c = volume * coupling[iInst * nInst + jInst];
+          if (c == ScalarType(0)) continue;
+          const auto j = (jInst * nPointDomain + iPoint) * nVar;
+
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) v[i + iVar] += c * u[j + iVar];
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+};
+
+/*!
+ * \class CInstanceBlockPreconditioner
+ * \brief Block-diagonal preconditioner of the coupled system, i.e. the preconditioner of each
+ *        instance is applied to its block of the vector.
+ */
+template<class ScalarType>
+class CInstanceBlockPreconditioner final : public CPreconditioner<ScalarType>,
+                                           public CInstanceCoupledOperator<ScalarType> {
+private:
+  using Base = CInstanceCoupledOperator<ScalarType>;
+  using Base::matrices;
+  using Base::geometries;
+  using Base::config;
+  using Base::input;
+  using Base::output;
+
+  std::vector<CPreconditioner<ScalarType>*> preconditioners;  /*!< \brief Preconditioner of each instance. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] kind - Type of preconditioner of the instances.
+   * \param[in] matrices_ref - Matrix of each instance.
+   * \param[in] geometries_ref - Geometry of each instance.
+   * \param[in] config_ref - Config of the problem.
+   * \param[in] numVar - Number of variables per point.
+   */
+  CInstanceBlockPreconditioner(ENUM_LINEAR_SOLVER_PREC kind,
+                               const std::vector<CSysMatrix<ScalarType>*>& matrices_ref,
+                               const std::vector<CGeometry*>& geometries_ref,
+                               const CConfig *config_ref, unsigned long numVar) :
+    Base(matrices_ref, geometries_ref, config_ref, numVar) {
+
+    for (auto iInst = 0ul; iInst < matrices.size(); ++iInst)
+      preconditioners.push_back(CPreconditioner<ScalarType>::Create(kind, *matrices[iInst], geometries[iInst], config));
+  }
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CInstanceBlockPreconditioner() {
+    for (auto prec : preconditioners) delete prec;
+  }
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    for (auto iInst = 0ul; iInst < matrices.size(); ++iInst) {
+      this->GetInstance(u, iInst, input[iInst]);
+      (*preconditioners[iInst])(input[iInst], output[iInst]);
+      this->SetInstance(output[iInst], iInst, v);
+    }
+  }
+
+  /*!
+   * \brief Build the preconditioner of each instance.
+   */
+  inline void Build() override {
+    for (auto prec : preconditioners) prec->Build();
+  }
+};
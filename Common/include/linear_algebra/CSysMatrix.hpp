@@ -185,15 +185,6 @@ private:
 
   } edge_ptr;
 
-  /*!
-   * \brief Handle type conversion for when we Set, Add, etc. blocks, preserving derivative information (if supported by types).
-   */
-  template<class DstType, class SrcType, su2enable_if<std::is_arithmetic<DstType>::value> = 0>
-  FORCEINLINE static DstType ActiveAssign(const SrcType& val) { return SU2_TYPE::GetValue(val); }
-
-  template<class DstType, class SrcType, su2enable_if<!std::is_arithmetic<DstType>::value> = 0>
-  FORCEINLINE static DstType ActiveAssign(const SrcType& val) { return val; }
-
   /*!
    * \brief Handle type conversion for when we Set, Add, etc. blocks, discarding derivative information.
    */
@@ -344,6 +335,15 @@ private:
 
 public:
 
+  /*!
+   * \brief Handle type conversion for when we Set, Add, etc. blocks, preserving derivative information (if supported by types).
+   */
+  template<class DstType, class SrcType, su2enable_if<std::is_arithmetic<DstType>::value> = 0>
+  FORCEINLINE static DstType ActiveAssign(const SrcType& val) { return SU2_TYPE::GetValue(val); }
+
+  template<class DstType, class SrcType, su2enable_if<!std::is_arithmetic<DstType>::value> = 0>
+  FORCEINLINE static DstType ActiveAssign(const SrcType& val) { return val; }
+
   /*!
    * \brief Constructor of the class.
    */
@@ -102,6 +102,7 @@ private:
   LinearToleranceType tol_type = LinearToleranceType::ABSOLUTE; /*!< \brief How the linear solvers interpret the tolerance. */
   bool xIsZero = false;           /*!< \brief If true assume the initial solution is always 0. */
   bool recomputeRes = false;      /*!< \brief Recompute the residual after inner iterations, if monitoring. */
+  bool reusePrecond = false;      /*!< \brief If true the preconditioner is not rebuilt in Solve (the matrix did not change). */
   unsigned long monitorFreq = 10; /*!< \brief Monitoring frequency. */
 
   /*!
@@ -414,6 +415,11 @@ public:
    */
   inline void SetRecomputeResidual(bool recompRes) {recomputeRes = recompRes;}
 
+  /*!
+   * \brief Reuse the preconditioner of the previous call to Solve, the matrix must not have changed.
+   */
+  inline void SetReusePreconditioner(bool reuse) {reusePrecond = reuse;}
+
   /*!
    * \brief Set the screen output frequency during monitoring.
    */
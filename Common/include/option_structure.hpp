@@ -1987,6 +1987,18 @@ static const MapType<std::string, ENUM_DEFORM_STIFFNESS> Deform_Stiffness_Map =
   MakePair("WALL_DISTANCE", SOLID_WALL_DISTANCE)
 };
 
+/*!
+ * \brief Methods for the volumetric mesh deformation.
+ */
+enum class DEFORM_METHOD {
+  ELASTICITY,  /*!< \brief Linear elasticity (FEA). */
+  RBF,         /*!< \brief Radial basis function interpolation of the boundary displacements. */
+};
+static const MapType<std::string, DEFORM_METHOD> Deform_Method_Map = {
+  MakePair("ELASTICITY", DEFORM_METHOD::ELASTICITY)
+  MakePair("RBF", DEFORM_METHOD::RBF)
+};
+
 /*!
  * \brief The direct differentation variables.
  */
@@ -111,6 +111,10 @@ class CBaseMPIWrapper {
 
   static inline int GetSize() { return Size; }
 
+  static inline int GetRank(Comm comm) { int rank; Comm_rank(comm, &rank); return rank; }
+
+  static inline int GetSize(Comm comm) { int size; Comm_size(comm, &size); return size; }
+
   static inline void SetComm(Comm newComm) {
     currentComm = newComm;
     MPI_Comm_rank(currentComm, &Rank);
@@ -148,6 +152,12 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { MPI_Comm_size(comm, size); }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) {
+    MPI_Comm_split(comm, color, key, newcomm);
+  }
+
+  static inline void Comm_free(Comm* comm) { MPI_Comm_free(comm); }
+
   static inline void Finalize() {
     if (winMinRankErrorInUse) MPI_Win_free(&winMinRankError);
     MPI_Finalize();
@@ -481,6 +491,7 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
 #define MPI_INT 11
 #define MPI_PROD 12
 #define MPI_STATUS_IGNORE nullptr
+#define MPI_STATUSES_IGNORE nullptr
 
 /*!
  * \class CMPIWrapper
@@ -512,6 +523,10 @@ class CBaseMPIWrapper {
 
   static inline int GetSize() { return Size; }
 
+  static inline int GetRank(Comm comm) { int rank; Comm_rank(comm, &rank); return rank; }
+
+  static inline int GetSize(Comm comm) { int size; Comm_size(comm, &size); return size; }
+
   static inline void SetComm(Comm newComm) { currentComm = newComm; }
 
   static inline Comm GetComm() { return currentComm; }
@@ -528,6 +543,10 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { *size = 1; }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) { *newcomm = comm; }
+
+  static inline void Comm_free(Comm* comm) {}
+
   static inline void Finalize() {}
 
   static inline void Isend(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
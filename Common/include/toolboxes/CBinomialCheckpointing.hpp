@@ -0,0 +1,165 @@
+/*!
+ * \file CBinomialCheckpointing.hpp
+ * \brief Online binomial checkpointing schedule (and checkpoint storage) for
+ * the reverse sweep of time-marching problems, e.g. the unsteady adjoint.
+ * \note Based on the "revolve" schedule, see DOI 10.1145/347837.347846.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <limits>
+#include "../basic_types/datatype_structure.hpp"
+
+/*!
+ * \class CBinomialCheckpointing
+ * \brief Keeps a fixed number of checkpoints (states of time steps) and decides where they
+ * should be taken such that the states of a reverse sweep are recomputed with the minimum
+ * number of forward steps.
+ * \note The state of the step before "first" (the base) is assumed to always be available
+ * (e.g. from a file or the initial condition). States are requested in decreasing order,
+ * therefore checkpoints after the requested step are recycled. Usage: find the checkpoint
+ * closest to the requested step ("Latest"), restore it, then advance to the next step given
+ * by "NextCheckpoint", "Store" the state there, and so on until the requested step is reached.
+ */
+class CBinomialCheckpointing {
+public:
+  using Index = unsigned long;
+  enum : long {EMPTY = std::numeric_limits<long>::max()}; /*!< \brief Step of an unused checkpoint. */
+
+private:
+  long first = 0;                                  /*!< \brief First step that can be recomputed. */
+  std::vector<long> steps;                         /*!< \brief Step held by each checkpoint. */
+  std::vector<std::vector<passivedouble> > data;   /*!< \brief Stored states. */
+
+public:
+  /*!
+   * \brief Minimum number of forward steps to reverse nSteps steps with nSnaps checkpoints,
+   * including the one at the start (closed form from Griewank and Walther, with the
+   * binomial coefficients beta(c,t) = (c+t)!/(c!t!)).
+   */
+  static unsigned long long Cost(Index nSnaps, Index nSteps) {
+    if (nSteps <= 1) return 0;
+    if (nSnaps <= 1) return (nSteps*(nSteps-1)) / 2;
+    Index t = 0;
+    unsigned long long b = 1;
+    while (b < nSteps) { ++t; b = (b * (nSnaps+t)) / t; }
+    /*--- beta(c+1,t-1) = beta(c,t) * t / (c+1) ---*/
+    return t*nSteps - (b * t) / (nSnaps+1);
+  }
+
+  /*!
+   * \brief Allocate the checkpoints.
+   * \param[in] nCheckpoints - Number of checkpoints, not including the base.
+   * \param[in] firstStep - First step that can be recomputed.
+   */
+  void Initialize(Index nCheckpoints, long firstStep) {
+    first = firstStep;
+    steps.assign(nCheckpoints, EMPTY);
+    data.clear();
+    data.resize(nCheckpoints);
+  }
+
+  /*!
+   * \brief Number of checkpoints.
+   */
+  Index size() const { return steps.size(); }
+
+  /*!
+   * \brief First step that can be recomputed (the base is first-1).
+   */
+  long GetFirst() const { return first; }
+
+  /*!
+   * \brief Find the most recent checkpoint not after "target".
+   * \return Checkpoint index, or -1 if the base should be used.
+   */
+  int Latest(long target) const {
+    int best = -1;
+    long bestStep = first-1;
+    for (Index i = 0; i < steps.size(); ++i) {
+      if (steps[i] > bestStep && steps[i] <= target) {
+        best = i;
+        bestStep = steps[i];
+      }
+    }
+    return best;
+  }
+
+  /*!
+   * \brief Step held by a checkpoint (the base step for -1).
+   */
+  long GetStep(int iCheck) const { return (iCheck < 0)? first-1 : steps[iCheck]; }
+
+  /*!
+   * \brief Access the state stored by a checkpoint.
+   */
+  std::vector<passivedouble>& GetData(int iCheck) { return data[iCheck]; }
+
+  /*!
+   * \brief Number of checkpoints that can be (re)used to reach "target".
+   */
+  Index FreeCheckpoints(long target) const {
+    Index n = 0;
+    for (auto step : steps) n += (step > target);
+    return n;
+  }
+
+  /*!
+   * \brief Step at which the next checkpoint should be taken when advancing from "current" to "target".
+   * \return "target" if no more checkpoints should be taken.
+   */
+  long NextCheckpoint(long current, long target) const {
+    const Index nSteps = target - current + 1;
+    const Index nSnaps = FreeCheckpoints(target) + 1;
+    if (nSnaps < 2 || nSteps < 3) return target;
+
+    /*--- Split the interval such that the cost of the right part, with one less checkpoint,
+     * plus the cost of the left part, with all current checkpoints, is minimum. ---*/
+    Index bestSplit = nSteps-1;
+    auto bestCost = std::numeric_limits<unsigned long long>::max();
+    for (Index m = 1; m < nSteps; ++m) {
+      const auto cost = m + Cost(nSnaps-1, nSteps-m) + Cost(nSnaps, m);
+      if (cost < bestCost) {
+        bestCost = cost;
+        bestSplit = m;
+      }
+    }
+    return (bestSplit == nSteps-1)? target : current + bestSplit;
+  }
+
+  /*!
+   * \brief Assign a free checkpoint to "step".
+   * \return Index of the checkpoint whose data should be set.
+   */
+  int Store(long step, long target) {
+    for (Index i = 0; i < steps.size(); ++i) {
+      if (steps[i] > target) {
+        steps[i] = step;
+        return i;
+      }
+    }
+    return -1;
+  }
+};
@@ -507,6 +507,34 @@ T createNaturalColoring(Index_t numInnerIndexes)
 }
 
 
+/*!
+ * \brief Build the pattern of the closed neighborhoods (the point itself and its neighbors)
+ *        of the first numPoints outer indices of an adjacency pattern.
+ * \note  Coloring this pattern gives points that do not have neighbors in common within
+ *        each color, i.e. loops over the neighbors of those points share no data.
+ * \param[in] adjacency - Neighbors of each point.
+ * \param[in] numPoints - Number of points (outer indices) to consider.
+ * \return Sparse pattern with numPoints outer indices.
+ */
+template<typename Index_t>
+CCompressedSparsePattern<Index_t> buildClosedNeighborhoodPattern(const CCompressedSparsePattern<Index_t>& adjacency,
+                                                                 Index_t numPoints)
+{
+  su2vector<Index_t> outerPtr(numPoints+1);
+  su2vector<Index_t> innerIdx(numPoints + adjacency.outerPtr()[numPoints]);
+
+  Index_t k = 0;
+  for (Index_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+    outerPtr(iPoint) = k;
+    innerIdx(k++) = iPoint;
+    for (auto jPoint : adjacency.getInnerIter(iPoint)) innerIdx(k++) = jPoint;
+  }
+  outerPtr(numPoints) = k;
+
+  return CCompressedSparsePattern<Index_t>(std::move(outerPtr), std::move(innerIdx));
+}
+
+
 /*!
  * \brief Color contiguous groups of outer indices of a sparse pattern such that
  *        within each color, any two groups do not have inner indices in common.
@@ -667,6 +695,20 @@ struct GridColor
 };
 
 
+/*!
+ * \brief A grid color that represents the natural coloring {0,1,2,...,size-1}
+ * when it has no indices, to decide at runtime if a loop should be colored.
+ */
+template<typename T = unsigned long>
+struct OptionalGridColor : public GridColor<T>
+{
+  OptionalGridColor(const T* idx = nullptr, T sz = 0, T grp = 1) :
+    GridColor<T>(idx, sz, grp) { }
+
+  inline T operator[] (T i) const {return this->indices? this->indices[i] : i;}
+};
+
+
 /*!
  * \brief A way to represent natural coloring {0,1,2,...,size-1} with zero
  * overhead (behaves like looping with an integer index, after optimization...).
@@ -235,8 +235,8 @@ struct Nd_MPI_Environment {
         comm(comm),
         MPI_Allgather_fun(MPI_Allgather_fun),
         MPI_Allgatherv_fun(MPI_Allgatherv_fun),
-        rank(SU2_MPI::GetRank()),
-        size(SU2_MPI::GetSize()) {}
+        rank(SU2_MPI::GetRank(comm)),
+        size(SU2_MPI::GetSize(comm)) {}
 };
 
 namespace helpers {
@@ -265,6 +265,7 @@ void CConfig::Init(){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
+  SU2_Communicator = SU2_MPI::GetComm();
 
   /*--- Initialize pointers to Null---*/
 
@@ -781,6 +782,40 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
   return (unsigned short) nDim;
 }
 
+unsigned long CConfig::GetnElem(string val_mesh_filename, unsigned short val_format, unsigned short val_iZone) {
+
+  unsigned long nElem = 0;
+
+  /*--- Only the native format has a header that can be scanned cheaply. ---*/
+  if (val_format != SU2) return nElem;
+
+  string text_line;
+  ifstream mesh_file;
+
+  mesh_file.open(val_mesh_filename.c_str(), ios::in);
+  if (mesh_file.fail()) return nElem;
+
+  /*--- Files without the IZONE keyword contain a single zone. ---*/
+  unsigned short jZone = 1;
+
+  while( getline (mesh_file, text_line) ) {
+
+    if(text_line.find ("IZONE=",0) != string::npos) {
+      text_line.erase (0,6); jZone = atoi(text_line.c_str());
+      continue;
+    }
+
+    if((jZone == val_iZone+1) && (text_line.find ("NELEM=",0) != string::npos)) {
+      text_line.erase (0,6); nElem = atol(text_line.c_str());
+      break;
+    }
+  }
+
+  mesh_file.close();
+
+  return nElem;
+}
+
 void CConfig::SetPointersNull(void) {
 
   Marker_CfgFile_GeoEval      = nullptr;   Marker_All_GeoEval       = nullptr;
@@ -816,6 +851,7 @@ void CConfig::SetPointersNull(void) {
   Kind_Wall                = nullptr;
 
   Config_Filenames = nullptr;
+  Zone_CostWeights = nullptr;
 
   /*--- Marker Pointers ---*/
 
@@ -934,6 +970,8 @@ void CConfig::SetPointersNull(void) {
   Kind_Inc_Inlet = nullptr;
   Kind_Inc_Outlet = nullptr;
 
+  DirectDiff_List = nullptr;
+
   Kind_ObjFunc   = nullptr;
 
   Weight_ObjFunc = nullptr;
@@ -1646,8 +1684,26 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("HB_PERIOD", HarmonicBalance_Period, -1.0);
   /* DESCRIPTION:  Turn on/off harmonic balance preconditioning */
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
+  /* DESCRIPTION: Number of groups of ranks that solve the harmonic balance instances concurrently */
+  addUnsignedShortOption("HB_INSTANCE_GROUPS", HB_InstanceGroups, 1);
+  /* DESCRIPTION: Solve the implicit systems of all harmonic balance instances as one coupled system */
+  addBoolOption("HB_COUPLED_IMPLICIT", HB_CoupledImplicit, false);
+  /* DESCRIPTION: Number of time slices solved concurrently on groups of ranks by the parareal driver */
+  addUnsignedShortOption("PARAREAL_TIME_SLICES", Parareal_TimeSlices, 1);
+  /* DESCRIPTION: Number of time steps of the coarse propagator in each time slice */
+  addUnsignedLongOption("PARAREAL_COARSE_STEPS", Parareal_CoarseSteps, 1);
+  /* DESCRIPTION: Maximum number of parareal iterations (at most the number of time slices are used) */
+  addUnsignedLongOption("PARAREAL_ITER", Parareal_Iter, 2);
+  /* DESCRIPTION: Tolerance on the relative change of the time slice states between parareal iterations */
+  addDoubleOption("PARAREAL_TOL", Parareal_Tol, 1e-6);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Number of primal checkpoints kept in memory for the unsteady discrete adjoint, 0 reads every time step from file */
+  addUnsignedLongOption("UNST_ADJOINT_CHECKPOINTS", Unst_AdjointCheckpoints, 0);
+  /* DESCRIPTION: First time step recomputed from checkpoints (the two previous ones are read from file) */
+  addLongOption("UNST_ADJOINT_CHECKPOINT_START", Unst_AdjointCheckpointStart, 0);
+  /* DESCRIPTION: Inner iterations of the recomputed primal time steps (0 uses INNER_ITER) */
+  addUnsignedLongOption("UNST_ADJOINT_PRIMAL_ITER", Unst_AdjointPrimalIter, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Time discretization */
@@ -1720,6 +1776,8 @@ void CConfig::SetConfig_Options() {
   addEnumOption("DISCADJ_LIN_SOLVER", Kind_DiscAdj_Linear_Solver, Linear_Solver_Map, FGMRES);
   /* DESCRIPTION: Preconditioner for the discrete adjoint Krylov linear solvers */
   addEnumOption("DISCADJ_LIN_PREC", Kind_DiscAdj_Linear_Prec, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Warm start the discrete adjoint by solving the transposed primal Jacobian system (the tape-based iterations still follow) */
+  addBoolOption("DISCADJ_JACOBIAN_GUESS", DiscAdj_JacobianGuess, false);
   /* DESCRIPTION: Linear solver for the discete adjoint systems */
 
   /*!\par CONFIG_CATEGORY: Convergence\ingroup Config*/
@@ -1768,6 +1826,10 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_INTERFACE_AGGLOMERATION\n DESCRIPTION: Agglomerate the multigrid levels independently of the partitioning, the coarse control volumes are kept on one rank. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_INTERFACE_AGGLOMERATION", MG_InterfaceAgglomeration, false);
+  /*!\brief MG_TURB\n DESCRIPTION: Solve the turbulence equations with the multigrid (FAS) cycle of the flow equations, instead of only on the fine grid. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_TURB", MG_Turb, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1778,6 +1840,12 @@ void CConfig::SetConfig_Options() {
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients used only for upwind reconstruction \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: NO_GRADIENT. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD_RECON", Kind_Gradient_Method_Recon, Gradient_Map, NO_GRADIENT);
+  /*!\brief EDGE_BASED_GRADIENTS
+   *  \n DESCRIPTION: Compute Green-Gauss and least-squares gradients with a loop over edges (colored, vectorized) instead of points. DEFAULT: NO \ingroup Config*/
+  addBoolOption("EDGE_BASED_GRADIENTS", EdgeBasedGradients, false);
+  /*!\brief PRECOMPUTE_LS_WEIGHTS
+   *  \n DESCRIPTION: Store the (inverted) least-squares weights of each point-neighbor pair, the gradients then become a sparse matrix-vector product. DEFAULT: NO \ingroup Config*/
+  addBoolOption("PRECOMPUTE_LS_WEIGHTS", PrecomputeLSWeights, false);
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
@@ -1801,6 +1869,8 @@ void CConfig::SetConfig_Options() {
   /*!\brief SLOPE_LIMITER_FLOW
    * DESCRIPTION: Slope limiter for the direct solution. \n OPTIONS: See \link Limiter_Map \endlink \n DEFAULT VENKATAKRISHNAN \ingroup Config*/
   addEnumOption("SLOPE_LIMITER_FLOW", Kind_SlopeLimit_Flow, Limiter_Map, VENKATAKRISHNAN);
+  /*!\brief FUSED_LIMITER_FLOW \n DESCRIPTION: Compute the reconstruction gradient and the slope limiter of the flow equations in a single sweep over the grid points. DEFAULT: NO \ingroup Config*/
+  addBoolOption("FUSED_LIMITER_FLOW", FusedLimiter_Flow, false);
   jst_coeff[0] = 0.5; jst_coeff[1] = 0.02;
   /*!\brief JST_SENSOR_COEFF \n DESCRIPTION: 2nd and 4th order artificial dissipation coefficients for the JST method \ingroup Config*/
   addDoubleArrayOption("JST_SENSOR_COEFF", 2, jst_coeff);
@@ -2176,6 +2246,11 @@ void CConfig::SetConfig_Options() {
   addBoolOption("DEFORM_MESH", Deform_Mesh, false);
   /* DESCRIPTION: Print the residuals during mesh deformation to the console */
   addBoolOption("DEFORM_CONSOLE_OUTPUT", Deform_Output, false);
+  /* DESCRIPTION: Reuse the stiffness matrix and preconditioner when the same grid is deformed again within
+   *              one process (the convexity check of SU2_DEF), and use the previous displacements as the initial guess. */
+  addBoolOption("DEFORM_REUSE_SYSTEM", Deform_ReuseSystem, false);
+  /* DESCRIPTION: Cache the element stiffness matrices, only elements that moved are recomputed during assembly */
+  addBoolOption("DEFORM_CACHE_STIFFNESS", Deform_CacheStiffness, false);
   /* DESCRIPTION: Number of nonlinear deformation iterations (surface deformation increments) */
   addUnsignedLongOption("DEFORM_NONLINEAR_ITER", GridDef_Nonlinear_Iter, 1);
   /* DESCRIPTION: Deform coefficient (-1.0 to 0.5) */
@@ -2184,6 +2259,14 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_LIMIT", Deform_Limit, 1E6);
   /* DESCRIPTION: Type of element stiffness imposed for FEA mesh deformation (INVERSE_VOLUME, WALL_DISTANCE, CONSTANT_STIFFNESS) */
   addEnumOption("DEFORM_STIFFNESS_TYPE", Deform_StiffnessType, Deform_Stiffness_Map, SOLID_WALL_DISTANCE);
+  /* DESCRIPTION: Method of the volumetric mesh deformation (ELASTICITY, RBF) */
+  addEnumOption("DEFORM_METHOD", Deform_Method, Deform_Method_Map, DEFORM_METHOD::ELASTICITY);
+  /* DESCRIPTION: Support radius of the (Wendland C2) RBF mesh deformation, 0 for automatic */
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 0.0);
+  /* DESCRIPTION: Tolerance of the greedy selection of RBF control points, relative to the largest displacement */
+  addDoubleOption("DEFORM_RBF_TOLERANCE", Deform_RBF_Tolerance, 1E-3);
+  /* DESCRIPTION: Maximum number of RBF control points */
+  addUnsignedLongOption("DEFORM_RBF_MAX_POINTS", Deform_RBF_MaxPoints, 2000);
   /* DESCRIPTION: Poisson's ratio for constant stiffness FEA method of grid deformation */
   addDoubleOption("DEFORM_ELASTICITY_MODULUS", Deform_ElasticityMod, 2E11);
   /* DESCRIPTION: Young's modulus and Poisson's ratio for constant stiffness FEA method of grid deformation */
@@ -2371,6 +2454,10 @@ void CConfig::SetConfig_Options() {
 
   /*!\brief MARKER_PLOTTING\n DESCRIPTION: Marker(s) of the surface in the surface flow solution file  \ingroup Config*/
   addStringListOption("CONFIG_LIST", nConfig_Files, Config_Filenames);
+  /* DESCRIPTION: Solve the zones concurrently, each on its own group of ranks (only with MULTIZONE_SOLVER= BLOCK_JACOBI). */
+  addBoolOption("CONCURRENT_ZONES", Concurrent_Zones, false);
+  /* DESCRIPTION: Relative cost of each zone, the ranks are distributed in proportion to it (default: number of elements). */
+  addDoubleListOption("ZONE_COST_WEIGHTS", nZone_CostWeights, Zone_CostWeights);
 
   /* DESCRIPTION: Determines if the multizone problem is solved for time-domain. */
   addBoolOption("TIME_DOMAIN", Time_Domain, false);
@@ -2429,6 +2516,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Number of donor points of the local RBF stencil of each target point, 0 for global interpolation. */
+  addUnsignedLongOption("RADIAL_BASIS_FUNCTION_LOCAL_POINTS", RadialBasisFunction_LocalPoints, 0);
+
+  /* DESCRIPTION: Store the sliding mesh coefficients of one revolution (constant speed rotation) and reuse them. */
+  addBoolOption("SLIDING_MESH_PERIODIC_CACHE", SlidingMesh_PeriodicCache, false);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2496,6 +2589,8 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: CHT interface coupling methods */
   /*  Options: NO, YES \ingroup Config */
   addEnumOption("CHT_COUPLING_METHOD", Kind_CHT_Coupling, CHT_Coupling_Map, CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX);
+  /* DESCRIPTION: Solid zones of CHT problems without pseudo time stepping, the coupling stays partitioned (Robin only) */
+  addBoolOption("CHT_SOLID_NO_PSEUDO_TIME", CHT_SolidNoPseudoTime, false);
 
   /*!\par CONFIG_CATEGORY: Visualize Control Volumes \ingroup Config*/
   /*--- options related to visualizing control volumes ---*/
@@ -2586,8 +2681,9 @@ void CConfig::SetConfig_Options() {
   /*--- Options for the automatic differentiation methods ---*/
   /*!\par CONFIG_CATEGORY: Automatic Differentation options\ingroup Config*/
 
-  /* DESCRIPTION: Direct differentiation mode (forward) */
-  addEnumOption("DIRECT_DIFF", DirectDiff, DirectDiff_Var_Map, NO_DERIVATIVE);
+  /* DESCRIPTION: Direct differentiation mode (forward), list of variables, one per tangent direction */
+  addEnumListOption("DIRECT_DIFF", nDirectDiff, DirectDiff_List, DirectDiff_Var_Map);
+  DirectDiff = NO_DERIVATIVE;
 
   /* DESCRIPTION: Automatic differentiation mode (reverse) */
   addBoolOption("AUTO_DIFF", AD_Mode, NO);
@@ -2595,6 +2691,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Preaccumulation in the AD mode. */
   addBoolOption("PREACC", AD_Preaccumulation, YES);
 
+  /* DESCRIPTION: Record the (linear) gradient computations as external functions with a hand-written reverse mode. */
+  addBoolOption("AD_EXTERNAL_GRADIENTS", AD_ExternalGradients, false);
+
   /*--- options that are used in the python optimization scripts. These have no effect on the c++ toolsuite ---*/
   /*!\par CONFIG_CATEGORY:Python Options\ingroup Config*/
 
@@ -3219,6 +3318,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     Multizone_Problem = YES;
   }
 
+  /*--- The first direct differentiation variable determines the mode, the others are extra tangent directions. ---*/
+  if (nDirectDiff > 0) DirectDiff = DirectDiff_List[0];
+  for (unsigned short iDir = 0; (nDirectDiff > 1) && (iDir < nDirectDiff); iDir++) {
+    if (DirectDiff_List[iDir] == NO_DERIVATIVE) {
+      SU2_MPI::Error("DIRECT_DIFF: NONE cannot be combined with other variables.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- Set the default output files ---*/
   if (!OptionIsSet("OUTPUT_FILES")){
     nVolumeOutputFiles = 3;
@@ -3492,6 +3599,11 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
 
     if (Time_Step <= 0.0 && Unst_CFL == 0.0){ SU2_MPI::Error("Invalid value for TIME_STEP.", CURRENT_FUNCTION); }
+
+    /*--- The cached sliding mesh coefficients are indexed by time step, the rotation per step must be constant. ---*/
+    if (SlidingMesh_PeriodicCache && Unst_CFL != 0.0) {
+      SU2_MPI::Error("SLIDING_MESH_PERIODIC_CACHE requires a constant TIME_STEP (UNST_CFL_NUMBER= 0).", CURRENT_FUNCTION);
+    }
   } else {
     nTimeIter = 1;
     Time_Step = 0;
@@ -3513,6 +3625,10 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if ((ContinuousAdjoint && !MG_AdjointFlow) ||
       (TimeMarching == TIME_MARCHING::TIME_STEPPING)) { nMGLevels = 0; }
 
+  /*--- The turbulence multigrid is only available for the (fine grid) primal problem. ---*/
+
+  if (ContinuousAdjoint || nMGLevels == 0) MG_Turb = false;
+
   if (Kind_Solver == EULER ||
       Kind_Solver == NAVIER_STOKES ||
       Kind_Solver == RANS ||
@@ -3588,6 +3704,11 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     SU2_MPI::Error("Only STANDARD_AIR fluid model can be used with US Measurement System", CURRENT_FUNCTION);
   }
 
+  if (FusedLimiter_Flow && (Kind_Solver == NEMO_EULER || Kind_Solver == NEMO_NAVIER_STOKES)) {
+    SU2_MPI::Error("FUSED_LIMITER_FLOW is not available for the NEMO solvers, their gradients are computed\n"
+                   "from auxiliary primitive variables that the limiter does not use.", CURRENT_FUNCTION);
+  }
+
   if (Kind_FluidModel == SU2_NONEQ && Kind_TransCoeffModel != TRANSCOEFFMODEL::WILKE ) {
     SU2_MPI::Error("Only WILKE transport model is stable for the NEMO solver using SU2TClib. Use Mutation++ instead.", CURRENT_FUNCTION);
   }
@@ -3813,6 +3934,36 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
         SU2_MPI::Error("Length of omega_HB  must match the number TIME_INSTANCES!!" , CURRENT_FUNCTION);
       }
     }
+
+    /*--- The coupled system is solved by the driver, on the fine grid, and with all instances on all ranks. ---*/
+    if (HB_CoupledImplicit) {
+      if (ContinuousAdjoint || DiscreteAdjoint || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT))
+        SU2_MPI::Error("HB_COUPLED_IMPLICIT requires the direct problem with TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+      if (nMGLevels != 0)
+        SU2_MPI::Error("HB_COUPLED_IMPLICIT requires MGLEVEL= 0.", CURRENT_FUNCTION);
+      if (HB_Precondition)
+        SU2_MPI::Error("HB_COUPLED_IMPLICIT and HB_PRECONDITION cannot be used together.", CURRENT_FUNCTION);
+      if (HB_InstanceGroups != 1)
+        SU2_MPI::Error("HB_COUPLED_IMPLICIT requires HB_INSTANCE_GROUPS= 1.", CURRENT_FUNCTION);
+      if ((Kind_Linear_Solver != FGMRES) && (Kind_Linear_Solver != RESTARTED_FGMRES) && (Kind_Linear_Solver != BCGSTAB))
+        SU2_MPI::Error("HB_COUPLED_IMPLICIT requires LINEAR_SOLVER= FGMRES, RESTARTED_FGMRES, or BCGSTAB.", CURRENT_FUNCTION);
+    }
+  }
+  else {
+    HB_CoupledImplicit = false;
+  }
+
+  /*--- Without pseudo time stepping the solid needs the linearization of the heat flux of the fluid (Robin coupling),
+   *    without it the solid system is singular when the interface is its only thermal boundary condition. ---*/
+  if (CHT_SolidNoPseudoTime) {
+    if ((Kind_CHT_Coupling != CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) &&
+        (Kind_CHT_Coupling != CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX))
+      SU2_MPI::Error("CHT_SOLID_NO_PSEUDO_TIME requires CHT_COUPLING_METHOD= DIRECT_TEMPERATURE_ROBIN_HEATFLUX\n"
+                     "or AVERAGED_TEMPERATURE_ROBIN_HEATFLUX.", CURRENT_FUNCTION);
+    if (GetHeatProblem() && (Kind_TimeIntScheme_Heat != EULER_IMPLICIT))
+      SU2_MPI::Error("CHT_SOLID_NO_PSEUDO_TIME requires TIME_DISCRE_HEAT= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (GetHeatProblem() && (nMarker_CHTInterface == 0))
+      SU2_MPI::Error("CHT_SOLID_NO_PSEUDO_TIME requires a MARKER_CHT_INTERFACE in the solid zones.", CURRENT_FUNCTION);
   }
 
   /*--- Force number of span-wise section to 1 if 2D case ---*/
@@ -4444,6 +4595,15 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (Fixed_CL_Mode) Update_AoA = false;
   if (Fixed_CM_Mode) Update_HTPIncidence = false;
 
+  /*--- The RBF deformation is computed with passive values, its derivatives would be silently lost. ---*/
+
+  if ((Deform_Method == DEFORM_METHOD::RBF) &&
+      ((Kind_SU2 == SU2_COMPONENT::SU2_DOT) || DiscreteAdjoint || (DirectDiff != NO_DERIVATIVE))) {
+    SU2_MPI::Error("DEFORM_METHOD= RBF does not support the differentiation of the mesh deformation,\n"
+                   "use DEFORM_METHOD= ELASTICITY with discrete adjoints, direct differentiation, or the gradient projection.",
+                   CURRENT_FUNCTION);
+  }
+
   if (DirectDiff != NO_DERIVATIVE) {
 #ifndef CODI_FORWARD_TYPE
     if (Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
@@ -4452,27 +4612,42 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                      CURRENT_FUNCTION);
     }
 #endif
+    if (Kind_SU2 == SU2_COMPONENT::SU2_CFD && nDirectDiff > SU2_TYPE::nDirections) {
+      SU2_MPI::Error("SU2_CFD: DIRECT_DIFF lists more variables than the tangent directions of the AD type.\n"
+                     "Please compile with more directions (meson.py ... -Dcodi-forward-dirs=N ...).",
+                     CURRENT_FUNCTION);
+    }
+    /*--- Several tangent directions are only supported for the freestream (flow) variables,
+     * with DESIGN_VARIABLES each non-zero DV_VALUE is assigned its own direction. ---*/
+    for (unsigned short iDir = 0; (nDirectDiff > 1) && (iDir < nDirectDiff); iDir++) {
+      if (DirectDiff_List[iDir] == D_DESIGN || DirectDiff_List[iDir] >= D_YOUNG) {
+        SU2_MPI::Error("DIRECT_DIFF: Only flow variables (e.g. MACH, AOA, PRESSURE) can be combined.",
+                       CURRENT_FUNCTION);
+      }
+    }
     /*--- Initialize the derivative values ---*/
-    switch (DirectDiff) {
-      case D_MACH:
-        SU2_TYPE::SetDerivative(Mach, 1.0);
-        break;
-      case D_AOA:
-        SU2_TYPE::SetDerivative(AoA, 1.0);
-        break;
-      case D_SIDESLIP:
-        SU2_TYPE::SetDerivative(AoS, 1.0);
-        break;
-      case D_REYNOLDS:
-        SU2_TYPE::SetDerivative(Reynolds, 1.0);
-        break;
-      case D_TURB2LAM:
-       SU2_TYPE::SetDerivative(Turb2LamViscRatio_FreeStream, 1.0);
-        break;
-      default:
-        /*--- All other cases are handled in the specific solver ---*/
-        break;
+    for (unsigned short iDir = 0; iDir < nDirectDiff; iDir++) {
+      switch (DirectDiff_List[iDir]) {
+        case D_MACH:
+          SU2_TYPE::SetDerivative(Mach, 1.0, iDir);
+          break;
+        case D_AOA:
+          SU2_TYPE::SetDerivative(AoA, 1.0, iDir);
+          break;
+        case D_SIDESLIP:
+          SU2_TYPE::SetDerivative(AoS, 1.0, iDir);
+          break;
+        case D_REYNOLDS:
+          SU2_TYPE::SetDerivative(Reynolds, 1.0, iDir);
+          break;
+        case D_TURB2LAM:
+          SU2_TYPE::SetDerivative(Turb2LamViscRatio_FreeStream, 1.0, iDir);
+          break;
+        default:
+          /*--- All other cases are handled in the specific solver ---*/
+          break;
       }
+    }
   }
 
 #if defined CODI_REVERSE_TYPE
@@ -4896,6 +5071,12 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
 #endif
 
+    /*--- Stored least-squares weights would not carry the sensitivities w.r.t. the coordinates. ---*/
+    PrecomputeLSWeights = false;
+
+    /*--- The primal is recorded on the fine grid only. ---*/
+    MG_Turb = false;
+
     /*--- Use the same linear solver on the primal as the one used in the adjoint. ---*/
     Kind_Linear_Solver = Kind_DiscAdj_Linear_Solver;
     Kind_Linear_Solver_Prec = Kind_DiscAdj_Linear_Prec;
@@ -4916,6 +5097,32 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
         Iter_Avg_Objective = nTimeIter;
       }
 
+      if (Unst_AdjointCheckpoints > 0) {
+        if (Multizone_Problem || GetDynamic_Grid()) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS is only available for single zone problems on fixed grids.", CURRENT_FUNCTION);
+        }
+        if (TimeMarching != TIME_MARCHING::DT_STEPPING_1ST && TimeMarching != TIME_MARCHING::DT_STEPPING_2ND) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS requires dual time stepping.", CURRENT_FUNCTION);
+        }
+        /*--- The recomputed primal would skip the turbulence model and differ from the stored forward state. ---*/
+        if (Frozen_Visc_Disc && (Kind_Turb_Model != NONE)) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS is not compatible with FROZEN_VISC_DISC= YES.", CURRENT_FUNCTION);
+        }
+        if (Unst_AdjointPrimalIter == 0) Unst_AdjointPrimalIter = nInnerIter;
+      }
+
+    }
+
+    if (DiscAdj_JacobianGuess) {
+      if (Time_Domain || Multizone_Problem ||
+          ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS))) {
+        SU2_MPI::Error("DISCADJ_JACOBIAN_GUESS is only available for steady single-zone compressible flow.", CURRENT_FUNCTION);
+      }
+      if ((Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || (nMGLevels != 0) || Low_Mach_Precon ||
+          (Kind_Upwind_Flow == TURKEL) || isPastix(Kind_DiscAdj_Linear_Solver)) {
+        SU2_MPI::Error("DISCADJ_JACOBIAN_GUESS requires TIME_DISCRE_FLOW= EULER_IMPLICIT without multigrid,\n"
+                       "low-Mach preconditioning, or direct linear solvers.", CURRENT_FUNCTION);
+      }
     }
 
     /*--- Note that this is deliberatly done at the end of this routine! ---*/
@@ -7482,6 +7689,8 @@ CConfig::~CConfig(void) {
   delete [] RefOriginMoment_Y;
   delete [] RefOriginMoment_Z;
 
+  delete [] Zone_CostWeights;
+
   /*--- Free memory for Harmonic Blance Frequency  pointer ---*/
 
   delete [] Omega_HB;
@@ -7556,6 +7765,7 @@ CConfig::~CConfig(void) {
   delete[] Marker_All_SendRecv;
 
   delete[] Kind_Inc_Inlet;
+  delete[] DirectDiff_List;
   delete[] Kind_Inc_Outlet;
 
   delete[] Kind_WallFunctions;
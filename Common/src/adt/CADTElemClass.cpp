@@ -40,7 +40,8 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
                              vector<unsigned short> &val_VTKElem,
                              vector<unsigned short> &val_markerID,
                              vector<unsigned long>  &val_elemID,
-                             const bool             globalTree) {
+                             const bool             globalTree,
+                             SU2_MPI::Comm          comm) {
 
   /* Copy the dimension of the problem into nDim. */
   nDim = val_nDim;
@@ -75,14 +76,14 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     /*--- First determine the number of points per rank and make them
           available to all ranks. ---*/
     int rank, size;
-    SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
-    SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
+    SU2_MPI::Comm_rank(comm, &rank);
+    SU2_MPI::Comm_size(comm, &size);
 
     vector<int> recvCounts(size), displs(size);
     int sizeLocal = (int) val_coor.size();
 
     SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1,
-                       MPI_INT, SU2_MPI::GetComm());
+                       MPI_INT, comm);
     displs[0] = 0;
     for(int i=1; i<size; ++i) displs[i] = displs[i-1] + recvCounts[i-1];
 
@@ -98,14 +99,14 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
 
     coorPoints.resize(sizeGlobal);
     SU2_MPI::Allgatherv(val_coor.data(), sizeLocal, MPI_DOUBLE, coorPoints.data(),
-                        recvCounts.data(), displs.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+                        recvCounts.data(), displs.data(), MPI_DOUBLE, comm);
 
     /*--- Determine the number of elements per rank and make them
           available to all ranks. ---*/
     sizeLocal = (int) val_VTKElem.size();
 
     SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1,
-                       MPI_INT, SU2_MPI::GetComm());
+                       MPI_INT, comm);
     displs[0] = 0;
     for(int i=1; i<size; ++i) displs[i] = displs[i-1] + recvCounts[i-1];
 
@@ -118,13 +119,13 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     localElemIDs.resize(sizeGlobal);
 
     SU2_MPI::Allgatherv(val_VTKElem.data(), sizeLocal, MPI_UNSIGNED_SHORT, elemVTK_Type.data(),
-                        recvCounts.data(), displs.data(), MPI_UNSIGNED_SHORT, SU2_MPI::GetComm());
+                        recvCounts.data(), displs.data(), MPI_UNSIGNED_SHORT, comm);
 
     SU2_MPI::Allgatherv(val_markerID.data(), sizeLocal, MPI_UNSIGNED_SHORT, localMarkers.data(),
-                        recvCounts.data(), displs.data(), MPI_UNSIGNED_SHORT, SU2_MPI::GetComm());
+                        recvCounts.data(), displs.data(), MPI_UNSIGNED_SHORT, comm);
 
     SU2_MPI::Allgatherv(val_elemID.data(), sizeLocal, MPI_UNSIGNED_LONG, localElemIDs.data(),
-                        recvCounts.data(), displs.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+                        recvCounts.data(), displs.data(), MPI_UNSIGNED_LONG, comm);
 
     /*--- Create the content of ranksOfElems, which stores the original ranks
           where the elements come from. ---*/
@@ -140,7 +141,7 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     sizeLocal = (int) val_connElem.size();
 
     SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1,
-                       MPI_INT, SU2_MPI::GetComm());
+                       MPI_INT, comm);
     displs[0] = 0;
     for(int i=1; i<size; ++i) displs[i] = displs[i-1] + recvCounts[i-1];
 
@@ -150,14 +151,14 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     elemConns.resize(sizeGlobal);
 
     SU2_MPI::Allgatherv(val_connElem.data(), sizeLocal, MPI_UNSIGNED_LONG, elemConns.data(),
-                        recvCounts.data(), displs.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+                        recvCounts.data(), displs.data(), MPI_UNSIGNED_LONG, comm);
   }
     else {
 
     /*--- A local tree must be built. Copy the data from the arguments into the
           member variables and set the ranks to the rank of this processor. ---*/
     int rank;
-    SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
+    SU2_MPI::Comm_rank(comm, &rank);
 
     coorPoints   = val_coor;
     elemConns    = val_connElem;
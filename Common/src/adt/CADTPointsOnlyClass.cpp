@@ -253,3 +253,116 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
   dist = sqrt(dist);
 
 }
+
+void CADTPointsOnlyClass::DetermineNearestNodes_impl(vector<unsigned long> &stackLeaves,
+                                                     const su2double       *coor,
+                                                     unsigned long         k,
+                                                     vector<su2double>     &dist2,
+                                                     vector<unsigned long> &pointID,
+                                                     vector<int>           &rankID) const {
+  dist2.clear();
+  pointID.clear();
+  rankID.clear();
+  if(isEmpty || (k == 0)) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  /*--- Lambda to compute the distance squared to a node of the ADT. ---*/
+  auto distance2 = [&](unsigned long kk) {
+    const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+    su2double d = 0.0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      d += ds*ds;
+    }
+    return d;
+  };
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Depth-first traversal of the tree keeping the best k nodes ---*/
+  /*---         in a max-heap. The closest child leaf is visited first,    ---*/
+  /*---         such that the heap is filled quickly with good candidates  ---*/
+  /*---         and the remaining leaves can be discarded.                 ---*/
+  /*--------------------------------------------------------------------------*/
+
+  using Candidate = pair<su2double, unsigned long>;
+  auto closer = [this](const Candidate &a, const Candidate &b) {
+    if(a.first != b.first) return a.first < b.first;
+    return localPointIDs[a.second] < localPointIDs[b.second];
+  };
+
+  vector<Candidate> best;
+  best.reserve(k);
+
+  auto minDistLeaf = [&](unsigned long kk) {
+    su2double posDist = 0.0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      su2double ds = 0.0;
+      if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+      else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+      posDist += ds*ds;
+    }
+    return posDist;
+  };
+
+  stackLeaves.clear();
+  stackLeaves.push_back(0);
+
+  while( !stackLeaves.empty() ) {
+
+    const unsigned long ll = stackLeaves.back();
+    stackLeaves.pop_back();
+
+    /* Discard the leaf if it cannot contain a closer node. */
+    if((best.size() == k) && (minDistLeaf(ll) > best.front().first)) continue;
+
+    su2double posDist[2] = {0.0, 0.0};
+    for(unsigned short mm=0; mm<2; ++mm) {
+      const unsigned long kk = leaves[ll].children[mm];
+
+      if( leaves[ll].childrenAreTerminal[mm] ) {
+
+        /* A tree with a single point stores it twice. */
+        if((mm == 1) && (kk == leaves[ll].children[0])) continue;
+
+        const Candidate cand(distance2(kk), kk);
+        if(best.size() < k) {
+          best.push_back(cand);
+          push_heap(best.begin(), best.end(), closer);
+        }
+        else if( closer(cand, best.front()) ) {
+          pop_heap(best.begin(), best.end(), closer);
+          best.back() = cand;
+          push_heap(best.begin(), best.end(), closer);
+        }
+      }
+      else {
+        posDist[mm] = minDistLeaf(kk);
+      }
+    }
+
+    /* Push the farthest child leaf first, so that the closest is visited next. */
+    const unsigned short first = (posDist[0] < posDist[1])? 1 : 0;
+    for(unsigned short m=0; m<2; ++m) {
+      const unsigned short mm = (m == 0)? first : 1-first;
+      if( leaves[ll].childrenAreTerminal[mm] ) continue;
+      if((best.size() < k) || (posDist[mm] <= best.front().first))
+        stackLeaves.push_back(leaves[ll].children[mm]);
+    }
+  }
+
+  sort_heap(best.begin(), best.end(), closer);
+
+  AD::EndPassive(wasActive);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Store the results, the distances are recomputed to get the ---*/
+  /*---         correct dependency if we use AD.                           ---*/
+  /*--------------------------------------------------------------------------*/
+
+  for(const auto &cand : best) {
+    dist2.push_back(distance2(cand.second));
+    pointID.push_back(localPointIDs[cand.second]);
+    rankID.push_back(ranksOfPoints[cand.second]);
+  }
+}
@@ -28,7 +28,7 @@
 #include "../../include/fem/fem_geometry_structure.hpp"
 #include "../../include/adt/CADTElemClass.hpp"
 
-std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig *config) const {
+std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig *config, SU2_MPI::Comm comm) const {
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
@@ -118,7 +118,7 @@ std::unique_ptr<CADTElemClass> CMeshFEM_DG::ComputeViscousWallADT(const CConfig
 
   /* Build the ADT. */
   std::unique_ptr<CADTElemClass> WallADT(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                                                           markerIDs, elemIDs, true));
+                                                           markerIDs, elemIDs, true, comm));
 
   return WallADT;
 
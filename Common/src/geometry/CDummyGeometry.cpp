@@ -43,3 +43,13 @@ CDummyGeometry::CDummyGeometry(CConfig *config) : CGeometry() {
 
   config->SetnSpanWiseSections(0);
 }
+
+std::unique_ptr<CADTElemClass> CDummyGeometry::ComputeViscousWallADT(const CConfig *config, SU2_MPI::Comm comm) const {
+
+  vector<su2double> surfaceCoor;
+  vector<unsigned long> surfaceConn, elemIDs;
+  vector<unsigned short> VTK_TypeElem, markerIDs;
+
+  return std::unique_ptr<CADTElemClass>(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
+                                                          markerIDs, elemIDs, true, comm));
+}
@@ -2442,6 +2442,9 @@ void CGeometry::UpdateGeometry(CGeometry **geometry_container, CConfig *config)
 
   }
 
+  for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++)
+    geometry_container[iMesh]->InvalidateLeastSquaresWeights();
+
 }
 
 void CGeometry::SetCustomBoundary(CConfig *config) {
@@ -3731,6 +3734,17 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
   return edgeColoring;
 }
 
+su2activematrix& CGeometry::GetLeastSquaresWeights(bool weighted)
+{
+  auto& weights = LSWeights[weighted];
+
+  if (weights.empty() && nodes != nullptr) {
+    weights.resize(nodes->GetPoints().getNumNonZeros(), nDim) = su2double(0.0);
+    LSWeightsValid[weighted] = false;
+  }
+  return weights;
+}
+
 void CGeometry::SetNaturalEdgeColoring()
 {
   if (nEdge == 0) return;
@@ -3791,6 +3805,53 @@ void CGeometry::SetNaturalElementColoring()
   if (omp_get_max_threads() > 1) elemColorGroupSize = nElem;
 }
 
+const CCompressedSparsePatternUL& CGeometry::GetPointColoring(su2double* efficiency)
+{
+  /*--- Only needed with threads, the group size may also force a sequential loop. ---*/
+  if ((omp_get_max_threads() == 1) || (nPointDomain <= pointColorGroupSize) || (nodes == nullptr)) {
+    if (efficiency != nullptr) *efficiency = 1.0;
+    return pointColoring;
+  }
+
+  /*--- Build if required. ---*/
+  if (pointColoring.empty()) {
+
+    /*--- Create a temporary sparse pattern from the closed neighborhoods (the point
+     *    and its neighbors) of the domain points. ---*/
+    const auto pattern = buildClosedNeighborhoodPattern(nodes->GetPoints(), nPointDomain);
+
+    /*--- Color the points, on failure the client code should fall back to not coloring. ---*/
+    constexpr bool balanceColors = true;
+    pointColoring = colorSparsePattern(pattern, pointColorGroupSize, balanceColors);
+  }
+
+  if (efficiency != nullptr) {
+    *efficiency = pointColoring.empty()? 0.0 :
+                  coloringEfficiency(pointColoring, omp_get_max_threads(), pointColorGroupSize);
+  }
+  return pointColoring;
+}
+
+vector<OptionalGridColor<> > CGeometry::GetPointLoopColors(bool& colored, bool allowColoring) const
+{
+  colored = false;
+#ifdef HAVE_OPDI
+  colored = allowColoring && (omp_get_num_threads() > 1) && AD::TapeActive() && !pointColoring.empty();
+#endif
+  vector<OptionalGridColor<> > colors;
+
+  if (!colored) {
+    colors.emplace_back(nullptr, nPointDomain);
+    return colors;
+  }
+
+  colors.reserve(pointColoring.getOuterSize());
+  for (auto iColor = 0ul; iColor < pointColoring.getOuterSize(); ++iColor)
+    colors.emplace_back(pointColoring.innerIdx(iColor), pointColoring.getNumNonZeros(iColor), pointColorGroupSize);
+
+  return colors;
+}
+
 void CGeometry::ColorMGLevels(unsigned short nMGLevels, const CGeometry* const* geometry) {
 
   using tColor = uint8_t;
@@ -3818,13 +3879,15 @@ void CGeometry::ColorMGLevels(unsigned short nMGLevels, const CGeometry* const*
   }
 }
 
-void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry ****geometry_container){
+void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry ****geometry_container,
+                                    SU2_MPI::Comm comm){
 
   int nZone = config_container[ZONE_0]->GetnZone();
-  bool allEmpty = true;
   vector<bool> wallDistanceNeeded(nZone, false);
 
   for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++){
+
+    bool allEmpty = true;
     for (int iZone = 0; iZone < nZone; iZone++){
 
       /*--- Check if a zone needs the wall distance and store a boolean ---*/
@@ -3849,7 +3912,7 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
 
     /*--- Loop over all zones and compute the ADT based on the viscous walls in that zone ---*/
     for (int iZone = 0; iZone < nZone; iZone++){
-      unique_ptr<CADTElemClass> WallADT = geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone]);
+      unique_ptr<CADTElemClass> WallADT = geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone], comm);
       if (WallADT && !WallADT->IsEmpty()){
         allEmpty = false;
         /*--- Inner loop over all zones to update the wall distances.
@@ -3883,13 +3946,22 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
         });
       NdFlattener<2> roughness_local(roughness_f);
       // [rank][iZone][iMarker] -> roughness
-      NdFlattener<3> roughness_global(Nd_MPI_Environment(), roughness_local);
+      NdFlattener<3> roughness_global(Nd_MPI_Environment(MPI_DOUBLE, MPI_UNSIGNED_LONG, comm), roughness_local);
       // use it to update roughnesses
+      // dummy geometries (zones or instances solved by other ranks) have no nodes
       for(int jZone=0; jZone<nZone; jZone++){
-        if (wallDistanceNeeded[jZone] && config_container[jZone]->GetnRoughWall()>0){
-          geometry_container[jZone][iInst][MESH_0]->nodes->SetWallRoughness(roughness_global);
+        CGeometry *geometry = geometry_container[jZone][iInst][MESH_0];
+        if (wallDistanceNeeded[jZone] && config_container[jZone]->GetnRoughWall()>0 && geometry->nodes){
+          geometry->nodes->SetWallRoughness(roughness_global);
         }
       }
     }
+
+    /*--- Restrict the wall distance to the coarse levels when the turbulence equations use multigrid. ---*/
+    for (int iZone = 0; iZone < nZone; iZone++){
+      if (!wallDistanceNeeded[iZone] || !config_container[iZone]->GetMG_Turb()) continue;
+      for (unsigned short iMesh = 1; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++)
+        geometry_container[iZone][iInst][iMesh]->SetRestricted_WallDistance(geometry_container[iZone][iInst][iMesh-1]);
+    }
   }
 }
@@ -27,6 +27,7 @@
 
 #include "../../include/geometry/CMultiGridGeometry.hpp"
 #include "../../include/geometry/CMultiGridQueue.hpp"
+#include "../../include/geometry/CMultiGridGraph.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -54,6 +55,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   unsigned short *copy_marker = new unsigned short [nMarker_Max];
 
+  const bool graphAgglomeration = config->GetMG_InterfaceAgglomeration();
+
 #ifdef HAVE_MPI
   int send_to, receive_from;
   SU2_MPI::Status status;
@@ -96,6 +99,11 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   Index_CoarseCV = 0;
 
+  /*--- With the partition independent agglomeration all the domain points are agglomerated
+   here, and the boundary and interior stages below have nothing left to do. ---*/
+
+  if (graphAgglomeration) Index_CoarseCV = SetGraphAgglomeration(fine_grid, config);
+
   /*--- The first step is the boundary agglomeration. ---*/
 
   for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
@@ -386,8 +394,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
   unsigned long iFinePoint, iCoarsePoint, iCoarsePoint_Complete;
   unsigned short iChildren;
 
-  /*--- Find the point surrounding a point ---*/
-  {
+  /*--- Find the point surrounding a point (only needed to detect the isolated points) ---*/
+  if (!graphAgglomeration) {
     /*--- Temporary, CPoint (nodes) then compresses the information ---*/
     vector<vector<unsigned long> > points(fine_grid->GetnPoint());
 
@@ -407,11 +415,12 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     nodes->SetPoints(points);
   }
 
-  /*--- Detect isolated points and merge them with its correct neighbor ---*/
+  /*--- Detect isolated points and merge them with its correct neighbor (not with the partition
+   independent agglomeration, the merge would depend on the partitioning). ---*/
 
   for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
 
-    if (nodes->GetnPoint(iCoarsePoint) == 1) {
+    if (!graphAgglomeration && (nodes->GetnPoint(iCoarsePoint) == 1)) {
 
       /*--- Find the neighbor of the isolated point. This neighbor is the right control volume ---*/
 
@@ -510,18 +519,31 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
         Buffer_Send_Parent[iVertex] = fine_grid->nodes->GetParent_CV(iPoint);
       }
 
+      /*--- The partition independent agglomeration also needs the global index of the parents. ---*/
+
+      vector<unsigned long> Buffer_Send_Index, Buffer_Receive_Index;
+      if (graphAgglomeration) {
+        Buffer_Receive_Index.resize(nBufferR_Vector);
+        for (iVertex = 0; iVertex < nVertexS; iVertex++)
+          Buffer_Send_Index.push_back(nodes->GetGlobalIndex(Buffer_Send_Parent[iVertex]));
+      }
+
 #ifdef HAVE_MPI
       /*--- Send/Receive information using Sendrecv ---*/
       SU2_MPI::Sendrecv(Buffer_Send_Children, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,0,
                    Buffer_Receive_Children, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,0, SU2_MPI::GetComm(), &status);
       SU2_MPI::Sendrecv(Buffer_Send_Parent, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,1,
                    Buffer_Receive_Parent, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,1, SU2_MPI::GetComm(), &status);
+      if (graphAgglomeration)
+        SU2_MPI::Sendrecv(Buffer_Send_Index.data(), nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,2,
+                     Buffer_Receive_Index.data(), nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,2, SU2_MPI::GetComm(), &status);
 #else
       /*--- Receive information without MPI ---*/
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
         Buffer_Receive_Children[iVertex] = Buffer_Send_Children[iVertex];
         Buffer_Receive_Parent[iVertex] = Buffer_Send_Parent[iVertex];
       }
+      Buffer_Receive_Index = Buffer_Send_Index;
 #endif
 
       /*--- Deallocate send buffer ---*/
@@ -584,6 +606,13 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
         nodes->SetnChildren_CV(Parent_Local[iVertex], nChildren_MPI[Parent_Local[iVertex]]);
         nodes->SetDomain(Parent_Local[iVertex], false);
 
+        if (graphAgglomeration) {
+          nodes->SetGlobalIndex(Parent_Local[iVertex], Buffer_Receive_Index[iVertex]);
+#ifdef HAVE_MPI
+          nodes->SetColor(Parent_Local[iVertex], receive_from);
+#endif
+        }
+
       }
 
       /*--- Deallocate auxiliar structures ---*/
@@ -607,10 +636,11 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   nPoint = Index_CoarseCV;
 
-  /*--- Console output with the summary of the agglomeration ---*/
+  /*--- Console output with the summary of the agglomeration, the partition independent
+   agglomeration does not count the halos (so that the levels and CFL do not depend on it). ---*/
 
-  Local_nPointCoarse = nPoint;
-  Local_nPointFine = fine_grid->GetnPoint();
+  Local_nPointCoarse = graphAgglomeration? nPointDomain : nPoint;
+  Local_nPointFine = graphAgglomeration? fine_grid->GetnPointDomain() : fine_grid->GetnPoint();
 
   SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
@@ -654,6 +684,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
   }
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  pointColorGroupSize = config->GetEdgeColoringGroupSize();
 
   delete [] copy_marker;
 
@@ -774,6 +805,80 @@ bool CMultiGridGeometry::GeometricalCheck(unsigned long iPoint, CGeometry *fine_
 
 }
 
+unsigned long CMultiGridGeometry::SetGraphAgglomeration(CGeometry *fine_grid, const CConfig *config) {
+
+  const auto nPointFine = fine_grid->GetnPointDomain();
+
+  /*--- Graph of the domain points, their global index, physical markers (index in the config
+   file, as the markers of the partitions are numbered differently), and neighbors. ---*/
+
+  vector<unsigned long> idx(nPointFine), tags(nPointFine);
+  vector<vector<unsigned long> > adjacency(nPointFine);
+
+  for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++) {
+    idx[iPoint] = fine_grid->nodes->GetGlobalIndex(iPoint);
+
+    vector<unsigned short> markers;
+    if (fine_grid->nodes->GetBoundary(iPoint)) {
+      for (unsigned short iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
+        if ((fine_grid->nodes->GetVertex(iPoint, iMarker) != -1) &&
+            (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE))
+          markers.push_back(config->GetMarker_CfgFile_TagBound(config->GetMarker_All_TagBound(iMarker)));
+      }
+    }
+    tags[iPoint] = CMultiGridGraph::MarkerTag(markers);
+
+    for (auto jPoint : fine_grid->nodes->GetPoints(iPoint))
+      adjacency[iPoint].push_back(fine_grid->nodes->GetGlobalIndex(jPoint));
+  }
+
+  /*--- The halos are owned by the rank of their color. ---*/
+
+  unordered_map<unsigned long, int> haloOwner;
+  for (auto iPoint = nPointFine; iPoint < fine_grid->GetnPoint(); iPoint++)
+    haloOwner[fine_grid->nodes->GetGlobalIndex(iPoint)] = fine_grid->nodes->GetColor(iPoint);
+
+  const CMultiGridGraph graph(move(idx), move(tags), move(adjacency), [&](unsigned long iGlobal) {
+    const auto it = haloOwner.find(iGlobal);
+    return (it != haloOwner.end())? it->second : rank;
+  });
+
+  const auto seed = graph.Agglomerate();
+
+  /*--- One coarse CV per seed, identified by the global index of the seed. If the partitioning
+   is not aligned with the agglomeration (see CPhysicalGeometry::SetColorGrid_Parallel) the seed
+   may be on another rank, the local part of the CV is then identified by its smallest index. ---*/
+
+  unordered_map<unsigned long, unsigned long> seedToCoarse;
+  unsigned long nCoarseCV = 0;
+
+  for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++) {
+
+    const auto iGlobal = graph.GetGlobalIndex(iPoint);
+    const auto it = seedToCoarse.emplace(seed[iPoint], nCoarseCV);
+    const auto iCoarsePoint = it.first->second;
+
+    if (it.second) {
+      nodes->SetGlobalIndex(iCoarsePoint, iGlobal);
+      nodes->SetColor(iCoarsePoint, rank);
+      nCoarseCV++;
+    }
+    const auto iGlobalCoarse = nodes->GetGlobalIndex(iCoarsePoint);
+    if ((iGlobal == seed[iPoint]) || ((iGlobalCoarse != seed[iPoint]) && (iGlobal < iGlobalCoarse)))
+      nodes->SetGlobalIndex(iCoarsePoint, iGlobal);
+
+    const auto nChildren = nodes->GetnChildren_CV(iCoarsePoint);
+    nodes->SetChildren_CV(iCoarsePoint, nChildren, iPoint);
+    nodes->SetnChildren_CV(iCoarsePoint, nChildren+1);
+    fine_grid->nodes->SetParent_CV(iPoint, iCoarsePoint);
+
+    if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+      nodes->SetAgglomerate_Indirect(iCoarsePoint, true);
+  }
+
+  return nCoarseCV;
+}
+
 void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_Indirect_Neighbors, unsigned long iPoint,
                                               unsigned long Index_CoarseCV, CGeometry *fine_grid) {
 
@@ -1309,6 +1414,23 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, const
   END_SU2_OMP_FOR
 }
 
+void CMultiGridGeometry::SetRestricted_WallDistance(const CGeometry *fine_mesh) {
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint,omp_get_max_threads()))
+  for (unsigned long Point_Coarse = 0; Point_Coarse < nPoint; Point_Coarse++) {
+    su2double Area_Parent = nodes->GetVolume(Point_Coarse);
+    su2double Distance = 0.0;
+
+    for (unsigned short iChild = 0; iChild < nodes->GetnChildren_CV(Point_Coarse); iChild++) {
+      unsigned long Point_Fine = nodes->GetChildren_CV(Point_Coarse, iChild);
+      su2double Area_Child = fine_mesh->nodes->GetVolume(Point_Fine);
+      Distance += fine_mesh->nodes->GetWall_Distance(Point_Fine)*Area_Child/Area_Parent;
+    }
+    nodes->SetWall_Distance(Point_Coarse, Distance);
+  }
+  END_SU2_OMP_FOR
+}
+
 
 void CMultiGridGeometry::FindNormal_Neighbor(CConfig *config) {
 
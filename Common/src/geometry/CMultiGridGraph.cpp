@@ -0,0 +1,364 @@
+/*!
+ * \file CMultiGridGraph.cpp
+ * \brief Implementation of the distributed graph used to agglomerate the multigrid levels
+ *        independently of the partitioning.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CMultiGridGraph.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace {
+
+constexpr unsigned long NO_NODE = numeric_limits<unsigned long>::max();
+
+/*--- Well mixed 64-bit hash (splitmix64), used to give the nodes pseudo-random priorities
+ without depending on the numbering, which is usually structured and would make the
+ maximal independent set sequential. ---*/
+
+inline uint64_t Hash(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/*--- Whether node a has higher priority than node b, ties are broken by the global index. ---*/
+
+inline bool HigherPriority(unsigned long a, unsigned long b) {
+  if (a == NO_NODE) return false;
+  if (b == NO_NODE) return true;
+  const auto ha = Hash(a), hb = Hash(b);
+  return (ha > hb) || ((ha == hb) && (a < b));
+}
+
+}
+
+CMultiGridGraph::CMultiGridGraph(vector<unsigned long> idx, vector<unsigned long> tags,
+                                 vector<vector<unsigned long> > adjacency, OwnerFunction ownerFunction) :
+  globalIndex(move(idx)),
+  tag(move(tags)),
+  neighbors(move(adjacency)),
+  owner(move(ownerFunction)) {
+
+  localIndex.reserve(globalIndex.size());
+  for (unsigned long iNode = 0; iNode < globalIndex.size(); ++iNode)
+    localIndex[globalIndex[iNode]] = iNode;
+}
+
+vector<unsigned long> CMultiGridGraph::GetGhosts(vector<vector<unsigned long> >& adjacency) const {
+
+  vector<unsigned long> ghosts;
+  unordered_map<unsigned long, unsigned long> ghostIndex;
+
+  adjacency.resize(GetnNode());
+
+  for (unsigned long iNode = 0; iNode < GetnNode(); ++iNode) {
+    adjacency[iNode].clear();
+    for (auto jGlobal : neighbors[iNode]) {
+      if (jGlobal == globalIndex[iNode]) continue;
+      const auto it = localIndex.find(jGlobal);
+      if (it != localIndex.end()) {
+        adjacency[iNode].push_back(it->second);
+      }
+      else {
+        const auto jt = ghostIndex.emplace(jGlobal, GetnNode() + ghosts.size());
+        if (jt.second) ghosts.push_back(jGlobal);
+        adjacency[iNode].push_back(jt.first->second);
+      }
+    }
+  }
+  return ghosts;
+}
+
+vector<unsigned long> CMultiGridGraph::Query(const vector<unsigned long>& idx,
+                                             const vector<unsigned long>& values) const {
+
+  const int size = SU2_MPI::GetSize();
+
+  /*--- Sort the requests by owner. ---*/
+
+  vector<int> nSend(size, 0), nRecv(size, 0), sendDisp(size+1, 0), recvDisp(size+1, 0);
+  vector<int> destination(idx.size());
+
+  for (unsigned long i = 0; i < idx.size(); ++i) {
+    destination[i] = owner(idx[i]);
+    nSend[destination[i]]++;
+  }
+  for (int iRank = 0; iRank < size; ++iRank) sendDisp[iRank+1] = sendDisp[iRank] + nSend[iRank];
+
+  vector<unsigned long> sendBuf(idx.size()), position(idx.size());
+  vector<int> counter(sendDisp.begin(), sendDisp.end()-1);
+
+  for (unsigned long i = 0; i < idx.size(); ++i) {
+    position[i] = counter[destination[i]]++;
+    sendBuf[position[i]] = idx[i];
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; ++iRank) recvDisp[iRank+1] = recvDisp[iRank] + nRecv[iRank];
+
+  vector<unsigned long> recvBuf(recvDisp[size]);
+  SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     recvBuf.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  /*--- Answer with the values of the requested nodes, which must be owned by this rank. ---*/
+
+  for (auto& request : recvBuf) {
+    const auto it = localIndex.find(request);
+    if (it == localIndex.end())
+      SU2_MPI::Error("A node was requested from a rank that does not own it.", CURRENT_FUNCTION);
+    request = values[it->second];
+  }
+
+  SU2_MPI::Alltoallv(recvBuf.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG,
+                     sendBuf.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<unsigned long> result(idx.size());
+  for (unsigned long i = 0; i < idx.size(); ++i) result[i] = sendBuf[position[i]];
+
+  return result;
+}
+
+vector<unsigned long> CMultiGridGraph::Agglomerate() const {
+
+  enum : unsigned long {UNDECIDED = 0, SEED = 1, AGGLOMERATED = 2, ASSIGNED = 3};
+
+  const auto nNode = GetnNode();
+
+  /*--- Local adjacency, restricted to the neighbors with the same tag (i.e. those that can be
+   agglomerated together), the owned nodes are followed by the ghosts. ---*/
+
+  vector<vector<unsigned long> > adjacency;
+  const auto ghosts = GetGhosts(adjacency);
+  const auto nTotal = nNode + ghosts.size();
+
+  vector<unsigned long> allIndex(globalIndex);
+  allIndex.insert(allIndex.end(), ghosts.begin(), ghosts.end());
+
+  vector<unsigned long> allTag(tag);
+  const auto ghostTag = Query(ghosts, tag);
+  allTag.insert(allTag.end(), ghostTag.begin(), ghostTag.end());
+
+  for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+    auto& adj = adjacency[iNode];
+    adj.erase(remove_if(adj.begin(), adj.end(), [&](unsigned long j) { return allTag[j] != allTag[iNode]; }), adj.end());
+  }
+
+  /*--- Copy the values of the owned nodes to the ghosts. ---*/
+
+  auto UpdateGhosts = [&](vector<unsigned long>& values) {
+    const auto ghostValues = Query(ghosts, vector<unsigned long>(values.begin(), values.begin()+nNode));
+    copy(ghostValues.begin(), ghostValues.end(), values.begin()+nNode);
+  };
+
+  /*--- The nodes are assigned to seeds in passes. In each pass, the seeds are a distance-2 maximal
+   independent set of the unassigned nodes, and the unassigned neighbors of a seed join it (the
+   seed with the highest priority if there are several), which gives aggregates of about the
+   size of the seed and its neighbors. ---*/
+
+  vector<unsigned long> seed(nTotal, NO_NODE), state(nTotal), best(nTotal), near(nTotal);
+  unsigned long nUnassigned = 0;
+
+  do {
+    for (unsigned long iNode = 0; iNode < nTotal; ++iNode)
+      state[iNode] = (seed[iNode] == NO_NODE)? UNDECIDED : ASSIGNED;
+
+    /*--- In each round, the undecided nodes with the highest priority within distance 2 become
+     seeds, and the undecided nodes within distance 2 of a seed are removed from the set. Nodes
+     assigned by previous passes do not take part, and all decisions are taken with the state
+     of the previous step. ---*/
+
+    unsigned long nUndecided = 0;
+    do {
+      for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+        best[iNode] = (state[iNode] == UNDECIDED)? allIndex[iNode] : NO_NODE;
+        if (state[iNode] == ASSIGNED) continue;
+        for (auto j : adjacency[iNode])
+          if ((state[j] == UNDECIDED) && HigherPriority(allIndex[j], best[iNode])) best[iNode] = allIndex[j];
+      }
+      UpdateGhosts(best);
+
+      for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+        if (state[iNode] != UNDECIDED) continue;
+        auto best2 = best[iNode];
+        for (auto j : adjacency[iNode])
+          if (HigherPriority(best[j], best2)) best2 = best[j];
+        near[iNode] = (best2 == allIndex[iNode]);
+      }
+      for (unsigned long iNode = 0; iNode < nNode; ++iNode)
+        if ((state[iNode] == UNDECIDED) && near[iNode]) state[iNode] = SEED;
+      UpdateGhosts(state);
+
+      for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+        near[iNode] = (state[iNode] == SEED);
+        if (state[iNode] == ASSIGNED) continue;
+        for (auto j : adjacency[iNode]) near[iNode] |= (state[j] == SEED);
+      }
+      UpdateGhosts(near);
+
+      unsigned long nLocal = 0;
+      for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+        if (state[iNode] != UNDECIDED) continue;
+        bool remove = near[iNode];
+        for (auto j : adjacency[iNode]) remove |= near[j];
+        if (remove) state[iNode] = AGGLOMERATED;
+        else nLocal++;
+      }
+      UpdateGhosts(state);
+
+      SU2_MPI::Allreduce(&nLocal, &nUndecided, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+    } while (nUndecided > 0);
+
+    /*--- Assign the seeds and their unassigned neighbors. ---*/
+
+    unsigned long nLocal = 0;
+    for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+      if (state[iNode] == SEED) seed[iNode] = allIndex[iNode];
+      if (state[iNode] != AGGLOMERATED) continue;
+      for (auto j : adjacency[iNode])
+        if ((state[j] == SEED) && HigherPriority(allIndex[j], seed[iNode])) seed[iNode] = allIndex[j];
+      nLocal += (seed[iNode] == NO_NODE);
+    }
+    UpdateGhosts(seed);
+
+    SU2_MPI::Allreduce(&nLocal, &nUnassigned, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  } while (nUnassigned > 0);
+
+  /*--- The seeds left without neighbors by the previous passes join a neighboring aggregate
+   (the members of an aggregate are neighbors of its seed). ---*/
+
+  vector<unsigned long> isolated(nTotal, false);
+
+  for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+    if (seed[iNode] != allIndex[iNode]) continue;
+    isolated[iNode] = true;
+    for (auto j : adjacency[iNode]) isolated[iNode] &= (seed[j] != allIndex[iNode]);
+  }
+  UpdateGhosts(isolated);
+
+  vector<unsigned long> result(seed.begin(), seed.begin()+nNode);
+
+  for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+    if (!isolated[iNode]) continue;
+    auto bestNeighbor = NO_NODE;
+    for (auto j : adjacency[iNode]) {
+      if (!isolated[j] && HigherPriority(allIndex[j], bestNeighbor)) {
+        bestNeighbor = allIndex[j];
+        result[iNode] = seed[j];
+      }
+    }
+  }
+
+  return result;
+}
+
+CMultiGridGraph CMultiGridGraph::Coarsen(const vector<unsigned long>& seed) const {
+
+  const int size = SU2_MPI::GetSize();
+  const auto nNode = GetnNode();
+
+  vector<vector<unsigned long> > adjacency;
+  const auto ghosts = GetGhosts(adjacency);
+
+  vector<unsigned long> allSeed(seed.begin(), seed.begin()+nNode);
+  const auto ghostSeed = Query(ghosts, seed);
+  allSeed.insert(allSeed.end(), ghostSeed.begin(), ghostSeed.end());
+
+  /*--- The seeds are the coarse nodes owned by this rank. ---*/
+
+  vector<unsigned long> coarseIndex, coarseTag;
+  unordered_map<unsigned long, unsigned long> coarseLocal;
+
+  for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+    if (seed[iNode] != globalIndex[iNode]) continue;
+    coarseLocal[globalIndex[iNode]] = coarseIndex.size();
+    coarseIndex.push_back(globalIndex[iNode]);
+    coarseTag.push_back(tag[iNode]);
+  }
+
+  /*--- Pairs of neighboring seeds, sent to the owner of the first. ---*/
+
+  vector<vector<unsigned long> > pairs(size);
+
+  for (unsigned long iNode = 0; iNode < nNode; ++iNode) {
+    for (auto j : adjacency[iNode]) {
+      if (allSeed[j] == seed[iNode]) continue;
+      auto& buffer = pairs[owner(seed[iNode])];
+      buffer.push_back(seed[iNode]);
+      buffer.push_back(allSeed[j]);
+    }
+  }
+
+  vector<int> nSend(size), nRecv(size), sendDisp(size+1, 0), recvDisp(size+1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    nSend[iRank] = pairs[iRank].size();
+    sendDisp[iRank+1] = sendDisp[iRank] + nSend[iRank];
+  }
+  vector<unsigned long> sendBuf;
+  sendBuf.reserve(sendDisp[size]);
+  for (const auto& buffer : pairs) sendBuf.insert(sendBuf.end(), buffer.begin(), buffer.end());
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; ++iRank) recvDisp[iRank+1] = recvDisp[iRank] + nRecv[iRank];
+
+  vector<unsigned long> recvBuf(recvDisp[size]);
+  SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     recvBuf.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<vector<unsigned long> > coarseNeighbors(coarseIndex.size());
+
+  for (unsigned long i = 0; i < recvBuf.size(); i += 2) {
+    const auto it = coarseLocal.find(recvBuf[i]);
+    if (it == coarseLocal.end())
+      SU2_MPI::Error("A coarse node was sent to a rank that does not own it.", CURRENT_FUNCTION);
+    coarseNeighbors[it->second].push_back(recvBuf[i+1]);
+  }
+
+  for (auto& adj : coarseNeighbors) {
+    sort(adj.begin(), adj.end());
+    adj.erase(unique(adj.begin(), adj.end()), adj.end());
+  }
+
+  return CMultiGridGraph(move(coarseIndex), move(coarseTag), move(coarseNeighbors), owner);
+}
+
+unsigned long CMultiGridGraph::MarkerTag(vector<unsigned short> markers) {
+
+  sort(markers.begin(), markers.end());
+  markers.erase(unique(markers.begin(), markers.end()), markers.end());
+
+  /*--- Up to 4 markers are packed exactly, more than that is unusual and they are hashed. ---*/
+
+  unsigned long result = 0;
+  for (size_t i = 0; i < markers.size(); ++i) {
+    if (i < 4) result |= (markers[i] + 1ul) << (16*i);
+    else result = Hash(result ^ markers[i]);
+  }
+  return result;
+}
@@ -29,6 +29,7 @@
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../include/geometry/CMultiGridGraph.hpp"
 #include "../../include/toolboxes/C1DInterpolation.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
@@ -61,6 +62,7 @@ CPhysicalGeometry::CPhysicalGeometry() : CGeometry() { }
 CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone) : CGeometry() {
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  pointColorGroupSize = config->GetEdgeColoringGroupSize();
 
   string text_line, Marker_Tag;
   ifstream mesh_file;
@@ -186,6 +188,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
                                      CConfig *config) : CGeometry() {
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  pointColorGroupSize = config->GetEdgeColoringGroupSize();
 
   /*--- The new geometry class has the same problem dimension/zone. ---*/
 
@@ -6193,9 +6196,6 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig *config, unsigned short val_iZo
   Normal           = new su2double[nDim];
 
   bool grid_movement        = config->GetGrid_Movement();
-#ifdef HAVE_MPI
-  su2double MyTotalArea, MyTotalRadius, *MyTotalTurboNormal= NULL, *MyTotalNormal= NULL, *MyTotalGridVel= NULL;
-#endif
 
   /*--- Intialization of the vector for the interested boundary ---*/
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
@@ -6232,21 +6232,19 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig *config, unsigned short val_iZo
 
 
 
-  /*--- start computing the average quantities span wise --- */
-  for (iSpan= 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
+  /*--- Span-wise sums of the geometric quantities, accumulated for all spans and reduced in one communication.
+   *    Layout of each span: [area, radius, turbo normal, normal, grid velocity]. ---*/
 
-    /*--- Forces initialization for contenitors to zero ---*/
-    for (iDim=0; iDim<nDim; iDim++) {
-      TotalTurboNormal[iDim]  =0.0;
-      TotalNormal[iDim]         =0.0;
-      TotalGridVel[iDim]        =0.0;
-    }
-    TotalArea = 0.0;
-    TotalRadius = 0.0;
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+  const unsigned short TURBONORMAL = 2, NORMAL = TURBONORMAL + nDim, GRIDVEL = NORMAL + nDim, nSum = GRIDVEL + nDim;
+
+  vector<su2double> localSums(nSpanWiseSections[marker_flag-1]*nSum, 0.0), spanSums(localSums.size());
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+          for (iSpan= 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
+            su2double* sum = &localSums[iSpan*nSum];
             for(iVertex = 0; iVertex < nVertexSpan[iMarker][iSpan]; iVertex++){
               iPoint = turbovertex[iMarker][iSpan][iVertex]->GetNode();
               turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
@@ -6260,50 +6258,38 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig *config, unsigned short val_iZo
                 radius = 0.0;
               }
               Area = turbovertex[iMarker][iSpan][iVertex]->GetArea();
-              TotalArea   += Area;
-              TotalRadius += radius;
+              sum[0] += Area;
+              sum[1] += radius;
               for (iDim = 0; iDim < nDim; iDim++) {
-                TotalTurboNormal[iDim]  +=TurboNormal[iDim];
-                TotalNormal[iDim]       +=Normal[iDim];
+                sum[TURBONORMAL+iDim] += TurboNormal[iDim];
+                sum[NORMAL+iDim]      += Normal[iDim];
               }
               if (grid_movement){
                 gridVel = nodes->GetGridVel(iPoint);
-                for (iDim = 0; iDim < nDim; iDim++) TotalGridVel[iDim] +=gridVel[iDim];
+                for (iDim = 0; iDim < nDim; iDim++) sum[GRIDVEL+iDim] += gridVel[iDim];
               }
             }
           }
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(localSums.data(), spanSums.data(), localSums.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
-    MyTotalArea            = TotalArea;                 TotalArea            = 0;
-    MyTotalRadius          = TotalRadius;               TotalRadius          = 0;
-    SU2_MPI::Allreduce(&MyTotalArea, &TotalArea, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    SU2_MPI::Allreduce(&MyTotalRadius, &TotalRadius, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  /*--- start computing the average quantities span wise --- */
+  for (iSpan= 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
 
-    MyTotalTurboNormal     = new su2double[nDim];
-    MyTotalNormal          = new su2double[nDim];
-    MyTotalGridVel         = new su2double[nDim];
+    const su2double* sum = &spanSums[iSpan*nSum];
 
-    for (iDim = 0; iDim < nDim; iDim++) {
-      MyTotalTurboNormal[iDim]  = TotalTurboNormal[iDim];
-      TotalTurboNormal[iDim]    = 0.0;
-      MyTotalNormal[iDim]       = TotalNormal[iDim];
-      TotalNormal[iDim]         = 0.0;
-      MyTotalGridVel[iDim]      = TotalGridVel[iDim];
-      TotalGridVel[iDim]        = 0.0;
+    TotalArea   = sum[0];
+    TotalRadius = sum[1];
+    for (iDim=0; iDim<nDim; iDim++) {
+      TotalTurboNormal[iDim] = sum[TURBONORMAL+iDim];
+      TotalNormal[iDim]      = sum[NORMAL+iDim];
+      TotalGridVel[iDim]     = sum[GRIDVEL+iDim];
     }
 
-    SU2_MPI::Allreduce(MyTotalTurboNormal, TotalTurboNormal, nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    SU2_MPI::Allreduce(MyTotalNormal, TotalNormal, nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    SU2_MPI::Allreduce(MyTotalGridVel, TotalGridVel, nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-
-    delete [] MyTotalTurboNormal;delete [] MyTotalNormal; delete [] MyTotalGridVel;
-
-#endif
-
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
       for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
         if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
@@ -6451,134 +6437,92 @@ void CPhysicalGeometry::GatherInOutAverageValues(CConfig *config, bool allocate)
 
 
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++){
-#ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbGeoIn= NULL,*TurbGeoOut= NULL;
-    su2double *TotTurbGeoIn = NULL,*TotTurbGeoOut = NULL;
-    int *TotMarkerTP;
-
-    n1          = 6;
-    n2          = 3;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbGeoIn  = new su2double[n1];
-    TurbGeoOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbGeoIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbGeoOut[i]   = -1.0;
-#endif
-    pitchIn           =  0.0;
-    areaIn            = -1.0;
-    tangGridVelIn     = -1.0;
-    radiusIn          = -1.0;
-    for(iDim = 0; iDim < nDim; iDim++){
-      turboNormal[iDim] = -1.0;
-    }
+  /*--- The inflow and outflow quantities of all spans, and the turbomachinery marker, are packed in one
+   *    buffer that is gathered by all ranks in one communication.
+   *    Layout: [marker, (inflow quantities, outflow quantities) of each span], -1 if not on this rank. ---*/
 
-    areaOut           = -1.0;
-    tangGridVelOut    = -1.0;
-    radiusOut         = -1.0;
+  constexpr unsigned short nIn = 4 + MAXNDIM, nOut = 3, nGeo = nIn + nOut;
+  const unsigned long bufSize = 1 + nGeo*(nSpanWiseSections + 1);
 
-    markerTP          = -1;
+  vector<su2double> sendBuf(bufSize, -1.0), recvBuf(size*bufSize);
+  vector<su2double> localPitch(nSpanWiseSections + 1, 0.0);
+
+  markerTP = -1;
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++){
+          su2double* geoIn = &sendBuf[1 + iSpan*nGeo];
+          su2double* geoOut = geoIn + nIn;
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
             markerTP          = iMarkerTP;
+            sendBuf[0]        = iMarkerTP;
             if (iSpan < nSpanWiseSections){
-              pitchIn         = MaxAngularCoord[iMarker][iSpan] - MinAngularCoord[iMarker][iSpan];
+              localPitch[iSpan] = MaxAngularCoord[iMarker][iSpan] - MinAngularCoord[iMarker][iSpan];
             }
-            areaIn            = SpanArea[iMarker][iSpan];
-            tangGridVelIn     = AverageTangGridVel[iMarker][iSpan];
-            radiusIn          = TurboRadius[iMarker][iSpan];
-            for(iDim = 0; iDim < nDim; iDim++) turboNormal[iDim] = AverageTurboNormal[iMarker][iSpan][iDim];
-
-
-#ifdef HAVE_MPI
-            TurbGeoIn[0]  = areaIn;
-            TurbGeoIn[1]  = tangGridVelIn;
-            TurbGeoIn[2]  = radiusIn;
-            TurbGeoIn[3]  = turboNormal[0];
-            TurbGeoIn[4]  = turboNormal[1];
-            TurbGeoIn[5]  = pitchIn;
-#endif
+            geoIn[0]  = SpanArea[iMarker][iSpan];
+            geoIn[1]  = AverageTangGridVel[iMarker][iSpan];
+            geoIn[2]  = TurboRadius[iMarker][iSpan];
+            geoIn[3]  = localPitch[iSpan];
+            for(iDim = 0; iDim < nDim; iDim++) geoIn[4+iDim] = AverageTurboNormal[iMarker][iSpan][iDim];
           }
 
           /*--- retrieve outlet information ---*/
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
             if (iSpan < nSpanWiseSections){
-              pitchIn       = MaxAngularCoord[iMarker][iSpan] - MinAngularCoord[iMarker][iSpan];
+              localPitch[iSpan] = MaxAngularCoord[iMarker][iSpan] - MinAngularCoord[iMarker][iSpan];
             }
-            areaOut         = SpanArea[iMarker][iSpan];
-            tangGridVelOut  = AverageTangGridVel[iMarker][iSpan];
-            radiusOut       = TurboRadius[iMarker][iSpan];
-#ifdef HAVE_MPI
-            TurbGeoOut[0]  = areaOut;
-            TurbGeoOut[1]  = tangGridVelOut;
-            TurbGeoOut[2]  = radiusOut;
-#endif
+            geoOut[0] = SpanArea[iMarker][iSpan];
+            geoOut[1] = AverageTangGridVel[iMarker][iSpan];
+            geoOut[2] = TurboRadius[iMarker][iSpan];
           }
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-    TotTurbGeoIn       = new su2double[n1t];
-    TotTurbGeoOut      = new su2double[n2t];
-    for (i=0;i<n1t;i++)
-      TotTurbGeoIn[i]  = -1.0;
-    for (i=0;i<n2t;i++)
-      TotTurbGeoOut[i] = -1.0;
-    TotMarkerTP = new int[size];
-    for(i=0; i<size; i++){
-      TotMarkerTP[i]    = -1;
-    }
+  SU2_MPI::Allgather(sendBuf.data(), bufSize, MPI_DOUBLE, recvBuf.data(), bufSize, MPI_DOUBLE, SU2_MPI::GetComm());
+
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++){
 
-    SU2_MPI::Allgather(TurbGeoIn, n1, MPI_DOUBLE, TotTurbGeoIn, n1, MPI_DOUBLE, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(TurbGeoOut, n2, MPI_DOUBLE,TotTurbGeoOut, n2, MPI_DOUBLE, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, SU2_MPI::GetComm());
+    /*--- Local values, replaced below by those of (the last) rank that has the markers. ---*/
 
-    delete [] TurbGeoIn, delete [] TurbGeoOut;
+    const su2double* geoIn = &sendBuf[1 + iSpan*nGeo];
+    const su2double* geoOut = geoIn + nIn;
 
+    pitchIn           = localPitch[iSpan];
+    areaIn            = geoIn[0];
+    tangGridVelIn     = geoIn[1];
+    radiusIn          = geoIn[2];
+    for(iDim = 0; iDim < nDim; iDim++) turboNormal[iDim] = geoIn[4+iDim];
 
-    for (i=0;i<size;i++){
-      if(TotTurbGeoIn[n1*i] > 0.0){
-        areaIn              = 0.0;
-        areaIn              = TotTurbGeoIn[n1*i];
-        tangGridVelIn       = 0.0;
-        tangGridVelIn       = TotTurbGeoIn[n1*i+1];
-        radiusIn            = 0.0;
-        radiusIn            = TotTurbGeoIn[n1*i+2];
-        turboNormal[0]      = 0.0;
-        turboNormal[0]      = TotTurbGeoIn[n1*i+3];
-        turboNormal[1]      = 0.0;
-        turboNormal[1]      = TotTurbGeoIn[n1*i+4];
-        pitchIn             = 0.0;
-        pitchIn             = TotTurbGeoIn[n1*i+5];
+    areaOut           = geoOut[0];
+    tangGridVelOut    = geoOut[1];
+    radiusOut         = geoOut[2];
 
-        markerTP            = -1;
-        markerTP            = TotMarkerTP[i];
+    for (int i = 0; i < size; i++){
+      const su2double* buf = &recvBuf[i*bufSize];
+      const su2double* totGeoIn = &buf[1 + iSpan*nGeo];
+      const su2double* totGeoOut = totGeoIn + nIn;
+
+      if(totGeoIn[0] > 0.0){
+        areaIn              = totGeoIn[0];
+        tangGridVelIn       = totGeoIn[1];
+        radiusIn            = totGeoIn[2];
+        pitchIn             = totGeoIn[3];
+        for(iDim = 0; iDim < nDim; iDim++) turboNormal[iDim] = totGeoIn[4+iDim];
+        markerTP            = SU2_TYPE::Int(buf[0]);
       }
 
-      if(TotTurbGeoOut[n2*i] > 0.0){
-        areaOut             = 0.0;
-        areaOut             = TotTurbGeoOut[n2*i];
-        tangGridVelOut      = 0.0;
-        tangGridVelOut      = TotTurbGeoOut[n2*i+1];
-        radiusOut           = 0.0;
-        radiusOut           = TotTurbGeoOut[n2*i+2];
+      if(totGeoOut[0] > 0.0){
+        areaOut             = totGeoOut[0];
+        tangGridVelOut      = totGeoOut[1];
+        radiusOut           = totGeoOut[2];
       }
     }
 
-    delete [] TotTurbGeoIn, delete [] TotTurbGeoOut; delete [] TotMarkerTP;
-
-
-#endif
-
     Pitch +=pitchIn/nSpanWiseSections;
 
     if (iSpan == nSpanWiseSections) {
@@ -8122,6 +8066,11 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
     nodes->SetColor(iPoint, part[iPoint]);
   }
 
+  /*--- Keep the coarse control volumes of the partition independent agglomeration on one rank. ---*/
+
+  if (config->GetMG_InterfaceAgglomeration() && (config->GetnMGLevels() > 0))
+    SetColorGrid_Agglomeration(config);
+
   /*--- Force free the connectivity. ---*/
 
   decltype(xadj)().swap(xadj);
@@ -8130,6 +8079,114 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
 #endif
 }
 
+void CPhysicalGeometry::SetColorGrid_Agglomeration(const CConfig *config) {
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain,0);
+  const auto firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- The master node has the boundary elements, send the physical markers of their
+   points (index in the config file) to the ranks that own the points. ---*/
+
+  vector<vector<unsigned long> > markerPairs(size);
+
+  if (rank == MASTER_NODE) {
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      const auto cfgMarker = config->GetMarker_CfgFile_TagBound(config->GetMarker_All_TagBound(iMarker));
+      for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
+          auto& buffer = markerPairs[pointPartitioner.GetRankContainingIndex(iPoint)];
+          buffer.push_back(iPoint);
+          buffer.push_back(cfgMarker);
+        }
+      }
+    }
+  }
+
+  vector<int> nSend(size, 0), nRecv(size, 0), sendDisp(size+1, 0), recvDisp(size+1, 0);
+  vector<unsigned long> sendBuf;
+  for (int iRank = 0; iRank < size; iRank++) {
+    nSend[iRank] = markerPairs[iRank].size();
+    sendDisp[iRank+1] = sendDisp[iRank] + nSend[iRank];
+    sendBuf.insert(sendBuf.end(), markerPairs[iRank].begin(), markerPairs[iRank].end());
+  }
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; iRank++) recvDisp[iRank+1] = recvDisp[iRank] + nRecv[iRank];
+
+  vector<unsigned long> recvBuf(recvDisp[size]);
+  SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     recvBuf.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<vector<unsigned short> > markers(nPoint);
+  for (unsigned long i = 0; i < recvBuf.size(); i += 2)
+    markers[recvBuf[i]-firstIndex].push_back(recvBuf[i+1]);
+
+  /*--- Graph of the linear partitioning, i.e. the input of ParMETIS. ---*/
+
+  vector<unsigned long> idx(nPoint), tags(nPoint), colors(nPoint);
+  vector<vector<unsigned long> > neighbors(nPoint);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    idx[iPoint] = firstIndex + iPoint;
+    tags[iPoint] = CMultiGridGraph::MarkerTag(markers[iPoint]);
+    colors[iPoint] = nodes->GetColor(iPoint);
+    neighbors[iPoint].assign(adjacency.begin()+xadj[iPoint], adjacency.begin()+xadj[iPoint+1]);
+  }
+
+  const CMultiGridGraph fineGraph(idx, move(tags), move(neighbors), [pointPartitioner](unsigned long iGlobal) {
+    return static_cast<int>(pointPartitioner.GetRankContainingIndex(iGlobal));
+  });
+
+  /*--- Agglomerate all the levels, as CMultiGridGeometry will, to find the seed of the control
+   volume of each level that contains each point. ---*/
+
+  vector<vector<unsigned long> > representative(config->GetnMGLevels());
+  auto graph = fineGraph;
+  auto seedOfLevel = idx;
+
+  for (unsigned short iMGLevel = 1; iMGLevel <= config->GetnMGLevels(); iMGLevel++) {
+    const auto seed = graph.Agglomerate();
+    seedOfLevel = graph.Query(seedOfLevel, seed);
+    representative[iMGLevel-1] = seedOfLevel;
+    if (iMGLevel < config->GetnMGLevels()) graph = graph.Coarsen(seed);
+  }
+
+  /*--- All the points take the color that ParMETIS gave to the seed of their coarsest control
+   volume. If that leaves a rank without points (the coarse control volumes are too large for
+   the number of ranks) the partitions are aligned with a finer level, the coarser levels are then
+   split between ranks and are no longer independent of the partitioning. ---*/
+
+  for (auto iMGLevel = config->GetnMGLevels(); iMGLevel > 0; iMGLevel--) {
+
+    const auto newColors = fineGraph.Query(representative[iMGLevel-1], colors);
+
+    vector<unsigned long> nPointRank(size, 0), Global_nPointRank(size, 0);
+    for (auto color : newColors) nPointRank[color]++;
+    SU2_MPI::Allreduce(nPointRank.data(), Global_nPointRank.data(), size, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    if (*min_element(Global_nPointRank.begin(), Global_nPointRank.end()) == 0) continue;
+
+    unsigned long nMoved = 0, Global_nMoved = 0;
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      nMoved += (newColors[iPoint] != colors[iPoint]);
+      nodes->SetColor(iPoint, newColors[iPoint]);
+    }
+    SU2_MPI::Reduce(&nMoved, &Global_nMoved, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+
+    if (rank == MASTER_NODE) {
+      cout << "Partitions aligned with multigrid level " << iMGLevel << " (";
+      cout << Global_nMoved << " points moved)." << endl;
+    }
+    return;
+  }
+
+  if (rank == MASTER_NODE)
+    cout << "WARNING: The multigrid levels are too coarse to align the partitions with them." << endl;
+
+#endif
+}
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig *config) {
 
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
@@ -10750,7 +10807,7 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig *config, bool original_surface,
 
 }
 
-std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig *config) const{
+std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig *config, SU2_MPI::Comm comm) const {
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
@@ -10832,7 +10889,7 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
   /*--------------------------------------------------------------------------*/
 
   std::unique_ptr<CADTElemClass> WallADT(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                                                           markerIDs, elemIDs, true));
+                                                           markerIDs, elemIDs, true, comm));
 
   return WallADT;
 
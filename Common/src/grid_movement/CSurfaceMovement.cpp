@@ -687,7 +687,7 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *confi
 
   su2double DV_Value = 0.0;
 
-  unsigned short iDV = 0, iDV_Value = 0;
+  unsigned short iDV = 0, iDV_Value = 0, iDir = 0;
 
   for (iDV = 0; iDV < config->GetnDV(); iDV++) {
     for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
@@ -695,13 +695,22 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *confi
       DV_Value = config->GetDV_Value(iDV, iDV_Value);
 
       /*--- If value of the design variable is not 0.0 we apply the differentation.
-      *     Note if multiple variables are non-zero, we end up with the sum of all the derivatives. ---*/
+      *     With vector mode each variable is assigned its own tangent direction. With a single direction,
+      *     if multiple variables are non-zero, we end up with the sum of all the derivatives. ---*/
 
       if (DV_Value != 0.0) {
 
+        if ((SU2_TYPE::nDirections > 1) && (iDir == SU2_TYPE::nDirections)) {
+          SU2_MPI::Error("DIRECT_DIFF= DESIGN_VARIABLES: More non-zero DV_VALUE than the tangent directions of the AD type.\n"
+                         "Please compile with more directions (meson.py ... -Dcodi-forward-dirs=N ...).",
+                         CURRENT_FUNCTION);
+        }
+
         DV_Value = 0.0;
 
-        SU2_TYPE::SetDerivative(DV_Value, 1.0);
+        SU2_TYPE::SetDerivative(DV_Value, 1.0, iDir);
+
+        if (SU2_TYPE::nDirections > 1) iDir++;
 
         config->SetDV_Value(iDV, iDV_Value, DV_Value);
       }
@@ -29,6 +29,7 @@
 #include "../../include/grid_movement/CVolumetricMovement.hpp"
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/toolboxes/CSymmetricMatrix.hpp"
 
 CVolumetricMovement::CVolumetricMovement(void) : CGridMovement(), System(true) {
 
@@ -53,12 +54,24 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
   if (config->GetVolumetric_Movement()){
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-    StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+    if (config->GetDeform_Method() == DEFORM_METHOD::ELASTICITY)
+      StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
   }
 }
 
 CVolumetricMovement::~CVolumetricMovement(void) { }
 
+bool CVolumetricMovement::SameGridAsAssembled(const CGeometry *geometry) const {
+
+  if (AssembledCoord.rows() != nPoint) return false;
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      if (AssembledCoord(iPoint,iDim) != SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint,iDim)))
+        return false;
+  return true;
+}
+
 void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config) {
 
   unsigned short iDim;
@@ -93,6 +106,7 @@ void CVolumetricMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config) {
   geometry->SetControlVolume(config, UPDATE);
   geometry->SetBoundControlVolume(config, UPDATE);
   geometry->SetMaxLength(config);
+  geometry->InvalidateLeastSquaresWeights();
 
 }
 
@@ -108,6 +122,7 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
     geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
     geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
     geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    geometry[iMGlevel]->InvalidateLeastSquaresWeights();
     if (config->GetGrid_Movement())
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
@@ -132,23 +147,77 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
   if (Derivative) Nonlinear_Iter = 1;
 
+  /*--- The RBF deformation interpolates the boundary displacements, no system is solved. ---*/
+
+  const bool RBF = (config->GetDeform_Method() == DEFORM_METHOD::RBF) && !Derivative;
+
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
    particular, the linear elasticity equations hold only for small deformations. ---*/
 
   for (auto iNonlinear_Iter = 0ul; iNonlinear_Iter < Nonlinear_Iter; iNonlinear_Iter++) {
 
+    if (RBF) {
+      if (config->GetDeform_Limit() < 1E6) {
+        su2double MinDistance, MaxDistance;
+        ComputeSolid_Wall_Distance(geometry, config, MinDistance, MaxDistance);
+      }
+
+      su2double MaxError = 0.0;
+      const auto nControl = SetRBF_Displacements(geometry, config, MaxError);
+
+      UpdateGridCoord(geometry, config);
+      if (UpdateGeo) { UpdateDualGrid(geometry, config); }
+
+      ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
+      ComputenNonconvexElements(geometry, Screen_Output);
+      Set_nIterMesh(0);
+
+      if (rank == MASTER_NODE && Screen_Output) {
+        cout << "Non-linear iter.: " << iNonlinear_Iter+1 << "/" << Nonlinear_Iter  << ". RBF control points: " << nControl << ". ";
+        if (nDim == 2) cout << "Min. area: " << MinVolume << ". Error: " << MaxError << "." << endl;
+        else cout << "Min. volume: " << MinVolume << ". Error: " << MaxError << "." << endl;
+      }
+      continue;
+    }
+
+    /*--- The stiffness matrix (with the boundary conditions) and its preconditioner are reused if
+     the grid is the one for which they were assembled, i.e. when the reference grid is restored and
+     deformed again (convexity check of SU2_DEF). The previous displacements are the initial guess. ---*/
+
+    const bool canReuse = config->GetDeform_ReuseSystem() && (iNonlinear_Iter == 0) && !Derivative &&
+                          !AD::TapeActive() && (config->GetDirectDiff() == NO_DERIVATIVE);
+    const bool reuse = canReuse && SameGridAsAssembled(geometry);
+    if (iNonlinear_Iter == 0) SystemReused = reuse;
+
     /*--- Initialize vector and sparse matrix ---*/
 
-    LinSysSol.SetValZero();
+    if (!canReuse) LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
 
-    /*--- Compute the stiffness matrix entries for all nodes/elements in the
-     mesh. FEA uses a finite element method discretization of the linear
-     elasticity equations (transfers element stiffnesses to point-to-point). ---*/
+    if (reuse) {
+      MinVolume = AssembledMinVolume;
+    }
+    else {
+      StiffMatrix.SetValZero();
+
+      /*--- Compute the stiffness matrix entries for all nodes/elements in the
+       mesh. FEA uses a finite element method discretization of the linear
+       elasticity equations (transfers element stiffnesses to point-to-point). ---*/
 
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+      MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+
+      if (canReuse) {
+        AssembledCoord.resize(nPoint, nDim);
+        for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+          for (auto iDim = 0u; iDim < nDim; iDim++)
+            AssembledCoord(iPoint,iDim) = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint,iDim));
+        AssembledMinVolume = MinVolume;
+      }
+      else {
+        AssembledCoord.resize(0, 0);
+      }
+    }
 
     /*--- Set the boundary and volume displacements (as prescribed by the
      design variable perturbations controlling the surface shape)
@@ -160,43 +229,53 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
     SetDomainDisplacements(geometry, config);
 
-    /*--- Set the boundary derivatives (overrides the actual displacements) ---*/
+    /*--- Definition of the preconditioner matrix vector multiplication, and linear solver ---*/
 
-    if (Derivative) { SetBoundaryDerivatives(geometry, config); }
+    /*--- To keep legacy behavior ---*/
+    System.SetToleranceType(LinearToleranceType::RELATIVE);
+    System.SetReusePreconditioner(reuse);
 
-    /*--- Communicate any prescribed boundary displacements via MPI,
-     so that all nodes have the same solution and r.h.s. entries
-     across all partitions. ---*/
+    /*--- For the direct derivatives one system is solved per tangent direction of the AD type. ---*/
 
-    CSysMatrixComms::Initiate(LinSysSol, geometry, config);
-    CSysMatrixComms::Complete(LinSysSol, geometry, config);
+    const bool directDeriv = Derivative && (config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD);
+    su2double Residual = 0.0;
 
-    CSysMatrixComms::Initiate(LinSysRes, geometry, config);
-    CSysMatrixComms::Complete(LinSysRes, geometry, config);
+    for (auto iDir = 0u; iDir < (directDeriv? SU2_TYPE::nDirections : 1u); iDir++) {
 
-    /*--- Definition of the preconditioner matrix vector multiplication, and linear solver ---*/
+      /*--- Set the boundary derivatives (overrides the actual displacements) ---*/
 
-    /*--- To keep legacy behavior ---*/
-    System.SetToleranceType(LinearToleranceType::RELATIVE);
+      if (Derivative) { SetBoundaryDerivatives(geometry, config, iDir); }
 
-    /*--- If we want no derivatives or the direct derivatives, we solve the system using the
-     * normal matrix vector product and preconditioner. For the mesh sensitivities using
-     * the discrete adjoint method we solve the system using the transposed matrix. ---*/
-    if (!Derivative || ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) && Derivative)) {
+      /*--- Communicate any prescribed boundary displacements via MPI,
+       so that all nodes have the same solution and r.h.s. entries
+       across all partitions. ---*/
 
-      Tot_Iter = System.Solve(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+      CSysMatrixComms::Initiate(LinSysSol, geometry, config);
+      CSysMatrixComms::Complete(LinSysSol, geometry, config);
 
-    } else if (Derivative && (config->GetKind_SU2() == SU2_COMPONENT::SU2_DOT)) {
+      CSysMatrixComms::Initiate(LinSysRes, geometry, config);
+      CSysMatrixComms::Complete(LinSysRes, geometry, config);
 
-      Tot_Iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
-    }
-    su2double Residual = System.GetResidual();
+      /*--- If we want no derivatives or the direct derivatives, we solve the system using the
+       * normal matrix vector product and preconditioner. For the mesh sensitivities using
+       * the discrete adjoint method we solve the system using the transposed matrix. ---*/
+      if (!Derivative || directDeriv) {
+
+        Tot_Iter = System.Solve(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+
+      } else if (Derivative && (config->GetKind_SU2() == SU2_COMPONENT::SU2_DOT)) {
+
+        Tot_Iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+      }
+      Residual = System.GetResidual();
 
-    /*--- Update the grid coordinates and cell volumes using the solution
-     of the linear system (usol contains the x, y, z displacements). ---*/
+      /*--- Update the grid coordinates and cell volumes using the solution
+       of the linear system (usol contains the x, y, z displacements). ---*/
+
+      if (!Derivative) { UpdateGridCoord(geometry, config); }
+      else { UpdateGridCoord_Derivatives(geometry, config, iDir); }
+    }
 
-    if (!Derivative) { UpdateGridCoord(geometry, config); }
-    else { UpdateGridCoord_Derivatives(geometry, config); }
     if (UpdateGeo) { UpdateDualGrid(geometry, config); }
 
     if (!Derivative) {
@@ -462,21 +541,10 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config) {
 
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = nullptr, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0, ElemDistance = 0.0;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
 
   bool Screen_Output  = config->GetDeform_Output();
-
-  /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
-
-  if (nDim == 2) StiffMatrix_nElem = 8;
-  else StiffMatrix_nElem = 24;
-
-  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+  const bool wallDistance = (config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE);
 
   /*--- Compute min volume in the entire mesh. ---*/
 
@@ -486,53 +554,139 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
   /*--- Compute the distance to the nearest surface if needed
    as part of the stiffness calculation.. ---*/
 
-  if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE) ||
-      (config->GetDeform_Limit() < 1E6)) {
+  if (wallDistance || (config->GetDeform_Limit() < 1E6)) {
     ComputeSolid_Wall_Distance(geometry, config, MinDistance, MaxDistance);
     if (rank == MASTER_NODE && Screen_Output) cout <<"Min. distance: "<< MinDistance <<", max. distance: "<< MaxDistance <<"." << endl;
   }
 
-  /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
+  /*--- The scatter map from elements to matrix blocks is built once. ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  if (ElemBlockPtr.empty()) SetElemScatterMap(geometry);
 
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    nNodes = 8;
+  /*--- The element matrices are cached when they are not being differentiated. An element
+   is only recomputed if its corners (or wall distance) changed since it was last computed. ---*/
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+  const bool cache = config->GetDeform_CacheStiffness() && !AD::TapeActive() &&
+                     (config->GetDirectDiff() == NO_DERIVATIVE);
+  const auto blockSize = nVar*nVar;
+
+  if (cache && ElemStiffness.empty()) {
+    ElemStiffness.resize(ElemBlocks.size()*blockSize);
+    ElemCacheKey.resize(geometry->GetnElem(), 8*nDim+1);
+    ElemCacheKey = std::numeric_limits<passivedouble>::quiet_NaN();
+  }
+
+  /*--- Compute contributions from each element by forming the stiffness matrix (FEA).
+   Elements of the same color do not share nodes, thus they can be added in parallel. ---*/
+
+  const auto& coloring = geometry->GetElementColoring();
+  const auto nColor = coloring.getOuterSize();
+
+  SU2_OMP_PARALLEL
+  {
+  /*--- Maximum size (quadrilateral and hexahedron). ---*/
+
+  su2double StiffMatrix_Data[24][24], *StiffMatrix_Elem[24];
+  for (unsigned short iVar = 0; iVar < 24; iVar++)
+    StiffMatrix_Elem[iVar] = StiffMatrix_Data[iVar];
+
+  for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+
+    const auto colorSize = coloring.getNumNonZeros(iColor);
+    const auto colorElems = coloring.innerIdx(iColor);
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, geometry->GetElementColorGroupSize()))
+    for (auto k = 0ul; k < colorSize; ++k) {
+
+      const auto iElem = colorElems[k];
+      const unsigned short nNodes = geometry->elem[iElem]->GetnNodes();
+
+      unsigned long PointCorners[8];
+      su2double CoordCorners[8][3];
+
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        PointCorners[iNode] = geometry->elem[iElem]->GetNode(iNode);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          CoordCorners[iNode][iDim] = geometry->nodes->GetCoord(PointCorners[iNode], iDim);
+        }
       }
-    }
 
-    /*--- Extract Element volume and distance to compute the stiffness ---*/
+      /*--- Extract element distance to compute the stiffness ---*/
 
-    ElemVolume = geometry->elem[iElem]->GetVolume();
+      su2double ElemDistance = 0.0;
+      if (wallDistance) {
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+          ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNode]);
+        ElemDistance = ElemDistance/(su2double)nNodes;
+      }
 
-    if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
-      ElemDistance = 0.0;
-      for (iNodes = 0; iNodes < nNodes; iNodes++)
-        ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
-      ElemDistance = ElemDistance/(su2double)nNodes;
-    }
+      /*--- Compare with (and update) the key of the cached matrix. ---*/
+
+      bool recompute = true;
+      if (cache) {
+        recompute = false;
+        auto key = ElemCacheKey[iElem];
+        unsigned short iKey = 0;
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const auto val = SU2_TYPE::GetValue(CoordCorners[iNode][iDim]);
+            recompute |= (key[iKey] != val);
+            key[iKey++] = val;
+          }
+        }
+        const auto val = SU2_TYPE::GetValue(ElemDistance);
+        recompute |= (key[iKey] != val);
+        key[iKey] = val;
+      }
 
-    if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
-    if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+      if (recompute) {
+        const su2double ElemVolume = geometry->elem[iElem]->GetVolume();
 
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+        if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+        if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
+      }
 
-  }
+      /*--- Transform the element stiffness matrix into the contributions for the
+       individual nodes relative to each other, and add them to the global matrix. ---*/
 
-  /*--- Deallocate memory and exit ---*/
+      const auto blocks = &ElemBlocks[ElemBlockPtr[iElem]];
+      const auto stored = cache? &ElemStiffness[ElemBlockPtr[iElem]*blockSize] : nullptr;
 
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    delete [] StiffMatrix_Elem[iVar];
-  delete [] StiffMatrix_Elem;
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        for (unsigned short jNode = 0; jNode < nNodes; jNode++) {
+
+          const auto iBlock = iNode*nNodes + jNode;
+          const auto stored_ij = cache? &stored[iBlock*blockSize] : nullptr;
+
+          if (cache && recompute) {
+            for (unsigned short iDim = 0; iDim < nVar; iDim++)
+              for (unsigned short jDim = 0; jDim < nVar; jDim++)
+                stored_ij[iDim*nVar+jDim] = SU2_TYPE::GetValue(StiffMatrix_Elem[iNode*nVar+iDim][jNode*nVar+jDim]);
+          }
+
+          auto mat_ij = blocks[iBlock];
+          if (mat_ij == nullptr) continue;
+
+          /*--- Without the cache the tangents are kept if the matrix is of the AD type (direct differentiation). ---*/
+
+          for (unsigned short iDim = 0; iDim < nVar; iDim++) {
+            for (unsigned short jDim = 0; jDim < nVar; jDim++) {
+              if (cache) {
+                mat_ij[iDim*nVar+jDim] += stored_ij[iDim*nVar+jDim];
+              }
+              else {
+                const auto& val = StiffMatrix_Elem[iNode*nVar+iDim][jNode*nVar+jDim];
+                mat_ij[iDim*nVar+jDim] += CSysMatrix<MatrixType>::template ActiveAssign<MatrixType>(val);
+              }
+            }
+          }
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  }
+  END_SU2_OMP_PARALLEL
 
   return MinVolume;
 
@@ -1518,43 +1672,37 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
 
 }
 
-void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes) {
-
-  unsigned short iVar, jVar, iDim, jDim;
+void CVolumetricMovement::SetElemScatterMap(const CGeometry *geometry) {
 
-  unsigned short nVar = geometry->GetnDim();
+  const auto nElem = geometry->GetnElem();
 
-  su2double **StiffMatrix_Node;
-  StiffMatrix_Node = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    StiffMatrix_Node[iVar] = new su2double [nVar];
-
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++)
-      StiffMatrix_Node[iVar][jVar] = 0.0;
+  ElemBlockPtr.resize(nElem+1);
+  ElemBlockPtr[0] = 0;
+  for (auto iElem = 0ul; iElem < nElem; iElem++) {
+    const auto nNodes = geometry->elem[iElem]->GetnNodes();
+    ElemBlockPtr[iElem+1] = ElemBlockPtr[iElem] + nNodes*nNodes;
+  }
 
-  /*--- Transform the stiffness matrix for the hexahedral element into the
-   contributions for the individual nodes relative to each other. ---*/
+  ElemBlocks.resize(ElemBlockPtr[nElem]);
 
-  for (iVar = 0; iVar < nNodes; iVar++) {
-    for (jVar = 0; jVar < nNodes; jVar++) {
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+      const auto nNodes = geometry->elem[iElem]->GetnNodes();
+      auto blocks = &ElemBlocks[ElemBlockPtr[iElem]];
 
-      for (iDim = 0; iDim < nVar; iDim++) {
-        for (jDim = 0; jDim < nVar; jDim++) {
-          StiffMatrix_Node[iDim][jDim] = StiffMatrix_Elem[(iVar*nVar)+iDim][(jVar*nVar)+jDim];
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        const auto iPoint = geometry->elem[iElem]->GetNode(iNode);
+        for (unsigned short jNode = 0; jNode < nNodes; jNode++) {
+          const auto jPoint = geometry->elem[iElem]->GetNode(jNode);
+          blocks[iNode*nNodes+jNode] = StiffMatrix.GetBlock(iPoint, jPoint);
         }
       }
-
-      StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
-
     }
+    END_SU2_OMP_FOR
   }
-
-  /*--- Deallocate memory and exit ---*/
-
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] StiffMatrix_Node[iVar];
-  delete [] StiffMatrix_Node;
+  END_SU2_OMP_PARALLEL
 
 }
 
@@ -1562,7 +1710,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
 
   unsigned short iDim, nDim = geometry->GetnDim(), iMarker, axis = 0;
   unsigned long iPoint, total_index, iVertex;
-  su2double *VarCoord, MeanCoord[3] = {0.0,0.0,0.0}, VarIncrement = 1.0;
+  su2double *VarCoord, VarIncrement = 1.0;
 
   /*--- Get the SU2 module. SU2_CFD will use this routine for dynamically
    deforming meshes (MARKER_MOVING), while SU2_DEF will use it for deforming
@@ -1621,31 +1769,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE) ) {
 
-      su2double *Coord_0 = nullptr;
-
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = 0.0;
-
-      /*--- Store the coord of the first point to help identify the axis. ---*/
-
-      iPoint  = geometry->vertex[iMarker][0]->GetNode();
-      Coord_0 = geometry->nodes->GetCoord(iPoint);
-
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->nodes->GetCoord(iPoint);
-        for (iDim = 0; iDim < nDim; iDim++)
-          MeanCoord[iDim] += (VarCoord[iDim]-Coord_0[iDim])*(VarCoord[iDim]-Coord_0[iDim]);
-      }
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
-      if (nDim==3) {
-        if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
-        if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
-      }
-      else {
-        if ((MeanCoord[0] <= MeanCoord[1]) ) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0]) ) axis = 1;
-      }
+      axis = GetSymmetryAxis(geometry, iMarker);
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
         iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
@@ -1692,7 +1816,35 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
 
 }
 
-void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *config) {
+unsigned short CVolumetricMovement::GetSymmetryAxis(const CGeometry *geometry, unsigned short iMarker) const {
+
+  unsigned short iDim, axis = 0;
+  su2double MeanCoord[3] = {0.0,0.0,0.0};
+
+  /*--- Store the coord of the first point to help identify the axis. ---*/
+
+  const su2double *Coord_0 = geometry->nodes->GetCoord(geometry->vertex[iMarker][0]->GetNode());
+
+  for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+    const su2double *Coord = geometry->nodes->GetCoord(geometry->vertex[iMarker][iVertex]->GetNode());
+    for (iDim = 0; iDim < nDim; iDim++)
+      MeanCoord[iDim] += (Coord[iDim]-Coord_0[iDim])*(Coord[iDim]-Coord_0[iDim]);
+  }
+  for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
+  if (nDim==3) {
+    if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
+    if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
+    if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
+  }
+  else {
+    if ((MeanCoord[0] <= MeanCoord[1]) ) axis = 0;
+    if ((MeanCoord[1] <= MeanCoord[0]) ) axis = 1;
+  }
+  return axis;
+
+}
+
+void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *config, unsigned short iDir) {
   unsigned short iDim, iMarker;
   unsigned long iPoint, total_index, iVertex;
 
@@ -1706,8 +1858,8 @@ void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *c
           VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
           for (iDim = 0; iDim < nDim; iDim++) {
             total_index = iPoint*nDim + iDim;
-            LinSysRes[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim]);
-            LinSysSol[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim]);
+            LinSysRes[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim], iDir);
+            LinSysSol[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim], iDir);
           }
         }
       }
@@ -1725,7 +1877,7 @@ void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *c
   }
 }
 
-void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config) {
+void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config, unsigned short iDir) {
   unsigned short iDim, iMarker;
   unsigned long iPoint, total_index, iVertex;
   su2double *new_coord = new su2double[3];
@@ -1740,7 +1892,7 @@ void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConf
       for (iDim = 0; iDim < nDim; iDim++) {
         total_index = iPoint*nDim + iDim;
         new_coord[iDim] = geometry->nodes->GetCoord(iPoint, iDim);
-        SU2_TYPE::SetDerivative(new_coord[iDim], SU2_TYPE::GetValue(LinSysSol[total_index]));
+        SU2_TYPE::SetDerivative(new_coord[iDim], SU2_TYPE::GetValue(LinSysSol[total_index]), iDir);
       }
       geometry->nodes->SetCoord(iPoint, new_coord);
     }
@@ -1807,6 +1959,304 @@ void CVolumetricMovement::SetDomainDisplacements(CGeometry *geometry, CConfig *c
 
 }
 
+unsigned long CVolumetricMovement::SetRBF_Displacements(CGeometry *geometry, CConfig *config, su2double &MaxError) {
+
+  const auto Kind_SU2 = config->GetKind_SU2();
+  const auto nMarker = config->GetnMarker_All();
+  const passivedouble VarIncrement = 1.0 / config->GetGridDef_Nonlinear_Iter();
+
+  MaxError = 0.0;
+
+  /*--- Prescribed displacements of the boundary points, with the same conditions as in
+   SetBoundaryDisplacements. Symmetry planes are free, the normal displacement is removed
+   after the interpolation. ---*/
+
+  LinSysSol.SetValZero();
+  vector<bool> prescribed(nPoint, false);
+
+  auto setMarker = [&](unsigned short iMarker, bool moving) {
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        LinSysSol(iPoint,iDim) = moving? SU2_TYPE::GetValue(VarCoord[iDim]) * VarIncrement : 0.0;
+      prescribed[iPoint] = true;
+    }
+  };
+
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    const auto KindBC = config->GetMarker_All_KindBC(iMarker);
+    if ((KindBC != SYMMETRY_PLANE) && (KindBC != SEND_RECEIVE) && (KindBC != INTERNAL_BOUNDARY))
+      setMarker(iMarker, false);
+  }
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    if (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD)) ||
+        ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_DEF)))
+      setMarker(iMarker, true);
+  }
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) setMarker(iMarker, false);
+  }
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    if ((config->GetMarker_All_ZoneInterface(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD))
+      setMarker(iMarker, true);
+  }
+
+  /*--- The boundary points owned by each rank are gathered on all ranks, they are the
+   candidate control points (each rank evaluates the error at its own candidates). ---*/
+
+  const auto stride = 2*nDim;
+  vector<su2double> localData;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    if (!prescribed[iPoint]) continue;
+    for (auto iDim = 0u; iDim < nDim; iDim++) localData.push_back(geometry->nodes->GetCoord(iPoint, iDim));
+    for (auto iDim = 0u; iDim < nDim; iDim++) localData.push_back(LinSysSol(iPoint,iDim));
+  }
+
+  const int nLocalData = localData.size();
+  vector<int> recvCounts(size), displs(size, 0);
+  SU2_MPI::Allgather(&nLocalData, 1, MPI_INT, recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 1; iRank < size; iRank++) displs[iRank] = displs[iRank-1] + recvCounts[iRank-1];
+
+  vector<su2double> globalData(displs[size-1] + recvCounts[size-1]);
+  SU2_MPI::Allgatherv(localData.data(), nLocalData, MPI_DOUBLE, globalData.data(),
+                      recvCounts.data(), displs.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+  const unsigned long nCand = globalData.size() / stride;
+  const unsigned long candBegin = displs[rank] / stride;
+  const unsigned long candEnd = candBegin + recvCounts[rank] / stride;
+
+  su2passivematrix candCoord(nCand, nDim), candDisp(nCand, nDim);
+  for (auto iCand = 0ul; iCand < nCand; iCand++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      candCoord(iCand,iDim) = SU2_TYPE::GetValue(globalData[iCand*stride + iDim]);
+      candDisp(iCand,iDim) = SU2_TYPE::GetValue(globalData[iCand*stride + nDim + iDim]);
+    }
+  }
+
+  /*--- Largest displacement (first control point) and bounding box of the moving points. ---*/
+
+  passivedouble maxDisp = 0.0, boxMin[3] = {0.0}, boxMax[3] = {0.0};
+  unsigned long firstControl = 0;
+  bool emptyBox = true;
+
+  for (auto iCand = 0ul; iCand < nCand; iCand++) {
+    const auto disp = GeometryToolbox::Norm(nDim, candDisp[iCand]);
+    if (disp == 0.0) continue;
+    if (disp > maxDisp) { maxDisp = disp; firstControl = iCand; }
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      boxMin[iDim] = emptyBox? candCoord(iCand,iDim) : min(boxMin[iDim], candCoord(iCand,iDim));
+      boxMax[iDim] = emptyBox? candCoord(iCand,iDim) : max(boxMax[iDim], candCoord(iCand,iDim));
+    }
+    emptyBox = false;
+  }
+
+  if (maxDisp == 0.0) return 0;
+
+  passivedouble radius = SU2_TYPE::GetValue(config->GetDeform_RBF_Radius());
+  if (radius <= 0.0) radius = max(GeometryToolbox::Distance(nDim, boxMin, boxMax), 10*maxDisp);
+
+  /*--- Wendland C2 function (see CRadialBasisFunction), the compact support is what allows the
+   fast evaluation below and keeps the interpolation matrix positive definite. ---*/
+
+  auto kernel = [radius](passivedouble dist) {
+    const passivedouble r = dist / radius;
+    return (r < 1.0)? pow(1.0-r, 4) * (4.0*r + 1.0) : 0.0;
+  };
+
+  /*--- Greedy selection of the control points. The interpolation is computed with the points
+   selected so far, and the points with largest error are added, until the error at all
+   candidates is small enough. The number of points added per step grows with the size of
+   the set, which bounds the number of (dense) factorizations. ---*/
+
+  const passivedouble tol = SU2_TYPE::GetValue(config->GetDeform_RBF_Tolerance()) * maxDisp;
+  const auto maxControl = min<unsigned long>(config->GetDeform_RBF_MaxPoints(), nCand);
+
+  vector<unsigned long> control = {firstControl};
+  vector<bool> isControl(nCand, false);
+  isControl[firstControl] = true;
+
+  su2passivematrix coeff;
+  vector<passivedouble> error(candEnd - candBegin);
+
+  while (true) {
+
+    /*--- Interpolation coefficients of the current set. ---*/
+
+    const auto nControl = control.size();
+    CSymmetricMatrix interpMat(nControl);
+    su2passivematrix controlDisp(nControl, nDim);
+
+    for (auto i = 0ul; i < nControl; i++) {
+      for (auto j = 0ul; j <= i; j++)
+        interpMat(i,j) = kernel(GeometryToolbox::Distance(nDim, candCoord[control[i]], candCoord[control[j]]));
+      for (auto iDim = 0u; iDim < nDim; iDim++) controlDisp(i,iDim) = candDisp(control[i],iDim);
+    }
+    interpMat.Invert(true);
+    interpMat.MatMatMult('L', controlDisp, coeff);
+
+    /*--- Interpolation error at the candidates of this rank. ---*/
+
+    SU2_OMP_PARALLEL
+    {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto iCand = candBegin; iCand < candEnd; iCand++) {
+        passivedouble disp[3] = {0.0};
+        for (auto i = 0ul; i < nControl; i++) {
+          const auto phi = kernel(GeometryToolbox::Distance(nDim, candCoord[iCand], candCoord[control[i]]));
+          for (auto iDim = 0u; iDim < nDim; iDim++) disp[iDim] += phi * coeff(i,iDim);
+        }
+        error[iCand-candBegin] = isControl[iCand]? 0.0 : GeometryToolbox::Distance(nDim, disp, candDisp[iCand]);
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+
+    su2double localMax = 0.0, globalMax = 0.0;
+    for (auto err : error) localMax = max<su2double>(localMax, err);
+    SU2_MPI::Allreduce(&localMax, &globalMax, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    MaxError = globalMax;
+
+    if ((globalMax <= tol) || (nControl >= maxControl)) break;
+
+    /*--- Each rank proposes its worst candidates, the worst overall are added. ---*/
+
+    const auto nAdd = min(max<unsigned long>(1, nControl/8), maxControl-nControl);
+
+    vector<unsigned long> order(error.size());
+    iota(order.begin(), order.end(), 0ul);
+    const auto nPropose = min<unsigned long>(nAdd, order.size());
+    partial_sort(order.begin(), order.begin()+nPropose, order.end(),
+                 [&](unsigned long a, unsigned long b) { return error[a] > error[b]; });
+
+    vector<su2double> sendError(nAdd, -1.0), recvError(nAdd*size);
+    vector<unsigned long> sendIdx(nAdd, 0), recvIdx(nAdd*size);
+    for (auto i = 0ul; i < nPropose; i++) {
+      sendError[i] = error[order[i]];
+      sendIdx[i] = candBegin + order[i];
+    }
+    SU2_MPI::Allgather(sendError.data(), nAdd, MPI_DOUBLE, recvError.data(), nAdd, MPI_DOUBLE, SU2_MPI::GetComm());
+    SU2_MPI::Allgather(sendIdx.data(), nAdd, MPI_UNSIGNED_LONG, recvIdx.data(), nAdd, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+    order.resize(recvError.size());
+    iota(order.begin(), order.end(), 0ul);
+    sort(order.begin(), order.end(), [&](unsigned long a, unsigned long b) {
+      return (recvError[a] != recvError[b])? (recvError[a] > recvError[b]) : (recvIdx[a] < recvIdx[b]);
+    });
+    for (auto i = 0ul; i < nAdd; i++) {
+      const auto iCand = recvIdx[order[i]];
+      if ((recvError[order[i]] <= tol) || isControl[iCand]) break;
+      control.push_back(iCand);
+      isControl[iCand] = true;
+    }
+  }
+
+  /*--- Cell list of the control points, with cells of the size of the support radius only the
+   control points in the 3^nDim cells around a point can influence it. Points that are farther
+   than the radius from all control points do not move. ---*/
+
+  const auto nControl = control.size();
+  passivedouble cellMin[3] = {0.0};
+  long nCell[3] = {1, 1, 1};
+
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    passivedouble maxCoord = candCoord(control[0],iDim);
+    cellMin[iDim] = maxCoord;
+    for (auto iControl : control) {
+      cellMin[iDim] = min(cellMin[iDim], candCoord(iControl,iDim));
+      maxCoord = max(maxCoord, candCoord(iControl,iDim));
+    }
+    nCell[iDim] = floor((maxCoord-cellMin[iDim]) / radius) + 1;
+  }
+
+  auto cellKey = [&](const long* idx) {
+    unsigned long key = 0;
+    for (int iDim = nDim-1; iDim >= 0; iDim--) key = key*nCell[iDim] + idx[iDim];
+    return key;
+  };
+
+  vector<pair<unsigned long, unsigned long> > cells(nControl);
+  for (auto i = 0ul; i < nControl; i++) {
+    long idx[3] = {0};
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      idx[iDim] = min<long>(floor((candCoord(control[i],iDim)-cellMin[iDim]) / radius), nCell[iDim]-1);
+    cells[i] = make_pair(cellKey(idx), i);
+  }
+  sort(cells.begin(), cells.end());
+
+  const int nNeighbor = (nDim == 2)? 9 : 27;
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      if (prescribed[iPoint]) continue;
+
+      passivedouble coord[3] = {0.0}, disp[3] = {0.0};
+      long idx[3] = {0};
+      bool outside = false;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        coord[iDim] = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+        idx[iDim] = floor((coord[iDim]-cellMin[iDim]) / radius);
+        outside |= (idx[iDim] < -1) || (idx[iDim] > nCell[iDim]);
+      }
+      if (outside) continue;
+
+      for (int iNeighbor = 0; iNeighbor < nNeighbor; iNeighbor++) {
+        long jdx[3] = {0};
+        bool valid = true;
+        for (int iDim = 0, rem = iNeighbor; iDim < nDim; iDim++, rem /= 3) {
+          jdx[iDim] = idx[iDim] + rem%3 - 1;
+          valid &= (jdx[iDim] >= 0) && (jdx[iDim] < nCell[iDim]);
+        }
+        if (!valid) continue;
+
+        const auto key = cellKey(jdx);
+        auto it = lower_bound(cells.begin(), cells.end(), make_pair(key, 0ul));
+        for (; (it != cells.end()) && (it->first == key); ++it) {
+          const auto i = it->second;
+          const auto phi = kernel(GeometryToolbox::Distance(nDim, coord, candCoord[control[i]]));
+          for (auto iDim = 0u; iDim < nDim; iDim++) disp[iDim] += phi * coeff(i,iDim);
+        }
+      }
+      for (auto iDim = 0u; iDim < nDim; iDim++) LinSysSol(iPoint,iDim) = disp[iDim];
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Remove the normal displacement on symmetry planes. ---*/
+
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE) {
+      const auto axis = GetSymmetryAxis(geometry, iMarker);
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        LinSysSol(geometry->vertex[iMarker][iVertex]->GetNode(), axis) = 0.0;
+    }
+  }
+
+  /*--- Points held fixed (see SetDomainDisplacements). ---*/
+
+  if (config->GetHold_GridFixed() || (config->GetDeform_Limit() < 1E6)) {
+    const auto MinCoordValues = config->GetHold_GridFixed_Coord();
+    const auto MaxCoordValues = &config->GetHold_GridFixed_Coord()[3];
+
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      const bool fixedByLimit = (config->GetDeform_Limit() < 1E6) &&
+                                (geometry->nodes->GetWall_Distance(iPoint) >= config->GetDeform_Limit());
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        const auto Coord = geometry->nodes->GetCoord(iPoint, iDim);
+        const bool fixedByBox = config->GetHold_GridFixed() &&
+                                ((Coord < MinCoordValues[iDim]) || (Coord > MaxCoordValues[iDim]));
+        if (fixedByLimit || fixedByBox) LinSysSol(iPoint,iDim) = 0.0;
+      }
+    }
+  }
+
+  return nControl;
+
+}
+
 void CVolumetricMovement::Rigid_Rotation(CGeometry *geometry, CConfig *config,
                                          unsigned short iZone, unsigned long iter) {
 
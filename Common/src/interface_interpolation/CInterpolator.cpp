@@ -31,30 +31,32 @@
 
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 
 CInterpolator::CInterpolator(CGeometry**** geometry_container, const CConfig* const* config, unsigned int iZone,
-                             unsigned int jZone)
-    : rank(SU2_MPI::GetRank()),
-      size(SU2_MPI::GetSize()),
+                             unsigned int jZone, SU2_MPI::Comm comm)
+    : comm(comm),
+      rank(SU2_MPI::GetRank(comm)),
+      size(SU2_MPI::GetSize(comm)),
       donorZone(iZone),
       targetZone(jZone),
       Geometry(geometry_container),
       donor_geometry(geometry_container[iZone][INST_0][MESH_0]),
       target_geometry(geometry_container[jZone][INST_0][MESH_0]) {}
 
-bool CInterpolator::CheckInterfaceBoundary(int markDonor, int markTarget) {
+bool CInterpolator::CheckInterfaceBoundary(int markDonor, int markTarget, SU2_MPI::Comm comm) {
   /*--- Determine whether the boundary is not on the rank because of
    *    the partition or because it is not part of the zone. ---*/
   int donorCheck = -1, targetCheck = -1;
-  SU2_MPI::Allreduce(&markDonor, &donorCheck, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&markTarget, &targetCheck, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&markDonor, &donorCheck, 1, MPI_INT, MPI_MAX, comm);
+  SU2_MPI::Allreduce(&markTarget, &targetCheck, 1, MPI_INT, MPI_MAX, comm);
   return (donorCheck != -1) && (targetCheck != -1);
 }
 
-bool CInterpolator::CheckZonesInterface(const CConfig* donor, const CConfig* target) {
+bool CInterpolator::CheckZonesInterface(const CConfig* donor, const CConfig* target, SU2_MPI::Comm comm) {
   /*--- Loop over all interface markers to find if the 2 zones share any interface boundary. ---*/
   for (auto iInter = 0; iInter < (donor->GetMarker_n_ZoneInterface() / 2); iInter++) {
-    if (CheckInterfaceBoundary(donor->FindInterfaceMarker(iInter), target->FindInterfaceMarker(iInter))) return true;
+    if (CheckInterfaceBoundary(donor->FindInterfaceMarker(iInter), target->FindInterfaceMarker(iInter), comm)) return true;
   }
   return false;
 }
@@ -71,9 +73,9 @@ void CInterpolator::Determine_ArraySize(int markDonor, int markTarget, unsigned
   Buffer_Send_nVertex_Donor[0] = nLocalVertex_Donor;
 
   /*--- Send Interface vertex information --*/
-  SU2_MPI::Allreduce(&nLocalVertex_Donor, &MaxLocalVertex_Donor, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&nLocalVertex_Donor, &MaxLocalVertex_Donor, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm);
   SU2_MPI::Allgather(Buffer_Send_nVertex_Donor, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex_Donor, 1,
-                     MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+                     MPI_UNSIGNED_LONG, comm);
 }
 
 void CInterpolator::Collect_VertexInfo(int markDonor, int markTarget, unsigned long nVertexDonor, unsigned short nDim) {
@@ -94,9 +96,9 @@ void CInterpolator::Collect_VertexInfo(int markDonor, int markTarget, unsigned l
   }
 
   SU2_MPI::Allgather(Buffer_Send_Coord.data(), MaxLocalVertex_Donor * nDim, MPI_DOUBLE, Buffer_Receive_Coord.data(),
-                     MaxLocalVertex_Donor * nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+                     MaxLocalVertex_Donor * nDim, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(Buffer_Send_GlobalPoint.data(), MaxLocalVertex_Donor, MPI_UNSIGNED_LONG,
-                     Buffer_Receive_GlobalPoint.data(), MaxLocalVertex_Donor, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+                     Buffer_Receive_GlobalPoint.data(), MaxLocalVertex_Donor, MPI_UNSIGNED_LONG, comm);
 }
 
 unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short nDim, bool compress,
@@ -108,7 +110,7 @@ unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short n
   if (markDonor != -1) nElemDonor = donor_geometry->GetnElem_Bound(markDonor);
 
   allNumElem.resize(size);
-  SU2_MPI::Allgather(&nElemDonor, 1, MPI_UNSIGNED_LONG, allNumElem.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(&nElemDonor, 1, MPI_UNSIGNED_LONG, allNumElem.data(), 1, MPI_UNSIGNED_LONG, comm);
 
   auto nMaxElemDonor = *max_element(allNumElem.begin(), allNumElem.end());
 
@@ -131,9 +133,9 @@ unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short n
   }
 
   SU2_MPI::Allgather(bufferSendNum.data(), bufferSendNum.size(), MPI_UNSIGNED_SHORT, numNodes.data(),
-                     bufferSendNum.size(), MPI_UNSIGNED_SHORT, SU2_MPI::GetComm());
+                     bufferSendNum.size(), MPI_UNSIGNED_SHORT, comm);
   SU2_MPI::Allgather(bufferSendIdx.data(), bufferSendIdx.size(), MPI_LONG, idxNodes.data(), bufferSendIdx.size(),
-                     MPI_LONG, SU2_MPI::GetComm());
+                     MPI_LONG, comm);
 
   if (!compress) return accumulate(allNumElem.begin(), allNumElem.end(), 0ul);
 
@@ -252,8 +254,8 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker)
 
   /*--- Allocate global arrays. ---*/
   unsigned long nGlobalLinkedNodes;
-  SU2_MPI::Allreduce(&nLocalVertex, &nGlobalVertex, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&nLocalLinkedNodes, &nGlobalLinkedNodes, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&nLocalVertex, &nGlobalVertex, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+  SU2_MPI::Allreduce(&nLocalLinkedNodes, &nGlobalLinkedNodes, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
 
   Buffer_Receive_Coord.resize(nGlobalVertex, nDim);
   Buffer_Receive_GlobalPoint.resize(nGlobalVertex);
@@ -290,20 +292,20 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker)
     /*--- Receive from other processes to the appropriate position in the buffers and shift StartLinkedNodes indices.
      * ---*/
     for (iRank = 1; iRank < nProcessor; iRank++) {
-      SU2_MPI::Recv(&received_nLocalLinkedNodes, 1, MPI_UNSIGNED_LONG, iRank, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+      SU2_MPI::Recv(&received_nLocalLinkedNodes, 1, MPI_UNSIGNED_LONG, iRank, 0, comm, MPI_STATUS_IGNORE);
       SU2_MPI::Recv(&Buffer_Receive_LinkedNodes[received_nLocalLinkedNodes_sum], received_nLocalLinkedNodes,
-                    MPI_UNSIGNED_LONG, iRank, 1, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+                    MPI_UNSIGNED_LONG, iRank, 1, comm, MPI_STATUS_IGNORE);
 
-      SU2_MPI::Recv(&received_nLocalVertex, 1, MPI_UNSIGNED_LONG, iRank, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+      SU2_MPI::Recv(&received_nLocalVertex, 1, MPI_UNSIGNED_LONG, iRank, 0, comm, MPI_STATUS_IGNORE);
       SU2_MPI::Recv(Buffer_Receive_Coord[received_nLocalVertex_sum], nDim * received_nLocalVertex, MPI_DOUBLE, iRank, 1,
-                    SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+                    comm, MPI_STATUS_IGNORE);
 
       SU2_MPI::Recv(&Buffer_Receive_GlobalPoint[received_nLocalVertex_sum], received_nLocalVertex, MPI_UNSIGNED_LONG,
-                    iRank, 1, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+                    iRank, 1, comm, MPI_STATUS_IGNORE);
       SU2_MPI::Recv(&Buffer_Receive_nLinkedNodes[received_nLocalVertex_sum], received_nLocalVertex, MPI_UNSIGNED_LONG,
-                    iRank, 1, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+                    iRank, 1, comm, MPI_STATUS_IGNORE);
       SU2_MPI::Recv(&Buffer_Receive_StartLinkedNodes[received_nLocalVertex_sum], received_nLocalVertex,
-                    MPI_UNSIGNED_LONG, iRank, 1, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+                    MPI_UNSIGNED_LONG, iRank, 1, comm, MPI_STATUS_IGNORE);
 
       for (unsigned long iVertex = 0; iVertex < received_nLocalVertex; iVertex++) {
         Buffer_Receive_Proc[received_nLocalVertex_sum + iVertex] = iRank;
@@ -314,15 +316,15 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker)
       received_nLocalLinkedNodes_sum += received_nLocalLinkedNodes;
     }
   } else {
-    SU2_MPI::Send(&nLocalLinkedNodes, 1, MPI_UNSIGNED_LONG, 0, 0, SU2_MPI::GetComm());
-    SU2_MPI::Send(Buffer_Send_LinkedNodes.data(), nLocalLinkedNodes, MPI_UNSIGNED_LONG, 0, 1, SU2_MPI::GetComm());
+    SU2_MPI::Send(&nLocalLinkedNodes, 1, MPI_UNSIGNED_LONG, 0, 0, comm);
+    SU2_MPI::Send(Buffer_Send_LinkedNodes.data(), nLocalLinkedNodes, MPI_UNSIGNED_LONG, 0, 1, comm);
 
-    SU2_MPI::Send(&nLocalVertex, 1, MPI_UNSIGNED_LONG, 0, 0, SU2_MPI::GetComm());
-    SU2_MPI::Send(Buffer_Send_Coord.data(), Buffer_Send_Coord.size(), MPI_DOUBLE, 0, 1, SU2_MPI::GetComm());
+    SU2_MPI::Send(&nLocalVertex, 1, MPI_UNSIGNED_LONG, 0, 0, comm);
+    SU2_MPI::Send(Buffer_Send_Coord.data(), Buffer_Send_Coord.size(), MPI_DOUBLE, 0, 1, comm);
 
-    SU2_MPI::Send(Buffer_Send_GlobalPoint.data(), nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, SU2_MPI::GetComm());
-    SU2_MPI::Send(Buffer_Send_nLinkedNodes.data(), nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, SU2_MPI::GetComm());
-    SU2_MPI::Send(Buffer_Send_StartLinkedNodes.data(), nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, SU2_MPI::GetComm());
+    SU2_MPI::Send(Buffer_Send_GlobalPoint.data(), nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, comm);
+    SU2_MPI::Send(Buffer_Send_nLinkedNodes.data(), nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, comm);
+    SU2_MPI::Send(Buffer_Send_StartLinkedNodes.data(), nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, comm);
   }
 #else
   for (unsigned long iVertex = 0; iVertex < nLocalVertex; iVertex++)
@@ -368,11 +370,236 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker)
     }
   }
 
-  SU2_MPI::Bcast(Buffer_Receive_GlobalPoint.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, SU2_MPI::GetComm());
-  SU2_MPI::Bcast(Buffer_Receive_Coord.data(), Buffer_Receive_Coord.size(), MPI_DOUBLE, 0, SU2_MPI::GetComm());
-  SU2_MPI::Bcast(Buffer_Receive_Proc.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(Buffer_Receive_GlobalPoint.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, comm);
+  SU2_MPI::Bcast(Buffer_Receive_Coord.data(), Buffer_Receive_Coord.size(), MPI_DOUBLE, 0, comm);
+  SU2_MPI::Bcast(Buffer_Receive_Proc.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, comm);
 
-  SU2_MPI::Bcast(Buffer_Receive_nLinkedNodes.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, SU2_MPI::GetComm());
-  SU2_MPI::Bcast(Buffer_Receive_StartLinkedNodes.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, SU2_MPI::GetComm());
-  SU2_MPI::Bcast(Buffer_Receive_LinkedNodes.data(), nGlobalLinkedNodes, MPI_UNSIGNED_LONG, 0, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(Buffer_Receive_nLinkedNodes.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, comm);
+  SU2_MPI::Bcast(Buffer_Receive_StartLinkedNodes.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, comm);
+  SU2_MPI::Bcast(Buffer_Receive_LinkedNodes.data(), nGlobalLinkedNodes, MPI_UNSIGNED_LONG, 0, comm);
+}
+
+void CInterpolator::FindNearestDonors(int markDonor, int markTarget, unsigned long nDonor,
+                                      vector<vector<CNearbyDonor> >& nearby) const {
+  const int nProcessor = size;
+  const auto nDim = donor_geometry->GetnDim();
+  const passivedouble inf = numeric_limits<passivedouble>::max();
+
+  unsigned long nVertexDonor = 0, nVertexTarget = 0;
+  if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
+  if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
+
+  nearby.clear();
+  nearby.resize(nVertexTarget);
+
+  /*--- Donor points of this rank sorted by global index, such that ties in the local
+   * search (ADT point IDs are the positions in this list) are broken by global index. ---*/
+
+  vector<pair<unsigned long, unsigned long> > donorPoint;
+  for (auto iVertex = 0ul; iVertex < nVertexDonor; iVertex++) {
+    const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    if (donor_geometry->nodes->GetDomain(iPoint))
+      donorPoint.emplace_back(donor_geometry->nodes->GetGlobalIndex(iPoint), iPoint);
+  }
+  sort(donorPoint.begin(), donorPoint.end());
+
+  const unsigned long nLocalDonor = donorPoint.size();
+  vector<su2double> donorCoord(nLocalDonor * nDim);
+  vector<unsigned long> donorID(nLocalDonor);
+
+  for (auto iDonor = 0ul; iDonor < nLocalDonor; ++iDonor) {
+    const su2double* coord = donor_geometry->nodes->GetCoord(donorPoint[iDonor].second);
+    for (auto iDim = 0u; iDim < nDim; ++iDim) donorCoord[iDonor * nDim + iDim] = coord[iDim];
+    donorID[iDonor] = iDonor;
+  }
+
+  /*--- Exchange the number of donors and the bounding box of the donors of each rank. ---*/
+
+  vector<unsigned long> allNumDonor(nProcessor);
+  SU2_MPI::Allgather(&nLocalDonor, 1, MPI_UNSIGNED_LONG, allNumDonor.data(), 1, MPI_UNSIGNED_LONG,
+                     comm);
+
+  const auto nPossibleDonor = accumulate(allNumDonor.begin(), allNumDonor.end(), 0ul);
+  if (nPossibleDonor == 0) SU2_MPI::Error("The donor side of an interface has no points.", CURRENT_FUNCTION);
+  nDonor = min(nDonor, nPossibleDonor);
+
+  su2activematrix allBox(nProcessor, 2 * nDim);
+  {
+    vector<su2double> box(2 * nDim);
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      box[iDim] = inf;
+      box[nDim + iDim] = -inf;
+    }
+    for (auto iDonor = 0ul; iDonor < nLocalDonor; ++iDonor) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        box[iDim] = min(box[iDim], donorCoord[iDonor * nDim + iDim]);
+        box[nDim + iDim] = max(box[nDim + iDim], donorCoord[iDonor * nDim + iDim]);
+      }
+    }
+    SU2_MPI::Allgather(box.data(), 2 * nDim, MPI_DOUBLE, allBox.data(), 2 * nDim, MPI_DOUBLE, comm);
+  }
+
+  /*--- Route each target point to the ranks that may hold its closest donors. The k closest
+   * donors are not farther than the farthest corner of the closest boxes holding k donors,
+   * only ranks with boxes closer than that need to be searched. ---*/
+
+  vector<vector<unsigned long> > sendTarget(nProcessor);
+  {
+    vector<pair<passivedouble, unsigned long> > farDist;
+    vector<passivedouble> nearDist(nProcessor);
+
+    for (auto iVertex = 0ul; iVertex < nVertexTarget; iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      const su2double* coord = target_geometry->nodes->GetCoord(iPoint);
+
+      farDist.clear();
+      for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+        if (!allNumDonor[iProcessor]) continue;
+        passivedouble near2 = 0.0, far2 = 0.0;
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          const auto x = SU2_TYPE::GetValue(coord[iDim]);
+          const auto lo = SU2_TYPE::GetValue(allBox(iProcessor, iDim));
+          const auto hi = SU2_TYPE::GetValue(allBox(iProcessor, nDim + iDim));
+          near2 += pow(max(0.0, max(lo - x, x - hi)), 2);
+          far2 += pow(max(fabs(x - lo), fabs(x - hi)), 2);
+        }
+        nearDist[iProcessor] = near2;
+        farDist.emplace_back(far2, allNumDonor[iProcessor]);
+      }
+      sort(farDist.begin(), farDist.end());
+
+      passivedouble radius2 = inf;
+      for (auto i = 0ul, count = 0ul; i < farDist.size(); ++i) {
+        count += farDist[i].second;
+        if (count >= nDonor) {
+          radius2 = farDist[i].first;
+          break;
+        }
+      }
+
+      for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+        if (allNumDonor[iProcessor] && nearDist[iProcessor] <= radius2) sendTarget[iProcessor].push_back(iVertex);
+      }
+    }
+  }
+
+  /*--- Send the target coordinates to the donor ranks. ---*/
+
+  vector<int> nSend(nProcessor), nRecv(nProcessor), sendDispl(nProcessor + 1, 0), recvDispl(nProcessor + 1, 0);
+  for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) nSend[iProcessor] = sendTarget[iProcessor].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, comm);
+
+  for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+    sendDispl[iProcessor + 1] = sendDispl[iProcessor] + nSend[iProcessor];
+    recvDispl[iProcessor + 1] = recvDispl[iProcessor] + nRecv[iProcessor];
+  }
+
+  /*--- Lambda to scale counts and displacements by the size of each item. ---*/
+  auto scaled = [](const vector<int>& v, int n) {
+    vector<int> s(v.size());
+    for (auto i = 0ul; i < v.size(); ++i) s[i] = v[i] * n;
+    return s;
+  };
+
+  su2activematrix sendCoord(sendDispl.back(), nDim), recvCoord(recvDispl.back(), nDim);
+
+  for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+    for (auto i = 0ul; i < sendTarget[iProcessor].size(); ++i) {
+      const auto iPoint = target_geometry->vertex[markTarget][sendTarget[iProcessor][i]]->GetNode();
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        sendCoord(sendDispl[iProcessor] + i, iDim) = target_geometry->nodes->GetCoord(iPoint, iDim);
+    }
+  }
+
+  SU2_MPI::Alltoallv(sendCoord.data(), scaled(nSend, nDim).data(), scaled(sendDispl, nDim).data(), MPI_DOUBLE,
+                     recvCoord.data(), scaled(nRecv, nDim).data(), scaled(recvDispl, nDim).data(), MPI_DOUBLE,
+                     comm);
+
+  /*--- Find the closest local donors of the received targets, padding with infinitely
+   * far donors if this rank has fewer than k. Each reply is the distance squared and
+   * the coordinates of the donor, plus its global index. ---*/
+
+  const auto nRecvTarget = recvDispl.back();
+  const auto nReply = nDonor * (1 + nDim);
+  su2activematrix replyData(nRecvTarget, nReply);
+  su2matrix<unsigned long> replyIdx(nRecvTarget, nDonor);
+
+  if (nRecvTarget) {
+    CADTPointsOnlyClass donorADT(nDim, nLocalDonor, donorCoord.data(), donorID.data(), false);
+
+    SU2_OMP_PARALLEL {
+      vector<su2double> dist2;
+      vector<unsigned long> pointID;
+      vector<int> rankID;
+
+      SU2_OMP_FOR_DYN(roundUpDiv(nRecvTarget, 2 * omp_get_max_threads()))
+      for (auto iTarget = 0; iTarget < nRecvTarget; ++iTarget) {
+        donorADT.DetermineNearestNodes(recvCoord[iTarget], nDonor, dist2, pointID, rankID);
+
+        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+          auto reply = replyData[iTarget] + iDonor * (1 + nDim);
+          if (iDonor < dist2.size()) {
+            reply[0] = dist2[iDonor];
+            for (auto iDim = 0u; iDim < nDim; ++iDim) reply[1 + iDim] = donorCoord[pointID[iDonor] * nDim + iDim];
+            replyIdx(iTarget, iDonor) = donorPoint[pointID[iDonor]].first;
+          } else {
+            for (auto i = 0u; i <= nDim; ++i) reply[i] = inf;
+            replyIdx(iTarget, iDonor) = 0;
+          }
+        }
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+  }
+
+  /*--- Return the candidates to the target ranks. ---*/
+
+  su2activematrix candData(sendDispl.back(), nReply);
+  su2matrix<unsigned long> candIdx(sendDispl.back(), nDonor);
+
+  SU2_MPI::Alltoallv(replyData.data(), scaled(nRecv, nReply).data(), scaled(recvDispl, nReply).data(), MPI_DOUBLE,
+                     candData.data(), scaled(nSend, nReply).data(), scaled(sendDispl, nReply).data(), MPI_DOUBLE,
+                     comm);
+
+  SU2_MPI::Alltoallv(replyIdx.data(), scaled(nRecv, nDonor).data(), scaled(recvDispl, nDonor).data(),
+                     MPI_UNSIGNED_LONG, candIdx.data(), scaled(nSend, nDonor).data(), scaled(sendDispl, nDonor).data(),
+                     MPI_UNSIGNED_LONG, comm);
+
+  /*--- Merge the candidates of each target vertex and keep the k closest. ---*/
+
+  for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+    for (auto i = 0ul; i < sendTarget[iProcessor].size(); ++i) {
+      const auto iCand = sendDispl[iProcessor] + i;
+      auto& donors = nearby[sendTarget[iProcessor][i]];
+
+      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+        const auto cand = candData[iCand] + iDonor * (1 + nDim);
+        if (cand[0] == inf) break;
+        CNearbyDonor donor;
+        donor.dist2 = cand[0];
+        donor.globalPoint = candIdx(iCand, iDonor);
+        donor.processor = iProcessor;
+        for (auto iDim = 0u; iDim < nDim; ++iDim) donor.coord[iDim] = cand[1 + iDim];
+        donors.push_back(donor);
+      }
+    }
+  }
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic, 64))
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
+    auto& donors = nearby[iVertex];
+    if (donors.empty()) continue;
+
+    const auto nKeep = min<size_t>(nDonor, donors.size());
+    partial_sort(donors.begin(), donors.begin() + nKeep, donors.end(),
+                 [](const CNearbyDonor& a, const CNearbyDonor& b) {
+                   return (a.dist2 != b.dist2) ? (a.dist2 < b.dist2) : (a.globalPoint < b.globalPoint);
+                 });
+    donors.resize(nKeep);
+  }
+  END_SU2_OMP_PARALLEL
 }
@@ -37,12 +37,13 @@ namespace CInterpolatorFactory {
 CInterpolator* CreateInterpolator(CGeometry ****geometry_container,
                                   const CConfig* const* config,
                                   const CInterpolator* transpInterpolator,
-                                  unsigned iZone, unsigned jZone, bool verbose) {
+                                  unsigned iZone, unsigned jZone,
+                                  SU2_MPI::Comm comm, bool verbose) {
 
   CInterpolator* interpolator = nullptr;
 
   /*--- Only print information on master node. ---*/
-  verbose &= (SU2_MPI::GetRank() == MASTER_NODE);
+  verbose &= (SU2_MPI::GetRank(comm) == MASTER_NODE);
 
   /*--- Type of interpolation defined by donor. ---*/
   const auto type = config[iZone]->GetKindInterpolation();
@@ -56,27 +57,27 @@ CInterpolator* CreateInterpolator(CGeometry ****geometry_container,
 
   if (type == INTERFACE_INTERPOLATOR::WEIGHTED_AVERAGE) {
     if (verbose) cout << "using a sliding mesh approach." << endl;
-    interpolator = new CSlidingMesh(geometry_container, config, iZone, jZone);
+    interpolator = new CSlidingMesh(geometry_container, config, iZone, jZone, comm);
   }
   else if (config[jZone]->GetConservativeInterpolation()) {
     if (verbose) cout << "using the mirror approach, \"transposing\" coefficients from opposite mesh." << endl;
-    interpolator = new CMirror(geometry_container, config, transpInterpolator, iZone, jZone);
+    interpolator = new CMirror(geometry_container, config, transpInterpolator, iZone, jZone, comm);
   }
   else {
     switch(type) {
     case INTERFACE_INTERPOLATOR::ISOPARAMETRIC:
       if (verbose) cout << "using the isoparametric approach." << endl;
-      interpolator = new CIsoparametric(geometry_container, config, iZone, jZone);
+      interpolator = new CIsoparametric(geometry_container, config, iZone, jZone, comm);
       break;
 
     case INTERFACE_INTERPOLATOR::NEAREST_NEIGHBOR:
       if (verbose) cout << "using a nearest neighbor approach." << endl;
-      interpolator = new CNearestNeighbor(geometry_container, config, iZone, jZone);
+      interpolator = new CNearestNeighbor(geometry_container, config, iZone, jZone, comm);
       break;
 
     case INTERFACE_INTERPOLATOR::RADIAL_BASIS_FUNCTION:
       if (verbose) cout << "using a radial basis function approach." << endl;
-      interpolator = new CRadialBasisFunction(geometry_container, config, iZone, jZone);
+      interpolator = new CRadialBasisFunction(geometry_container, config, iZone, jZone, comm);
       break;
 
     default:
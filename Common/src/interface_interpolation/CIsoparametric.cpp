@@ -35,8 +35,8 @@
 using namespace GeometryToolbox;
 
 CIsoparametric::CIsoparametric(CGeometry ****geometry_container, const CConfig* const* config,
-                               unsigned int iZone, unsigned int jZone) :
-  CInterpolator(geometry_container, config, iZone, jZone) {
+                               unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm) :
+  CInterpolator(geometry_container, config, iZone, jZone, comm) {
   SetTransferCoeff(config);
 }
 
@@ -59,6 +59,7 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
   /*--- Make space for donor info. ---*/
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  ++nTransferCoeffUpdates;
 
   /*--- Init stats. ---*/
   MaxDistance = 0.0; ErrorCounter = 0;
@@ -81,7 +82,7 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
 
     /*--- Checks if the zone contains the interface, if not continue to the next step. ---*/
-    if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
+    if (!CheckInterfaceBoundary(markDonor, markTarget, comm)) continue;
 
     unsigned long nVertexDonor = 0, nVertexTarget = 0;
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
@@ -264,9 +265,9 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
   /*--- Final reduction of statistics. ---*/
   su2double tmp = MaxDistance;
   unsigned long tmp1 = ErrorCounter, tmp2 = nGlobalVertexTarget;
-  SU2_MPI::Allreduce(&tmp, &MaxDistance, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&tmp1, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&tmp2, &nGlobalVertexTarget, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&tmp, &MaxDistance, 1, MPI_DOUBLE, MPI_MAX, comm);
+  SU2_MPI::Allreduce(&tmp1, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+  SU2_MPI::Allreduce(&tmp2, &nGlobalVertexTarget, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
 
   ErrorRate = 100*su2double(ErrorCounter) / nGlobalVertexTarget;
 
@@ -32,8 +32,9 @@
 
 
 CMirror::CMirror(CGeometry ****geometry_container, const CConfig* const* config,
-                 const CInterpolator* interpolator, unsigned int iZone, unsigned int jZone) :
-  CInterpolator(geometry_container, config, iZone, jZone),
+                 const CInterpolator* interpolator, unsigned int iZone, unsigned int jZone,
+                 SU2_MPI::Comm comm) :
+  CInterpolator(geometry_container, config, iZone, jZone, comm),
   transpInterpolator(interpolator) {
   using PrintingToolbox::to_string;
   if (jZone < iZone) {
@@ -55,6 +56,7 @@ void CMirror::SetTransferCoeff(const CConfig* const* config) {
   const auto& donorVertices = transpInterpolator->targetVertices;
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  ++nTransferCoeffUpdates;
 
   /*--- Number of markers on the interface ---*/
   const auto nMarkerInt = (config[targetZone]->GetMarker_n_ZoneInterface())/2;
@@ -74,7 +76,7 @@ void CMirror::SetTransferCoeff(const CConfig* const* config) {
     const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
 
     /*--- Checks if the zone contains the interface, if not continue to the next step ---*/
-    if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
+    if (!CheckInterfaceBoundary(markDonor, markTarget, comm)) continue;
 
     unsigned long nVertexDonor = 0, nVertexTarget = 0;
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex( markDonor );
@@ -93,11 +95,11 @@ void CMirror::SetTransferCoeff(const CConfig* const* config) {
 
     /*--- Communicate vertex and donor node counts. ---*/
     SU2_MPI::Allgather(&nVertexTarget, 1, MPI_UNSIGNED_LONG,
-                       allNumVertexTarget.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+                       allNumVertexTarget.data(), 1, MPI_UNSIGNED_LONG, comm);
     SU2_MPI::Allgather(&nVertexDonorLocal, 1, MPI_UNSIGNED_LONG,
-                       allNumVertexDonor.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+                       allNumVertexDonor.data(), 1, MPI_UNSIGNED_LONG, comm);
     SU2_MPI::Allgather(&nNodeDonorLocal, 1, MPI_UNSIGNED_LONG,
-                       allNumNodeDonor.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+                       allNumNodeDonor.data(), 1, MPI_UNSIGNED_LONG, comm);
 
     /*--- Copy donor interpolation matrix (triplet format). ---*/
     vector<long> sendGlobalIndex(nNodeDonorLocal);
@@ -175,15 +177,15 @@ void CMirror::SetTransferCoeff(const CConfig* const* config) {
           GlobalIndex[iSend] = new long [numCoeff];
           DonorIndex[iSend] = new long [numCoeff];
           DonorCoeff[iSend] = new su2double [numCoeff];
-          SU2_MPI::Recv(GlobalIndex[iSend], numCoeff, MPI_LONG, jProcessor, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-          SU2_MPI::Recv(DonorIndex[iSend],  numCoeff, MPI_LONG, jProcessor, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-          SU2_MPI::Recv(DonorCoeff[iSend], numCoeff, MPI_DOUBLE, jProcessor, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+          SU2_MPI::Recv(GlobalIndex[iSend], numCoeff, MPI_LONG, jProcessor, 0, comm, MPI_STATUS_IGNORE);
+          SU2_MPI::Recv(DonorIndex[iSend],  numCoeff, MPI_LONG, jProcessor, 0, comm, MPI_STATUS_IGNORE);
+          SU2_MPI::Recv(DonorCoeff[iSend], numCoeff, MPI_DOUBLE, jProcessor, 0, comm, MPI_STATUS_IGNORE);
         }
         else if (rank == jProcessor) {
           /*--- "I'm" the donor, send. ---*/
-          SU2_MPI::Send(sendGlobalIndex.data(), numCoeff, MPI_LONG, iProcessor, 0, SU2_MPI::GetComm());
-          SU2_MPI::Send(sendDonorIndex.data(),  numCoeff, MPI_LONG, iProcessor, 0, SU2_MPI::GetComm());
-          SU2_MPI::Send(sendDonorCoeff.data(), numCoeff, MPI_DOUBLE, iProcessor, 0, SU2_MPI::GetComm());
+          SU2_MPI::Send(sendGlobalIndex.data(), numCoeff, MPI_LONG, iProcessor, 0, comm);
+          SU2_MPI::Send(sendDonorIndex.data(),  numCoeff, MPI_LONG, iProcessor, 0, comm);
+          SU2_MPI::Send(sendDonorCoeff.data(), numCoeff, MPI_DOUBLE, iProcessor, 0, comm);
         }
       }
     }
@@ -31,8 +31,8 @@
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
 CNearestNeighbor::CNearestNeighbor(CGeometry ****geometry_container, const CConfig* const* config,
-                                   unsigned int iZone, unsigned int jZone) :
-  CInterpolator(geometry_container, config, iZone, jZone) {
+                                   unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm) :
+  CInterpolator(geometry_container, config, iZone, jZone, comm) {
   SetTransferCoeff(config);
 }
 
@@ -49,15 +49,10 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
   /*--- Epsilon used to avoid division by zero. ---*/
   const su2double eps = numeric_limits<passivedouble>::epsilon();
 
-  const int nProcessor = size;
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
-  const auto nDim = donor_geometry->GetnDim();
-
-  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
-
-  vector<vector<DonorInfo> > DonorInfoVec(omp_get_max_threads());
+  ++nTransferCoeffUpdates;
 
   /*--- Cycle over nMarkersInt interface to determine communication pattern. ---*/
 
@@ -73,34 +68,20 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
 
     /*--- Checks if the zone contains the interface, if not continue to the next step. ---*/
-    if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
+    if (!CheckInterfaceBoundary(markDonor, markTarget, comm)) continue;
 
-    unsigned long nVertexDonor = 0, nVertexTarget = 0;
-    if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
+    unsigned long nVertexTarget = 0;
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    const auto nPossibleDonor = accumulate(Buffer_Receive_nVertex_Donor,
-                                Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
-
-    Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-    Buffer_Send_GlobalPoint.resize(MaxLocalVertex_Donor);
-    Buffer_Receive_Coord.resize(nProcessor * MaxLocalVertex_Donor, nDim);
-    Buffer_Receive_GlobalPoint.resize(nProcessor * MaxLocalVertex_Donor);
-
-    /*--- Collect coordinates and global point indices. ---*/
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
+    /*--- Find the closest donors of each target vertex (without gathering the donors). ---*/
+    vector<vector<CNearbyDonor> > nearby;
+    FindNearestDonors(markDonor, markTarget, nDonor, nearby);
 
     /*--- Find the closest donor points to each target. ---*/
     SU2_OMP_PARALLEL
     {
-    /*--- Working array for this thread. ---*/
-    auto& donorInfo = DonorInfoVec[omp_get_thread_num()];
-    donorInfo.resize(nPossibleDonor);
-
     su2double avgDist = 0.0, maxDist = 0.0;
     unsigned long numTarget = 0;
 
@@ -112,50 +93,30 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
 
       if (!target_geometry->nodes->GetDomain(Point_Target)) continue;
 
-      /*--- Coordinates of the target point. ---*/
-      const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
-
-      /*--- Compute all distances. ---*/
-      for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
-        for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
-
-          const auto idx = iProcessor*MaxLocalVertex_Donor + jVertex;
-          const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-          const su2double* Coord_j = Buffer_Receive_Coord[idx];
-          const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
-
-          donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
-        }
-      }
-
-      /*--- Find k closest points. ---*/
-      partial_sort(donorInfo.begin(), donorInfo.begin()+nDonor, donorInfo.end(),
-        [](const DonorInfo& a, const DonorInfo& b) {
-          /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
-          return (a.dist != b.dist)? (a.dist < b.dist) : (a.pidx < b.pidx);
-        }
-      );
+      /*--- The k closest points, sorted by distance. ---*/
+      const auto& donorInfo = nearby[iVertexTarget];
+      const auto nDonorUsed = donorInfo.size();
 
       /*--- Update stats. ---*/
       numTarget += 1;
-      su2double d = sqrt(donorInfo[0].dist);
+      su2double d = sqrt(donorInfo[0].dist2);
       avgDist += d;
       maxDist = max(maxDist, d);
 
       /*--- Compute interpolation numerators and denominator. ---*/
+      target_vertex.resize(nDonorUsed);
+
       su2double denom = 0.0;
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        donorInfo[iDonor].dist = 1.0 / (donorInfo[iDonor].dist + eps);
-        denom += donorInfo[iDonor].dist;
+      for (auto iDonor = 0ul; iDonor < nDonorUsed; ++iDonor) {
+        target_vertex.coefficient[iDonor] = 1.0 / (donorInfo[iDonor].dist2 + eps);
+        denom += target_vertex.coefficient[iDonor];
       }
 
       /*--- Set interpolation coefficients. ---*/
-      target_vertex.resize(nDonor);
-
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        target_vertex.globalPoint[iDonor] = donorInfo[iDonor].pidx;
-        target_vertex.processor[iDonor] = donorInfo[iDonor].proc;
-        target_vertex.coefficient[iDonor] = donorInfo[iDonor].dist/denom;
+      for (auto iDonor = 0ul; iDonor < nDonorUsed; ++iDonor) {
+        target_vertex.globalPoint[iDonor] = donorInfo[iDonor].globalPoint;
+        target_vertex.processor[iDonor] = donorInfo[iDonor].processor;
+        target_vertex.coefficient[iDonor] /= denom;
       }
     }
     END_SU2_OMP_FOR
@@ -171,13 +132,11 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
 
   }
 
-  delete[] Buffer_Receive_nVertex_Donor;
-
   unsigned long tmp = totalTargetPoints;
-  SU2_MPI::Allreduce(&tmp, &totalTargetPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&tmp, &totalTargetPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
   su2double tmp1 = AvgDistance, tmp2 = MaxDistance;
-  SU2_MPI::Allreduce(&tmp1, &AvgDistance, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&tmp2, &MaxDistance, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&tmp1, &AvgDistance, 1, MPI_DOUBLE, MPI_SUM, comm);
+  SU2_MPI::Allreduce(&tmp2, &MaxDistance, 1, MPI_DOUBLE, MPI_MAX, comm);
   AvgDistance /= totalTargetPoints;
 
 }
@@ -46,8 +46,8 @@ extern "C" void dgemm_(const char*, const char*, const int*, const int*, const i
 
 
 CRadialBasisFunction::CRadialBasisFunction(CGeometry ****geometry_container, const CConfig* const* config,
-                                           unsigned int iZone, unsigned int jZone) :
-  CInterpolator(geometry_container, config, iZone, jZone) {
+                                           unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm) :
+  CInterpolator(geometry_container, config, iZone, jZone, comm) {
   SetTransferCoeff(config);
 }
 
@@ -105,10 +105,17 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const int nDim = donor_geometry->GetnDim();
 
+  /*--- Local interpolation, each target point with its closest donors. ---*/
+  if (config[donorZone]->GetRadialBasisFunctionLocalPoints() > 0) {
+    SetLocalTransferCoeff(config);
+    return;
+  }
+
   const int nProcessor = size;
   Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  ++nTransferCoeffUpdates;
 
   /*--- Process interface patches in parallel, fetch all donor point coordinates,
    *    then distribute interpolation matrix computation over ranks and threads.
@@ -130,7 +137,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
 
     /*--- If the zone does not contain the interface continue to the next pair of markers. ---*/
-    if (!CheckInterfaceBoundary(markDonor,markTarget)) continue;
+    if (!CheckInterfaceBoundary(markDonor,markTarget, comm)) continue;
 
     unsigned long nVertexDonor = 0;
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
@@ -246,25 +253,25 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
 #ifdef HAVE_MPI
     /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
-    SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, SU2_MPI::GetComm());
-    SU2_MPI::Bcast(keepPolynomialRow.data(), nDim, MPI_INT, iProcessor, SU2_MPI::GetComm());
+    SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, comm);
+    SU2_MPI::Bcast(keepPolynomialRow.data(), nDim, MPI_INT, iProcessor, comm);
 
     /*--- Send C_inv_trunc only to the ranks that need it (those with target points),
      *    partial broadcast. MPI wrapper not used due to passive double. ---*/
     vector<unsigned long> allNumVertex(nProcessor);
     SU2_MPI::Allgather(&nVertexTarget, 1, MPI_UNSIGNED_LONG,
-      allNumVertex.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+      allNumVertex.data(), 1, MPI_UNSIGNED_LONG, comm);
 
     if (rank == iProcessor) {
       for (int jProcessor = 0; jProcessor < nProcessor; ++jProcessor)
         if ((jProcessor != iProcessor) && (allNumVertex[jProcessor] != 0))
           MPI_Send(C_inv_trunc.data(), C_inv_trunc.size(),
-                   MPI_DOUBLE, jProcessor, 0, SU2_MPI::GetComm());
+                   MPI_DOUBLE, jProcessor, 0, comm);
     }
     else if (nVertexTarget != 0) {
       C_inv_trunc.resize(1+nPolynomial+nGlobalVertexDonor, nGlobalVertexDonor);
       MPI_Recv(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE,
-               iProcessor, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+               iProcessor, 0, comm, MPI_STATUS_IGNORE);
     }
 #endif
 
@@ -398,10 +405,166 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
   } // end loop over interface markers
 
+  FinalizeStatistics(totalTargetPoints, totalDonorPoints, denseSize);
+
+}
+
+void CRadialBasisFunction::SetLocalTransferCoeff(const CConfig* const* config) {
+
+  /*--- RBF options. ---*/
+  const auto kindRBF = config[donorZone]->GetKindRadialBasisFunction();
+  const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
+  const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
+  const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const auto nLocalPoints = config[donorZone]->GetRadialBasisFunctionLocalPoints();
+
+  const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
+  const int nDim = donor_geometry->GetnDim();
+
+  if (usePolynomial && (nLocalPoints < nDim+2ul))
+    SU2_MPI::Error("RADIAL_BASIS_FUNCTION_LOCAL_POINTS must be at least NDIM+2 to use the polynomial term.",
+                   CURRENT_FUNCTION);
+
+  targetVertices.resize(config[targetZone]->GetnMarker_All());
+  ++nTransferCoeffUpdates;
+
+  /*--- Initialize variables for interpolation statistics. ---*/
+  unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0;
+  MinDonors = 1<<30; MaxDonors = 0; MaxCorrection = 0.0; AvgCorrection = 0.0;
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
+
+    /*--- On the donor side: find the tag of the boundary sharing the interface. ---*/
+    const auto markDonor = config[donorZone]->FindInterfaceMarker(iMarkerInt);
+
+    /*--- On the target side: find the tag of the boundary sharing the interface. ---*/
+    const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+
+    /*--- If the zone does not contain the interface continue to the next pair of markers. ---*/
+    if (!CheckInterfaceBoundary(markDonor,markTarget, comm)) continue;
+
+    unsigned long nVertexTarget = 0;
+    if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
+    if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
+
+    /*--- Total number of donor points, for statistics. ---*/
+    unsigned long nGlobalVertexDonor = 0;
+    if (markDonor != -1) {
+      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); ++iVertex)
+        nGlobalVertexDonor += donor_geometry->nodes->GetDomain(donor_geometry->vertex[markDonor][iVertex]->GetNode());
+    }
+    auto tmp = nGlobalVertexDonor;
+    SU2_MPI::Allreduce(&tmp, &nGlobalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+
+    /*--- Stencil of each target point (found without gathering the donors). ---*/
+    vector<vector<CNearbyDonor> > nearby;
+    FindNearestDonors(markDonor, markTarget, nLocalPoints, nearby);
+
+    /*--- Each target point has its own (small) generator matrix, built from its stencil. ---*/
+
+    SU2_OMP_PARALLEL
+    {
+    su2activematrix stencilCoord;
+    su2passivematrix C_inv_trunc;
+    vector<int> keepPolynomialRow;
+    vector<passivedouble> funcVec, coeffVec;
+
+    /*--- Thread-local variables for statistics. ---*/
+    unsigned long numTarget = 0, minDonors = 1<<30, maxDonors = 0, totalDonors = 0;
+    passivedouble sumCorr = 0.0, maxCorr = 0.0;
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget,2*omp_get_max_threads()))
+    for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+
+      const auto pointTarget = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+      if (!target_geometry->nodes->GetDomain(pointTarget)) continue;
+
+      const su2double* targetCoord = target_geometry->nodes->GetCoord(pointTarget);
+      const auto& stencil = nearby[iVertexTarget];
+      const auto nDonor = stencil.size();
+
+      stencilCoord.resize(nDonor, nDim);
+      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor)
+        for (int iDim = 0; iDim < nDim; ++iDim)
+          stencilCoord(iDonor, iDim) = stencil[iDonor].coord[iDim];
+
+      int nPolynomial = -1;
+      keepPolynomialRow.assign(nDim, 1);
+      ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF, stencilCoord,
+                             nPolynomial, keepPolynomialRow, C_inv_trunc);
+
+      /*--- Functions of the target point, polynomial and RBF terms. ---*/
+      funcVec.assign(1+nPolynomial+nDonor, 0.0);
+      if (usePolynomial) {
+        funcVec[0] = 1.0;
+        for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
+          if (!keepPolynomialRow[iDim]) continue;
+          funcVec[idx++] = SU2_TYPE::GetValue(targetCoord[iDim]);
+        }
+      }
+      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+        auto dist = GeometryToolbox::Distance(nDim, targetCoord, stencilCoord[iDonor]);
+        funcVec[1+nPolynomial+iDonor] = SU2_TYPE::GetValue(Get_RadialBasisValue(kindRBF, paramRBF, dist));
+      }
+
+      /*--- Interpolation coefficients (row of the interpolation matrix). ---*/
+      coeffVec.assign(nDonor, 0.0);
+      for (auto k = 0ul; k < funcVec.size(); ++k)
+        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor)
+          coeffVec[iDonor] += funcVec[k] * C_inv_trunc(k,iDonor);
+
+      /*--- Prune small coefficients. ---*/
+      auto info = PruneSmallCoefficients(SU2_TYPE::GetValue(pruneTol), nDonor, coeffVec.begin());
+      auto nnz = info.first;
+      numTarget += 1;
+      totalDonors += nnz;
+      minDonors = min(minDonors, nnz);
+      maxDonors = max(maxDonors, nnz);
+      auto corr = fabs(info.second-1.0);
+      sumCorr += corr;
+      maxCorr = max(maxCorr, corr);
+
+      /*--- Allocate and set donor information for this target point. ---*/
+      auto& targetVertex = targetVertices[markTarget][iVertexTarget];
+      targetVertex.resize(nnz);
+
+      for (unsigned long iDonor = 0, iSet = 0; iDonor < nDonor; ++iDonor) {
+        if (fabs(coeffVec[iDonor]) > 0.0) {
+          targetVertex.processor[iSet] = stencil[iDonor].processor;
+          targetVertex.globalPoint[iSet] = stencil[iDonor].globalPoint;
+          targetVertex.coefficient[iSet] = coeffVec[iDonor];
+          ++iSet;
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+    SU2_OMP_CRITICAL
+    {
+      totalTargetPoints += numTarget;
+      denseSize += numTarget*nGlobalVertexDonor;
+      totalDonorPoints += totalDonors;
+      MinDonors = min(MinDonors, minDonors);
+      MaxDonors = max(MaxDonors, maxDonors);
+      AvgCorrection += sumCorr;
+      MaxCorrection = max(MaxCorrection, maxCorr);
+    }
+    END_SU2_OMP_CRITICAL
+    }
+    END_SU2_OMP_PARALLEL
+
+  } // end loop over interface markers
+
+  FinalizeStatistics(totalTargetPoints, totalDonorPoints, denseSize);
+
+}
+
+void CRadialBasisFunction::FinalizeStatistics(unsigned long totalTargetPoints, unsigned long totalDonorPoints,
+                                              unsigned long denseSize) {
+
   /*--- Final reduction of interpolation statistics and basic sanity checks. ---*/
-  auto Reduce = [](SU2_MPI::Op op, unsigned long &val) {
+  auto Reduce = [this](SU2_MPI::Op op, unsigned long &val) {
     auto tmp = val;
-    SU2_MPI::Allreduce(&tmp, &val, 1, MPI_UNSIGNED_LONG, op, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&tmp, &val, 1, MPI_UNSIGNED_LONG, op, comm);
   };
   Reduce(MPI_SUM, totalTargetPoints);
   Reduce(MPI_SUM, totalDonorPoints);
@@ -410,8 +573,8 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   Reduce(MPI_MAX, MaxDonors);
 #ifdef HAVE_MPI
   passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection;
-  MPI_Allreduce(&tmp1, &AvgCorrection, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  MPI_Allreduce(&tmp2, &MaxCorrection, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MPI_Allreduce(&tmp1, &AvgCorrection, 1, MPI_DOUBLE, MPI_SUM, comm);
+  MPI_Allreduce(&tmp2, &MaxCorrection, 1, MPI_DOUBLE, MPI_MAX, comm);
 #endif
   if (totalTargetPoints == 0)
     SU2_MPI::Error("Somehow there are no target interpolation points.", CURRENT_FUNCTION);
@@ -426,7 +589,6 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   AvgCorrection = AvgCorrection / totalTargetPoints + 1.0;
   AvgDonors = totalDonorPoints / totalTargetPoints;
   Density = totalDonorPoints / (0.01*denseSize);
-
 }
 
 void CRadialBasisFunction::ComputeGeneratorMatrix(RADIAL_BASIS type, bool usePolynomial,
@@ -579,10 +741,14 @@ int CRadialBasisFunction::CheckPolynomialTerms(su2double max_diff_tol, vector<in
     n_polynomial = n_rows-1;
     keep_row[remove_row] = 0;
 
-    /*--- Truncated P by shifting rows "up". ---*/
-    for (auto i = remove_row+1; i < m-1; ++i)
-      for (int j = 0; j < n; ++j)
-        P(i,j) = P(i+1,j);
+    /*--- Truncate P by shifting rows "up" and dropping the last. ---*/
+    su2passivematrix Ptrunc(m-1, n);
+    for (int i = 0, iRow = 0; i < m; ++i) {
+      if (i == remove_row+1) continue;
+      for (int j = 0; j < n; ++j) Ptrunc(iRow,j) = P(i,j);
+      ++iRow;
+    }
+    P = move(Ptrunc);
   }
 
   return n_polynomial;
@@ -32,11 +32,164 @@
 
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config,
-                           unsigned int iZone, unsigned int jZone) :
-  CInterpolator(geometry_container, config, iZone, jZone) {
+                           unsigned int iZone, unsigned int jZone, SU2_MPI::Comm comm) :
+  CInterpolator(geometry_container, config, iZone, jZone, comm) {
+  periodSteps = ComputePeriodSteps(config);
+
+  if ((periodSteps == 0) && config[donorZone]->GetSlidingMeshPeriodicCache() && (rank == MASTER_NODE)) {
+    cout << "WARNING: SLIDING_MESH_PERIODIC_CACHE is disabled for the interface between zones " << donorZone
+         << " and " << targetZone << ",\n         the relative motion is not a rigid rotation at constant speed with"
+            " an integer number of time steps per revolution." << endl;
+  }
   SetTransferCoeff(config);
 }
 
+unsigned long CSlidingMesh::ComputePeriodSteps(const CConfig* const* config) const {
+
+  const auto donorConfig = config[donorZone];
+  if (!donorConfig->GetSlidingMeshPeriodicCache() || !donorConfig->GetTime_Domain() ||
+      donorConfig->GetDiscrete_Adjoint()) return 0;
+
+  /*--- Relative rotation rate, both zones must be still or rotate rigidly about the same origin. ---*/
+  su2double omega[3] = {0.0, 0.0, 0.0}, origin[3] = {0.0, 0.0, 0.0};
+  bool rotating = false;
+
+  for (const auto zone : {donorZone, targetZone}) {
+    const auto zoneConfig = config[zone];
+    const su2double sign = (zone == donorZone)? 1.0 : -1.0;
+
+    if (zoneConfig->GetDeform_Mesh() || zoneConfig->GetSurface_Movement(DEFORMING) ||
+        zoneConfig->GetSurface_Movement(AEROELASTIC) || zoneConfig->GetSurface_Movement(AEROELASTIC_RIGID_MOTION) ||
+        zoneConfig->GetSurface_Movement(EXTERNAL) || zoneConfig->GetSurface_Movement(EXTERNAL_ROTATION)) return 0;
+
+    if (zoneConfig->GetKind_GridMovement() == NO_MOVEMENT) continue;
+    if (zoneConfig->GetKind_GridMovement() != RIGID_MOTION) return 0;
+
+    bool zoneRotates = false;
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      if ((zoneConfig->GetTranslation_Rate(iDim) != 0.0) || (zoneConfig->GetPitching_Ampl(iDim) != 0.0) ||
+          (zoneConfig->GetPlunging_Ampl(iDim) != 0.0)) return 0;
+      omega[iDim] += sign * zoneConfig->GetRotation_Rate(iDim) / zoneConfig->GetOmega_Ref();
+      zoneRotates |= (zoneConfig->GetRotation_Rate(iDim) != 0.0);
+    }
+    if (!zoneRotates) continue;
+
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      if (rotating && (origin[iDim] != zoneConfig->GetMotion_Origin(iDim))) return 0;
+      origin[iDim] = zoneConfig->GetMotion_Origin(iDim);
+    }
+    rotating = true;
+  }
+
+  const su2double angle = GeometryToolbox::Norm(3, omega) * donorConfig->GetDelta_UnstTimeND();
+  if (angle == 0.0) return 0;
+
+  const passivedouble steps = SU2_TYPE::GetValue(2*PI_NUMBER / angle);
+  const auto nSteps = static_cast<unsigned long>(round(steps));
+  if ((nSteps == 0) || (fabs(steps - nSteps) > 1e-6 * steps)) return 0;
+
+  return nSteps;
+}
+
+void CSlidingMesh::UpdateBoundary(unsigned int val_zone, int val_marker, bool reconstruct, CBoundaryCache& boundary) {
+
+  CGeometry* geom = Geometry[val_zone][INST_0][MESH_0];
+  const auto nDim = geom->GetnDim();
+
+  if (reconstruct) {
+    ReconstructBoundary(val_zone, val_marker);
+
+    boundary.nGlobalVertex    = nGlobalVertex;
+    boundary.coord            = Buffer_Receive_Coord;
+    boundary.globalPoint      = Buffer_Receive_GlobalPoint;
+    boundary.nLinkedNodes     = Buffer_Receive_nLinkedNodes;
+    boundary.startLinkedNodes = Buffer_Receive_StartLinkedNodes;
+    boundary.linkedNodes      = Buffer_Receive_LinkedNodes;
+    boundary.proc             = Buffer_Receive_Proc;
+
+    /*--- The vertices of each rank are contiguous, in rank order, which is how the
+     * coordinates are gathered in later updates. ---*/
+    boundary.nLocalVertex = 0;
+    if (val_marker != -1) {
+      for (auto iVertex = 0ul; iVertex < geom->GetnVertex(val_marker); iVertex++)
+        boundary.nLocalVertex += geom->nodes->GetDomain(geom->vertex[val_marker][iVertex]->GetNode());
+    }
+    int nLocalCoord = boundary.nLocalVertex * nDim;
+    boundary.nCoordRank.resize(size);
+    boundary.displCoordRank.assign(size, 0);
+    SU2_MPI::Allgather(&nLocalCoord, 1, MPI_INT, boundary.nCoordRank.data(), 1, MPI_INT, comm);
+    for (int iRank = 1; iRank < size; iRank++)
+      boundary.displCoordRank[iRank] = boundary.displCoordRank[iRank-1] + boundary.nCoordRank[iRank-1];
+    return;
+  }
+
+  su2activematrix sendCoord(boundary.nLocalVertex, nDim);
+  unsigned long iLocalVertex = 0;
+  if (val_marker != -1) {
+    for (auto iVertex = 0ul; iVertex < geom->GetnVertex(val_marker); iVertex++) {
+      const auto iPoint = geom->vertex[val_marker][iVertex]->GetNode();
+      if (!geom->nodes->GetDomain(iPoint)) continue;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        sendCoord(iLocalVertex, iDim) = geom->nodes->GetCoord(iPoint, iDim);
+      iLocalVertex++;
+    }
+  }
+  SU2_MPI::Allgatherv(sendCoord.data(), sendCoord.size(), MPI_DOUBLE, boundary.coord.data(),
+                      boundary.nCoordRank.data(), boundary.displCoordRank.data(), MPI_DOUBLE, comm);
+}
+
+unsigned long CSlidingMesh::FindClosestDonor(unsigned short nDim, const su2double* coord,
+                                             const CBoundaryCache& donor, unsigned long start) {
+
+  if (start < donor.nGlobalVertex) {
+    /*--- Move to the closest neighbor while it is closer to the target point. ---*/
+    auto iPoint = start;
+    auto mindist = GeometryToolbox::Distance(nDim, coord, donor.coord[iPoint]);
+    bool moved = true;
+    while (moved) {
+      moved = false;
+      const auto* linked = &donor.linkedNodes[donor.startLinkedNodes[iPoint]];
+      for (auto iLinked = 0ul; iLinked < donor.nLinkedNodes[iPoint]; iLinked++) {
+        const auto dist = GeometryToolbox::Distance(nDim, coord, donor.coord[linked[iLinked]]);
+        if (dist < mindist) {
+          mindist = dist;
+          iPoint = linked[iLinked];
+          moved = true;
+        }
+      }
+    }
+
+    /*--- The target point should be within the neighborhood of its closest donor. ---*/
+    su2double maxLength = 0.0;
+    const auto* linked = &donor.linkedNodes[donor.startLinkedNodes[iPoint]];
+    for (auto iLinked = 0ul; iLinked < donor.nLinkedNodes[iPoint]; iLinked++)
+      maxLength = max(maxLength, GeometryToolbox::Distance(nDim, donor.coord[iPoint], donor.coord[linked[iLinked]]));
+
+    if (mindist <= maxLength) return iPoint;
+  }
+
+  /*--- Brute force to find the closest donor_node ---*/
+
+  su2double mindist = 1E6;
+  unsigned long donor_StartIndex = 0;
+
+  for (auto donor_iPoint = 0ul; donor_iPoint < donor.nGlobalVertex; donor_iPoint++) {
+
+    const auto dist = GeometryToolbox::Distance(nDim, coord, donor.coord[donor_iPoint]);
+
+    if (dist < mindist) {
+      mindist = dist;
+      donor_StartIndex = donor_iPoint;
+    }
+
+    if (dist == 0.0) {
+      donor_StartIndex = donor_iPoint;
+      break;
+    }
+  }
+  return donor_StartIndex;
+}
+
 void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* 0 - Variable declaration */
@@ -47,7 +200,8 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   unsigned short iDim;
 
-  unsigned long ii, jj, *uptr;
+  unsigned long ii, jj;
+  const unsigned long *uptr;
   unsigned long vPoint;
   unsigned long iEdgeVisited, nEdgeVisited, iNodeVisited;
   unsigned long nAlreadyVisited, nToVisit, StartVisited;
@@ -60,7 +214,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -78,14 +232,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   unsigned long target_iPoint, jVertexTarget;
   unsigned long nEdges_target, nNode_target;
 
-  su2vector<unsigned long> Target_nLinkedNodes;
-  su2vector<unsigned long> Target_StartLinkedNodes;
   unsigned long *target_segment;
-  su2vector<unsigned long> Target_LinkedNodes;
-  su2vector<unsigned long> Target_GlobalPoint, Donor_GlobalPoint;
 
   su2double *target_iMidEdge_point, *target_jMidEdge_point, **target_element;
-  su2activematrix TargetPoint_Coord;
 
   /* --- Donor variables --- */
 
@@ -94,16 +243,26 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   unsigned long nDonorPoints, iDonor;
   unsigned long *Donor_Vect, *tmp_Donor_Vect;
-  su2vector<unsigned long> Donor_nLinkedNodes;
-  su2vector<unsigned long> Donor_StartLinkedNodes;
-  su2vector<unsigned long> Donor_LinkedNodes;
-  su2vector<unsigned long> Donor_Proc;
 
   su2double *donor_iMidEdge_point, *donor_jMidEdge_point;
   su2double **donor_element;
-  su2activematrix DonorPoint_Coord;
+
+  /*--- For a constant speed rotation the coefficients repeat after each revolution, the first
+   * update (from the constructor) is not used as it may not correspond to the time iteration. ---*/
+  const bool usePeriodicCache = (periodSteps > 0) && (nTransferCoeffUpdates > 0);
+  const auto periodIndex = usePeriodicCache? config[targetZone]->GetTimeIter() % periodSteps : 0ul;
+
+  if (usePeriodicCache) {
+    periodicCache.resize(periodSteps);
+    if (!periodicCache[periodIndex].empty()) {
+      targetVertices = periodicCache[periodIndex];
+      ++nTransferCoeffUpdates;
+      return;
+    }
+  }
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  ++nTransferCoeffUpdates;
 
   /* 1 - Variable pre-processing */
 
@@ -128,6 +287,8 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   /*--- Number of markers on the FSI interface ---*/
   nMarkerInt = (int)( config[ donorZone ]->GetMarker_n_ZoneInterface() ) / 2;
 
+  interfaceCache.resize(nMarkerInt);
+
   /*--- For the number of markers on the interface... ---*/
   for ( iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++ ){
 
@@ -138,7 +299,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
 
     /*--- Checks if the zone contains the interface, if not continue to the next step ---*/
-    if(!CheckInterfaceBoundary(markDonor, markTarget)) continue;
+    if(!CheckInterfaceBoundary(markDonor, markTarget, comm)) continue;
 
     nVertexTarget = 0;
     if(markTarget != -1) nVertexTarget = target_geometry->GetnVertex( markTarget );
@@ -147,28 +308,59 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     3 -Reconstruct the boundaries from parallel partitioning
     */
 
+    auto& cache = interfaceCache[iMarkerInt];
+
+    /*--- The connectivity only needs to be reconstructed if the partitions of the markers changed. ---*/
+    auto countDomain = [](const CGeometry* geom, int marker) {
+      unsigned long n = 0;
+      if (marker != -1) {
+        for (auto iVertex = 0ul; iVertex < geom->GetnVertex(marker); iVertex++)
+          n += geom->nodes->GetDomain(geom->vertex[marker][iVertex]->GetNode());
+      }
+      return n;
+    };
+    int reconstruct = !cache.valid || (countDomain(target_geometry, markTarget) != cache.target.nLocalVertex) ||
+                      (countDomain(donor_geometry, markDonor) != cache.donor.nLocalVertex);
+    int reconstructAny = reconstruct;
+    SU2_MPI::Allreduce(&reconstruct, &reconstructAny, 1, MPI_INT, MPI_MAX, comm);
+
     /*--- Target boundary ---*/
-    ReconstructBoundary(targetZone, markTarget);
+    UpdateBoundary(targetZone, markTarget, reconstructAny, cache.target);
 
-    nGlobalVertex_Target = nGlobalVertex;
+    nGlobalVertex_Target = cache.target.nGlobalVertex;
 
-    TargetPoint_Coord       = Buffer_Receive_Coord;
-    Target_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Target_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Target_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Target_LinkedNodes      = Buffer_Receive_LinkedNodes;
+    const auto& TargetPoint_Coord       = cache.target.coord;
+    const auto& Target_nLinkedNodes     = cache.target.nLinkedNodes;
+    const auto& Target_StartLinkedNodes = cache.target.startLinkedNodes;
+    const auto& Target_LinkedNodes      = cache.target.linkedNodes;
 
     /*--- Donor boundary ---*/
-    ReconstructBoundary(donorZone, markDonor);
+    UpdateBoundary(donorZone, markDonor, reconstructAny, cache.donor);
+
+    nGlobalVertex_Donor = cache.donor.nGlobalVertex;
 
-    nGlobalVertex_Donor = nGlobalVertex;
+    const auto& DonorPoint_Coord       = cache.donor.coord;
+    const auto& Donor_GlobalPoint      = cache.donor.globalPoint;
+    const auto& Donor_nLinkedNodes     = cache.donor.nLinkedNodes;
+    const auto& Donor_StartLinkedNodes = cache.donor.startLinkedNodes;
+    const auto& Donor_LinkedNodes      = cache.donor.linkedNodes;
+    const auto& Donor_Proc             = cache.donor.proc;
 
-    DonorPoint_Coord       = Buffer_Receive_Coord;
-    Donor_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Donor_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Donor_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
-    Donor_Proc             = Buffer_Receive_Proc;
+    /*--- Position of each target vertex in the reconstructed boundary, no start points for the search. ---*/
+    if (reconstructAny) {
+      unordered_map<unsigned long, unsigned long> globalToIndex;
+      for (auto jVertex = 0ul; jVertex < nGlobalVertex_Target; jVertex++)
+        globalToIndex[cache.target.globalPoint[jVertex]] = jVertex;
+
+      cache.targetIndex.assign(nVertexTarget, nGlobalVertex_Target);
+      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (target_geometry->nodes->GetDomain(target_iPoint))
+          cache.targetIndex[iVertex] = globalToIndex.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
+      }
+      cache.startDonor.assign(nVertexTarget, nGlobalVertex_Donor);
+      cache.valid = true;
+    }
 
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
@@ -202,37 +394,17 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-            Coord_j = DonorPoint_Coord[ donor_iPoint ];
-
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
+          /*--- Find the closest donor_node, starting from the one of the last update ---*/
 
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
+          donor_StartIndex = FindClosestDonor(nDim, Coord_i, cache.donor, cache.startDonor[iVertex]);
+          cache.startDonor[iVertex] = donor_StartIndex;
 
           donor_iPoint    = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
 
           /*--- Contruct information regarding the target cell ---*/
 
-          auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          jVertexTarget = cache.targetIndex[iVertex];
 
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -464,11 +636,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         for (iDim = 0; iDim < nDim; iDim++)
           Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
-        auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-          if( dPoint == Target_GlobalPoint[target_iPoint] )
-            break;
-        }
+        target_iPoint = cache.targetIndex[iVertex];
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -483,27 +651,10 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
+        /*--- Find the closest donor_node, starting from the one of the last update ---*/
 
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-          Coord_j = DonorPoint_Coord[ donor_iPoint ];
-
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0){
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+        donor_StartIndex = FindClosestDonor(nDim, Coord_i, cache.donor, cache.startDonor[iVertex]);
+        cache.startDonor[iVertex] = donor_StartIndex;
 
         donor_iPoint = donor_StartIndex;
 
@@ -714,6 +865,8 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   delete [] Donor_Vect;
   delete [] Coeff_Vect;
   delete [] storeProc;
+
+  if (usePeriodicCache) periodicCache[periodIndex] = targetVertices;
 }
 
 int CSlidingMesh::Build_3D_surface_element(const su2vector<unsigned long>& map, const su2vector<unsigned long>& startIndex,
@@ -884,7 +884,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   /*--- Build preconditioner. ---*/
 
-  precond->Build();
+  if (!reusePrecond) precond->Build();
 
   /*--- Solve system. ---*/
 
@@ -37,6 +37,7 @@
 #include "drivers/CDiscAdjSinglezoneDriver.hpp"
 #include "drivers/CDiscAdjMultizoneDriver.hpp"
 #include "drivers/CDummyDriver.hpp"
+#include "drivers/CPararealDriver.hpp"
 #include "output/COutput.hpp"
 #include "../../Common/include/fem/fem_geometry_structure.hpp"
 #include "../../Common/include/geometry/CGeometry.hpp"
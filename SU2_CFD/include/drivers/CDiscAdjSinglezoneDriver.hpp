@@ -28,6 +28,9 @@
 
 #pragma once
 #include "CSinglezoneDriver.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
 
 /*!
  * \class CDiscAdjSinglezoneDriver
@@ -37,6 +40,40 @@
  */
 class CDiscAdjSinglezoneDriver : public CSinglezoneDriver {
 protected:
+#ifdef CODI_FORWARD_TYPE
+  using Scalar = su2double;
+#else
+  using Scalar = passivedouble;
+#endif
+
+  /*!
+   * \brief Product with (G^T - I), where G is the recorded iteration (the objective function is not seeded).
+   */
+  class AdjointProduct : public CMatrixVectorProduct<Scalar> {
+  public:
+    CDiscAdjSinglezoneDriver* const driver;
+
+    AdjointProduct(CDiscAdjSinglezoneDriver* d) : driver(d) {}
+
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override {
+      driver->SetAllSolutions(ZONE_0, true, u);
+      driver->EvaluateAdjoint(false);
+      driver->GetAllSolutions(ZONE_0, true, v);
+      v -= u;
+    }
+  };
+
+  class Identity : public CPreconditioner<Scalar> {
+  public:
+    inline bool IsIdentity() const override { return true; }
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override { v = u; }
+  };
+
+  /*!< \brief Members to use GMRES to solve the adjoint system (alternative to quasi-Newton). */
+  static constexpr unsigned long KrylovMinIters = 3;
+  const Scalar KrylovTol = 0.01;  /*!< \brief Residual reduction of each Krylov solve (between output iterations). */
+  CSysSolve<Scalar> LinSolver;
+  CSysVector<Scalar> AdjRHS, AdjSol;
 
   unsigned long nAdjoint_Iter;                  /*!< \brief The number of adjoint iterations that are run on the fixed-point solver.*/
   RECORDING RecordingState;                     /*!< \brief The kind of recording the tape currently holds.*/
@@ -85,6 +122,26 @@ public:
    */
   void Run(void) override;
 
+  /*!
+   * \brief Run one (monitored) iteration of the adjoint fixed-point solver.
+   * \param[in] Adjoint_Iter - Iteration number.
+   * \return True if the solver converged.
+   */
+  bool Iterate(unsigned long Adjoint_Iter);
+
+  /*!
+   * \brief Evaluate the tape once and extract the adjoint solution, without monitoring.
+   * \note The relaxation of the adjoint solution is not applied.
+   * \param[in] objective - Seed the objective function (i.e. add its gradient).
+   */
+  void EvaluateAdjoint(bool objective);
+
+  /*!
+   * \brief Solve the adjoint system with restarted FGMRES, the tape evaluations count as iterations,
+   *        after each restart cycle a regular (monitored) fixed-point iteration is performed.
+   */
+  void KrylovIterations();
+
   /*!
    * \brief Postprocess the adjoint iteration for ZONE_0.
    */
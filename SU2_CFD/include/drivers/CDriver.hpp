@@ -35,6 +35,7 @@
 #include "../interfaces/CInterface.hpp"
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CInstanceCoupledOperators.hpp"
 
 using namespace std;
 
@@ -98,6 +99,21 @@ protected:
   interpolator_container;                       /*!< \brief Definition of the interpolation method between non-matching discretizations of the interface. */
   CInterface ***interface_container;            /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                                 /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
+  bool concurrent_zones = false;                /*!< \brief Flag if the zones are solved concurrently on disjoint groups of ranks. */
+  unsigned short rank_zone = 0;                 /*!< \brief Zone solved by this rank (for concurrent zones). */
+  vector<int> zone_root_rank;                   /*!< \brief First rank (in the driver communicator) of the group of each zone. */
+  SU2_Comm driver_comm,                         /*!< \brief Communicator of the driver, spans all zones. */
+           zone_comm;                           /*!< \brief Communicator of the group of ranks that solves the zone of this rank. */
+  bool concurrent_instances = false;            /*!< \brief Flag if the time instances are solved concurrently on disjoint groups of ranks. */
+  unsigned short rank_group = 0,                /*!< \brief Group of ranks of this rank (for concurrent instances). */
+                 inst_begin = 0,                /*!< \brief First instance solved by the group of this rank. */
+                 inst_end = 0;                  /*!< \brief One past the last instance solved by the group of this rank. */
+  SU2_Comm instance_comm;                       /*!< \brief Communicator of the ranks that hold the same partition in each group. */
+  bool concurrent_slices = false;               /*!< \brief Flag if the time slices are solved concurrently on disjoint groups of ranks (parareal). */
+  unsigned short rank_slice = 0;                /*!< \brief Time slice solved by the group of this rank. */
+  unsigned long slice_begin = 0,                /*!< \brief First time iteration of the slice of this rank. */
+                slice_end = 0;                  /*!< \brief One past the last time iteration of the slice of this rank. */
+  SU2_Comm slice_comm;                          /*!< \brief Communicator of the ranks that hold the same partition in each slice. */
 
 public:
 
@@ -134,6 +150,43 @@ protected:
    */
   void Input_Preprocessing(CConfig **&config, CConfig *&driver_config);
 
+  /*!
+   * \brief Distribute the ranks among the zones, in proportion to their cost, when they are solved concurrently.
+   */
+  void ConcurrentZones_Preprocessing();
+
+  /*!
+   * \brief Split the ranks into groups that solve contiguous ranges of the time instances concurrently.
+   * \note Each group partitions the mesh in the same way, the ranks with the same partition are linked by instance_comm.
+   */
+  void ConcurrentInstances_Preprocessing();
+
+  /*!
+   * \brief Split the ranks into groups that solve contiguous ranges of the time iterations concurrently (parareal).
+   * \note As for the instances, the groups partition the mesh in the same way, the counterpart ranks are linked by slice_comm.
+   */
+  void ConcurrentTimeSlices_Preprocessing();
+
+  /*!
+   * \brief Check if a time instance is solved by this rank, which is always the case unless the instances run concurrently.
+   * \param[in] val_iInst - Index of the instance.
+   */
+  inline bool InstanceIsLocal(unsigned short val_iInst) const {
+    return !concurrent_instances || (val_iInst >= inst_begin && val_iInst < inst_end);
+  }
+
+  /*!
+   * \brief Check if a zone is solved by this rank, which is always the case unless the zones run concurrently.
+   * \param[in] val_iZone - Index of the zone.
+   */
+  inline bool ZoneIsLocal(unsigned short val_iZone) const { return !concurrent_zones || (val_iZone == rank_zone); }
+
+  /*!
+   * \brief Communicator of the ranks that hold all the zones, for the operations that involve all zones.
+   * \note This is the current (global) communicator unless the zones run concurrently.
+   */
+  inline SU2_Comm AllZonesComm() const { return concurrent_zones ? driver_comm : zone_comm; }
+
   /*!
    * \brief Construction of the edge-based data structure and the multigrid structure.
    */
@@ -887,6 +940,25 @@ private:
   unsigned short nInstHB;
   su2double **D; /*!< \brief Harmonic Balance operator. */
 
+#ifndef CODI_FORWARD_TYPE
+  using HBScalar = su2mixedfloat;     /*!< \brief Scalar type of the flow Jacobians. */
+#else
+  using HBScalar = su2double;
+#endif
+  CSysSolve<HBScalar> HBSystem;       /*!< \brief Linear solver of the coupled implicit system. */
+  CSysVector<HBScalar> HBLinSysRes;   /*!< \brief Right hand side of the coupled system (all instances). */
+  CSysVector<HBScalar> HBLinSysSol;   /*!< \brief Solution of the coupled system (all instances). */
+  unique_ptr<CInstanceCoupledProduct<HBScalar> > HBMatVec;        /*!< \brief Product with the coupled system. */
+  unique_ptr<CInstanceBlockPreconditioner<HBScalar> > HBPrecond;  /*!< \brief Preconditioner of the coupled system. */
+
+  /*!
+   * \brief First instance solved by a group of ranks (with concurrent instances).
+   * \param[in] iGroup - Index of the group, the number of groups gives the total number of instances.
+   */
+  inline unsigned short GroupFirstInstance(unsigned short iGroup) const {
+    return (iGroup * nInstHB) / config_container[ZONE_0]->GetHB_InstanceGroups();
+  }
+
 public:
 
   /*!
@@ -911,18 +983,42 @@ public:
   void Run() override;
 
   /*!
-   * \brief Computation and storage of the Harmonic Balance method source terms.
+   * \brief Computation and storage of the Harmonic Balance method source terms (of the local instances).
    * \author T. Economon, K. Naik
-   * \param[in] iZone - Current zone number.
    */
-  void SetHarmonicBalance(unsigned short iZone);
+  void SetHarmonicBalance();
+
+  /*!
+   * \brief Compute and store the Harmonic Balance source terms of one solver on one grid level.
+   * \note Each rank adds the contributions (columns of the operator) of its instances for all instances (rows),
+   *       with concurrent instances the partial sums of the rows of each group are then reduced on that group.
+   * \param[in] iMGlevel - Grid level.
+   * \param[in] iSol - Solver index.
+   * \param[in] implicit - Add the contribution of the solution increment.
+   * \param[in] transpose - Use the transpose of the operator (adjoint problems).
+   */
+  void SetHarmonicBalance_Source(unsigned short iMGlevel, unsigned short iSol, bool implicit, bool transpose);
+
+  /*!
+   * \brief Make the coefficients of all instances available to all ranks (for the output), with concurrent instances.
+   */
+  void ReduceHarmonicBalance_Coefficients();
 
   /*!
    * \brief Precondition Harmonic Balance source term for stability
+   * \note With concurrent instances, the groups exchange the sources of their instances.
    * \author J. Howison
    */
   void StabilizeHarmonicBalance();
 
+  /*!
+   * \brief Solve the implicit flow systems of all time instances as one system, in which the off-diagonal
+   *        blocks are the derivatives of the harmonic balance source terms, and complete the iteration.
+   * \note The instances assemble their systems in Iterate but do not solve them (HB_COUPLED_IMPLICIT).
+   *       The models of the instances (e.g. turbulence) and the CFL adaptation are iterated after the update.
+   */
+  void SolveCoupledImplicit();
+
   /*!
    * \brief Computation of the Harmonic Balance operator matrix for harmonic balance.
    * \author A. Rubino, S. Nimmagadda
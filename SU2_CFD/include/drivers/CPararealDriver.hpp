@@ -0,0 +1,119 @@
+/*!
+ * \file CPararealDriver.hpp
+ * \brief Driver that solves the time slices of a dual time stepping problem concurrently (parareal).
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CSinglezoneDriver.hpp"
+
+/*!
+ * \class CPararealDriver
+ * \brief Parallel-in-time driver for single zone dual time stepping problems.
+ * \details The time iterations are split into contiguous slices, each solved by a group of ranks
+ *          (see CDriver::ConcurrentTimeSlices_Preprocessing). The fine propagator is the normal
+ *          time integration of the slice, the coarse propagator integrates the slice with fewer,
+ *          larger, time steps. The parareal iteration corrects the initial state of each slice as
+ *          S_{g+1} = G(S_g^new) + F(S_g^old) - G(S_g^old), after k iterations the first k slices are
+ *          exact, i.e. the result of the sequential time integration is recovered in nSlice iterations.
+ *          Only the final fine sweep writes the history and solution output, and the screen output of
+ *          the last slice.
+ */
+class CPararealDriver final : public CSinglezoneDriver {
+private:
+  unsigned short nSlice;          /*!< \brief Number of time slices. */
+  unsigned long nIter;            /*!< \brief Maximum number of parareal iterations. */
+  unsigned long nCoarseStep;      /*!< \brief Number of time steps of the coarse propagator per slice. */
+  su2double fineTimeStep;         /*!< \brief Time step of the problem (fine propagator). */
+  su2double coarseTimeStep;       /*!< \brief Time step of the coarse propagator. */
+
+  /*!
+   * \brief Check that the counterpart ranks of all slices hold the same points, the states are
+   *        exchanged point-by-point without reordering.
+   */
+  void CheckPartitions() const;
+
+  /*!
+   * \brief Copy the time levels n and n-1 of all solvers and grid levels into a flat state vector.
+   * \param[out] state - State of the problem, pairs of (n, n-1) values.
+   */
+  void GetState(vector<su2double>& state) const;
+
+  /*!
+   * \brief Set the time levels n and n-1 of all solvers from a flat state vector, the solution is
+   *        set to the time level n and the auxiliary variables are recomputed.
+   * \param[in] state - State of the problem, pairs of (n, n-1) values.
+   */
+  void SetState(const vector<su2double>& state);
+
+  /*!
+   * \brief Scale the difference between the time levels n-1 and n of a state, this adapts the
+   *        second order backward difference to a change of time step (linear in time).
+   * \param[in] factor - Ratio between the new and old time steps.
+   * \param[in,out] state - State of the problem.
+   */
+  static void ScaleTimeLevels(su2double factor, vector<su2double>& state);
+
+  /*!
+   * \brief Integrate the slice of this rank from the current state.
+   * \param[in] coarse - Use the coarse propagator.
+   * \param[in] output - Monitor and write output (only for the fine propagator).
+   */
+  void Propagate(bool coarse, bool output);
+
+  /*!
+   * \brief Apply the coarse propagator to a state.
+   * \param[in] begin - Initial state of the slice.
+   * \param[out] end - Final state of the slice.
+   */
+  void CoarsePropagate(const vector<su2double>& begin, vector<su2double>& end);
+
+  /*!
+   * \brief Send the final state of the slice to the next slice (no-op for the last slice).
+   * \param[in] state - State to send.
+   */
+  void SendState(const vector<su2double>& state) const;
+
+  /*!
+   * \brief Receive the initial state of the slice from the previous slice (no-op for the first slice).
+   * \param[out] state - Received state.
+   */
+  void RecvState(vector<su2double>& state) const;
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   */
+  CPararealDriver(char* confFile,
+                  unsigned short val_nZone,
+                  SU2_Comm MPICommunicator);
+
+  /*!
+   * \brief Launch the parareal iterations.
+   */
+  void StartSolver() override;
+
+};
@@ -0,0 +1,336 @@
+/*!
+ * \file computeGradientsExternal.hpp
+ * \brief Hand-written reverse mode of the gradient computations, recorded on the
+ *        AD tape as external functions.
+ * \note The Green-Gauss and least-squares (with stored weights) gradients are linear
+ *       in the field when the geometry is constant. Their adjoint is the transposed
+ *       operator, which can be applied from the geometry, i.e. the tape only needs to
+ *       store the identifiers of the inputs and outputs instead of the (preaccumulated)
+ *       Jacobian of each point.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+
+#ifdef CODI_REVERSE_TYPE
+namespace detail {
+
+/*!
+ * \brief Decide if a gradient can be recorded as an external function, this requires the
+ *        option, a serial recording (the reverse functions are not thread-parallel), and
+ *        a passive geometry, i.e. passive coordinates (the least-squares weights are computed
+ *        from them) and passive volumes and normals.
+ * \note The geometry does not change its activity during a recording, the check is done
+ *       once and cached in the geometry, CDiscAdjSolver::SetRecording resets it.
+ */
+inline bool useExternalGradients(CGeometry& geometry, const CConfig& config) {
+
+  if (!config.GetAD_ExternalGradients() || !AD::TapeActive() || (omp_get_num_threads() > 1)) return false;
+
+  if (geometry.GetPassiveRecording() >= 0) return geometry.GetPassiveRecording();
+
+  auto isPassive = [&]() {
+    const auto nodes = geometry.nodes;
+    for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+      if (nodes->GetVolume(iPoint).isActive() || nodes->GetPeriodicVolume(iPoint).isActive()) return false;
+      const auto coord = nodes->GetCoord(iPoint);
+      for (auto iDim = 0u; iDim < geometry.GetnDim(); ++iDim)
+        if (coord[iDim].isActive()) return false;
+    }
+    for (auto iEdge = 0ul; iEdge < geometry.GetnEdge(); ++iEdge) {
+      const auto normal = geometry.edges->GetNormal(iEdge);
+      for (auto iDim = 0u; iDim < geometry.GetnDim(); ++iDim)
+        if (normal[iDim].isActive()) return false;
+    }
+    for (auto iMarker = 0u; iMarker < geometry.GetnMarker(); ++iMarker) {
+      for (auto iVertex = 0ul; iVertex < geometry.GetnVertex(iMarker); ++iVertex) {
+        const auto normal = geometry.vertex[iMarker][iVertex]->GetNormal();
+        for (auto iDim = 0u; iDim < geometry.GetnDim(); ++iDim)
+          if (normal[iDim].isActive()) return false;
+      }
+    }
+    return true;
+  };
+
+  geometry.SetPassiveRecording(isPassive());
+  return geometry.GetPassiveRecording();
+}
+
+/*!
+ * \brief Record the gradient of a field as an external function.
+ * \note The inputs are field(iPoint,iVar) for all points, the outputs are the gradients of
+ *       the domain points, the primal evaluation must not communicate (the communications
+ *       are recorded normally by the caller).
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[in] weighted - Weighted least-squares (only used by the reverse function of LS).
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in] reverse - Reverse function (see computeGradientsGreenGauss_b).
+ * \param[in] primal - Callable that computes the gradient without communications.
+ */
+template<size_t nDim, class FieldType, class GradientType, class ReverseFunc, class PrimalFunc>
+void recordExternalGradients(CGeometry& geometry,
+                             const CConfig& config,
+                             const FieldType& field,
+                             size_t varBegin,
+                             size_t varEnd,
+                             bool weighted,
+                             GradientType& gradient,
+                             ReverseFunc reverse,
+                             const PrimalFunc& primal)
+{
+  AD::StartExtFunc(false, false);
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint)
+    for (auto iVar = varBegin; iVar < varEnd; ++iVar)
+      AD::SetExtFuncIn(field(iPoint,iVar));
+
+  AD::StopRecording();
+
+  primal();
+
+  AD::StartRecording();
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint)
+    for (auto iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        AD::SetExtFuncOut(gradient(iPoint,iVar,iDim));
+
+  AD::FuncHelper->addUserData(&geometry);
+  AD::FuncHelper->addUserData(varBegin);
+  AD::FuncHelper->addUserData(varEnd);
+  AD::FuncHelper->addUserData(weighted);
+  AD::FuncHelper->addUserData(&config);
+
+  AD::FuncHelper->addToTape(reverse);
+
+  AD::EndExtFunc();
+}
+
+/*!
+ * \brief Reverse (transposed) Green-Gauss gradient, for both the point and edge-based versions.
+ * \note x_b and y_b follow the order of recordExternalGradients.
+ */
+template<size_t nDim>
+void computeGradientsGreenGauss_b(const passivedouble* x, passivedouble* x_b, size_t m,
+                                  const passivedouble* y, const passivedouble* y_b, size_t n,
+                                  codi::DataStore* d)
+{
+  CGeometry* geometry = nullptr;
+  d->getDataByIndex(geometry, 0);
+  size_t varBegin = 0, varEnd = 0;
+  d->getDataByIndex(varBegin, 1);
+  d->getDataByIndex(varEnd, 2);
+  const CConfig* config = nullptr;
+  d->getDataByIndex(config, 4);
+
+  const size_t nVar = varEnd - varBegin;
+  const size_t nPointDomain = geometry->GetnPointDomain();
+  const auto nodes = geometry->nodes;
+
+  for (size_t i = 0; i < m; ++i) x_b[i] = 0.0;
+
+  auto oneOnVol = [&](size_t iPoint) {
+    return 1.0 / SU2_TYPE::GetValue(nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint));
+  };
+
+  /*--- Each edge adds the average of its end points to the first and subtracts it from the second. ---*/
+
+  for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+    const auto iPoint = geometry->edges->GetNode(iEdge,0);
+    const auto jPoint = geometry->edges->GetNode(iEdge,1);
+    const auto area = geometry->edges->GetNormal(iEdge);
+
+    /*--- Halo points are not outputs. ---*/
+    const bool iDomain = (iPoint < nPointDomain), jDomain = (jPoint < nPointDomain);
+    const passivedouble wi = iDomain? 0.5 * oneOnVol(iPoint) : 0.0;
+    const passivedouble wj = jDomain? 0.5 * oneOnVol(jPoint) : 0.0;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      passivedouble sum = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        passivedouble dy = 0.0;
+        if (iDomain) dy += wi * y_b[(iPoint*nVar+iVar)*nDim+iDim];
+        if (jDomain) dy -= wj * y_b[(jPoint*nVar+iVar)*nDim+iDim];
+        sum += SU2_TYPE::GetValue(area[iDim]) * dy;
+      }
+      x_b[iPoint*nVar+iVar] += sum;
+      x_b[jPoint*nVar+iVar] += sum;
+    }
+  }
+
+  /*--- Boundary fluxes. ---*/
+
+  for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker) {
+    if ((config->GetMarker_All_KindBC(iMarker) == INTERNAL_BOUNDARY) ||
+        (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) ||
+        (config->GetMarker_All_KindBC(iMarker) == PERIODIC_BOUNDARY)) continue;
+
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (!nodes->GetDomain(iPoint)) continue;
+
+      const auto area = geometry->vertex[iMarker][iVertex]->GetNormal();
+      const passivedouble w = oneOnVol(iPoint);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          x_b[iPoint*nVar+iVar] -= w * SU2_TYPE::GetValue(area[iDim]) * y_b[(iPoint*nVar+iVar)*nDim+iDim];
+    }
+  }
+}
+
+/*!
+ * \brief Passive inverse of the least-squares normal matrix of a point, i.e. the S matrix of
+ *        solveLeastSquares, computed from the coordinates in the same way.
+ */
+template<size_t nDim>
+void computeLeastSquaresSmatrix_b(const CGeometry& geometry, size_t iPoint, bool weighted,
+                                  passivedouble Smatrix[][nDim])
+{
+  const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
+  const auto coord_i = geometry.nodes->GetCoord(iPoint);
+
+  passivedouble R[3][3] = {{0.0}};
+
+  for (auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+    const auto coord_j = geometry.nodes->GetCoord(jPoint);
+    passivedouble dist_ij[3] = {0.0}, weight = 1.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      dist_ij[iDim] = SU2_TYPE::GetValue(coord_j[iDim]) - SU2_TYPE::GetValue(coord_i[iDim]);
+    if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+    if (weight > 0.0) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim)
+          R[iDim][jDim] += dist_ij[iDim]*dist_ij[jDim]/weight;
+    }
+  }
+
+  passivedouble r11 = sqrt(max(R[0][0], eps));
+  passivedouble r12 = R[0][1] / r11;
+  passivedouble r22 = sqrt(max(R[1][1] - r12*r12, eps));
+  passivedouble r13 = 0.0, r23 = 0.0, r33 = 1.0;
+
+  if (nDim == 3) {
+    r13 = R[0][2] / r11;
+    r23 = R[1][2]/r22 - R[0][2]*r12/(r11*r22);
+    r33 = sqrt(max(R[2][2] - r23*r23 - r13*r13, eps));
+  }
+
+  const passivedouble detR2 = pow(r11*r22*r33, 2);
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      Smatrix[iDim][jDim] = 0.0;
+
+  if (detR2 <= eps) return;
+
+  if (nDim == 2) {
+    Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+    Smatrix[0][1] = -r11*r12/detR2;
+    Smatrix[1][1] = r11*r11/detR2;
+  }
+  else {
+    const passivedouble z11 = r22*r33, z12 =-r12*r33, z13 = r12*r23-r13*r22;
+    const passivedouble z22 = r11*r33, z23 =-r11*r23, z33 = r11*r22;
+
+    Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+    Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+    Smatrix[0][nDim-1] = (z13*z33)/detR2;
+    Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+    Smatrix[1][nDim-1] = (z23*z33)/detR2;
+    Smatrix[nDim-1][nDim-1] = (z33*z33)/detR2;
+  }
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    for (size_t jDim = 0; jDim < iDim; ++jDim)
+      Smatrix[iDim][jDim] = Smatrix[jDim][iDim];
+}
+
+/*!
+ * \brief Reverse (transposed) least-squares gradient, for the point, edge-based, and stored weights versions.
+ * \note x_b and y_b follow the order of recordExternalGradients. The geometric weights are recomputed
+ *       point by point, so that the external function does not require the stored weights.
+ */
+template<size_t nDim>
+void computeGradientsLeastSquares_b(const passivedouble* x, passivedouble* x_b, size_t m,
+                                    const passivedouble* y, const passivedouble* y_b, size_t n,
+                                    codi::DataStore* d)
+{
+  CGeometry* geometry = nullptr;
+  d->getDataByIndex(geometry, 0);
+  size_t varBegin = 0, varEnd = 0;
+  d->getDataByIndex(varBegin, 1);
+  d->getDataByIndex(varEnd, 2);
+  bool weighted = false;
+  d->getDataByIndex(weighted, 3);
+
+  const size_t nVar = varEnd - varBegin;
+  const auto nodes = geometry->nodes;
+
+  for (size_t i = 0; i < m; ++i) x_b[i] = 0.0;
+
+  vector<passivedouble> h(nVar*nDim);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+
+    passivedouble Smatrix[nDim][nDim];
+    computeLeastSquaresSmatrix_b<nDim>(*geometry, iPoint, weighted, Smatrix);
+
+    /*--- Adjoint of the gradient pulled back through S (symmetric). ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        h[iVar*nDim+iDim] = 0.0;
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          h[iVar*nDim+iDim] += Smatrix[iDim][jDim] * y_b[(iPoint*nVar+iVar)*nDim+jDim];
+      }
+    }
+
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    for (auto jPoint : nodes->GetPoints(iPoint)) {
+      const auto coord_j = nodes->GetCoord(jPoint);
+      passivedouble dist_ij[nDim], weight = 1.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+      dist_ij[iDim] = SU2_TYPE::GetValue(coord_j[iDim]) - SU2_TYPE::GetValue(coord_i[iDim]);
+      if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+      if (weight <= 0.0) continue;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        const passivedouble sum = GeometryToolbox::DotProduct(nDim, dist_ij, &h[iVar*nDim]) / weight;
+        x_b[jPoint*nVar+iVar] += sum;
+        x_b[iPoint*nVar+iVar] -= sum;
+      }
+    }
+  }
+}
+
+} // end namespace
+#endif
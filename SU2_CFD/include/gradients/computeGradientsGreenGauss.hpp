@@ -27,7 +27,11 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
+#include "computeGradientsExternal.hpp"
 
 namespace detail {
 
@@ -61,74 +65,84 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 size_t varEnd,
                                 GradientType& gradient)
 {
-  const size_t nPointDomain = geometry.GetnPointDomain();
-
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
+  const size_t nPointDomain = geometry.GetnPointDomain();
   const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
   /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-  {
-    auto nodes = geometry.nodes;
+  /*--- Loop over the point colors when recording with threads (see CGeometry::GetPointLoopColors). ---*/
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(nodes->GetVolume(iPoint));
-    AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+  bool colored = false;
+  const auto colors = geometry.GetPointLoopColors(colored);
+  if (colored) AD::StartNoSharedReading();
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      AD::SetPreaccIn(field(iPoint,iVar));
+  for (const auto& color : colors) {
+    SU2_OMP_FOR_DYN(nextMultiple(chunkSize, color.groupSize))
+    for (size_t k = 0; k < color.size; ++k)
+    {
+      const size_t iPoint = color[k];
+      auto nodes = geometry.nodes;
 
-    /*--- Clear the gradient. --*/
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading, unless the loop is colored. ---*/
+      if (colored || omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(nodes->GetVolume(iPoint));
+      AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        gradient(iPoint, iVar, iDim) = 0.0;
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        AD::SetPreaccIn(field(iPoint,iVar));
 
-    /*--- Handle averaging and division by volume in one constant. ---*/
+      /*--- Clear the gradient. --*/
 
-    su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
 
-    /*--- Add a contribution due to each neighbor. ---*/
+      /*--- Handle averaging and division by volume in one constant. ---*/
 
-    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
-    {
-      size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
-      size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+      su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
 
-      /*--- Determine if edge points inwards or outwards of iPoint.
-       *    If inwards we need to flip the area vector. ---*/
+      /*--- Add a contribution due to each neighbor. ---*/
 
-      su2double dir = (iPoint < jPoint)? 1.0 : -1.0;
-      su2double weight = dir * halfOnVol;
+      for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+      {
+        size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
+        size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
 
-      const auto area = geometry.edges->GetNormal(iEdge);
-      AD::SetPreaccIn(area, nDim);
+        /*--- Determine if edge points inwards or outwards of iPoint.
+         *    If inwards we need to flip the area vector. ---*/
 
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      {
-        AD::SetPreaccIn(field(jPoint,iVar));
+        su2double dir = (iPoint < jPoint)? 1.0 : -1.0;
+        su2double weight = dir * halfOnVol;
 
-        su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
+        const auto area = geometry.edges->GetNormal(iEdge);
+        AD::SetPreaccIn(area, nDim);
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          gradient(iPoint, iVar, iDim) += flux * area[iDim];
-      }
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          AD::SetPreaccIn(field(jPoint,iVar));
 
-    }
+          su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint, iVar, iDim) += flux * area[iDim];
+        }
 
-    AD::EndPreacc();
+      }
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
+
+      AD::EndPreacc();
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
+
+  if (colored) AD::EndNoSharedReading();
 
   /*--- Add boundary fluxes. ---*/
 
@@ -184,11 +198,171 @@ void computeGradientsGreenGauss(CSolver* solver,
   solver->InitiateComms(&geometry, &config, kindMpiComm);
   solver->CompleteComms(&geometry, &config, kindMpiComm);
 
+}
+
+/*!
+ * \brief Edge-based version of computeGradientsGreenGauss, each edge is visited
+ *        once and its flux is added to / subtracted from its two end points.
+ * \note The edge coloring of the geometry makes the scatter thread-safe, the edges
+ *       of a color are processed in batches of SIMD length, as in CNumericsSIMD.
+ *       There is no point-local scope to preaccumulate, for AD the tape records
+ *       the edge operations directly. See computeGradientsGreenGauss for the arguments.
+ */
+template<size_t nDim, class FieldType, class GradientType>
+void computeGradientsGreenGaussEdge(CSolver* solver,
+                                    MPI_QUANTITIES kindMpiComm,
+                                    PERIODIC_QUANTITIES kindPeriodicComm,
+                                    CGeometry& geometry,
+                                    const CConfig& config,
+                                    const FieldType& field,
+                                    size_t varBegin,
+                                    size_t varEnd,
+                                    GradientType& gradient)
+{
+  using Double = simd::Array<su2double>;
+  using Int = simd::Array<unsigned long, Double::Size>;
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const size_t nPoint = geometry.GetnPoint();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MIN_CHUNK = 32;
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- Clear the gradient, the edge loop also updates halo points. ---*/
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPoint; ++iPoint)
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = 0.0;
+  END_SU2_OMP_FOR
+
+  /*--- The coloring is built on first use, only one thread may do it. ---*/
+
+  SU2_OMP_MASTER
+  geometry.GetEdgeColoring();
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  const auto& coloring = geometry.GetEdgeColoring();
+
+  /*--- Integrate over the faces (edges) of all volumes, one color at a time. ---*/
+
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor)
+  {
+    const auto edges = coloring.innerIdx(iColor);
+    const size_t nColorEdge = coloring.getNumNonZeros(iColor);
+
+    /*--- Chunk size is a multiple of the color group size (see CFVMFlowSolverBase). ---*/
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_CHUNK, geometry.GetEdgeColorGroupSize()))
+    for (size_t k = 0; k < nColorEdge; k += Double::Size)
+    {
+      const size_t nLane = min<size_t>(Double::Size, nColorEdge-k);
+
+      /*--- Gather edge data, inactive lanes repeat the first edge of the batch. ---*/
+
+      Int iPoint, jPoint;
+      Double area[nDim];
+
+      for (size_t j = 0; j < Double::Size; ++j) {
+        const auto iEdge = edges[k + j*(j < nLane)];
+        iPoint[j] = geometry.edges->GetNode(iEdge,0);
+        jPoint[j] = geometry.edges->GetNode(iEdge,1);
+        const auto normal = geometry.edges->GetNormal(iEdge);
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          area[iDim][j] = normal[iDim];
+      }
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        Double average;
+        for (size_t j = 0; j < Double::Size; ++j)
+          average[j] = 0.5 * (field(iPoint[j],iVar) + field(jPoint[j],iVar));
+
+        Double flux[nDim];
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          flux[iDim] = average * area[iDim];
+
+        /*--- Scatter one lane at a time, edges of the same group may share points.
+         *    The area vector points from the first to the second node of the edge. ---*/
+
+        for (size_t j = 0; j < nLane; ++j) {
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            gradient(iPoint[j], iVar, iDim) += flux[iDim][j];
+            gradient(jPoint[j], iVar, iDim) -= flux[iDim][j];
+          }
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Add boundary fluxes. ---*/
+
+  for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+  {
+    if ((config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+        (config.GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
+        (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))
+    {
+      SU2_OMP_FOR_STAT(32)
+      for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
+      {
+        size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
+
+        if (!geometry.nodes->GetDomain(iPoint)) continue;
+
+        const auto area = geometry.vertex[iMarker][iVertex]->GetNormal();
+
+        for (size_t iVar = varBegin; iVar < varEnd; iVar++)
+          for (size_t iDim = 0; iDim < nDim; iDim++)
+            gradient(iPoint, iVar, iDim) -= field(iPoint,iVar) * area[iDim];
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
+  /*--- Divide by the volume of the (non-halo) points. ---*/
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const su2double oneOnVol = 1.0 / (geometry.nodes->GetVolume(iPoint) +
+                                      geometry.nodes->GetPeriodicVolume(iPoint));
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) *= oneOnVol;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- If no solver was provided we do not communicate ---*/
+
+  if (solver == nullptr) return;
+
+  /*--- Account for periodic contributions. ---*/
+
+  for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+  {
+    solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+  }
+
+  /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+
+  solver->InitiateComms(&geometry, &config, kindMpiComm);
+  solver->CompleteComms(&geometry, &config, kindMpiComm);
+
 }
 } // end namespace
 
 /*!
- * \brief Instantiations for 2D and 3D.
+ * \brief Instantiations for 2D and 3D, point- or edge-based according to the config.
  */
 template<class FieldType, class GradientType>
 void computeGradientsGreenGauss(CSolver* solver,
@@ -200,14 +374,57 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 size_t varBegin,
                                 size_t varEnd,
                                 GradientType& gradient) {
+#ifdef CODI_REVERSE_TYPE
+  /*--- Record as an external function (only the inputs and outputs are stored). The primal is
+   *    evaluated by this function without communications, as the tape is stopped by then. ---*/
+  if (detail::useExternalGradients(geometry, config)) {
+    auto primal = [&]() {
+      computeGradientsGreenGauss(nullptr, kindMpiComm, kindPeriodicComm, geometry, config,
+                                 field, varBegin, varEnd, gradient);
+    };
+    switch (geometry.GetnDim()) {
+    case 2:
+      detail::recordExternalGradients<2>(geometry, config, field, varBegin, varEnd, false, gradient,
+                                         detail::computeGradientsGreenGauss_b<2>, primal);
+      break;
+    case 3:
+      detail::recordExternalGradients<3>(geometry, config, field, varBegin, varEnd, false, gradient,
+                                         detail::computeGradientsGreenGauss_b<3>, primal);
+      break;
+    default:
+      SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+      break;
+    }
+
+    if (solver == nullptr) return;
+
+    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic) {
+      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    }
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    return;
+  }
+#endif
+  const bool edgeBased = config.GetEdgeBasedGradients();
+
   switch (geometry.GetnDim()) {
   case 2:
-    detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
-                                          config, field, varBegin, varEnd, gradient);
+    if (edgeBased)
+      detail::computeGradientsGreenGaussEdge<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
+                                                config, field, varBegin, varEnd, gradient);
+    else
+      detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
+                                            config, field, varBegin, varEnd, gradient);
     break;
   case 3:
-    detail::computeGradientsGreenGauss<3>(solver, kindMpiComm, kindPeriodicComm, geometry,
-                                          config, field, varBegin, varEnd, gradient);
+    if (edgeBased)
+      detail::computeGradientsGreenGaussEdge<3>(solver, kindMpiComm, kindPeriodicComm, geometry,
+                                                config, field, varBegin, varEnd, gradient);
+    else
+      detail::computeGradientsGreenGauss<3>(solver, kindMpiComm, kindPeriodicComm, geometry,
+                                            config, field, varBegin, varEnd, gradient);
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
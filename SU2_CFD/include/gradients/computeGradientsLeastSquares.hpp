@@ -26,8 +26,12 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "computeGradientsExternal.hpp"
 
 namespace detail {
 
@@ -197,21 +201,177 @@ void computeGradientsLeastSquares(CSolver* solver,
 
   /*--- First loop over non-halo points of the grid. ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  /*--- Loop over the point colors when recording with threads (see CGeometry::GetPointLoopColors). ---*/
+
+  bool colored = false;
+  const auto colors = geometry.GetPointLoopColors(colored);
+  if (colored) AD::StartNoSharedReading();
+
+  for (const auto& color : colors) {
+    SU2_OMP_FOR_DYN(nextMultiple(chunkSize, color.groupSize))
+    for (size_t k = 0; k < color.size; ++k)
+    {
+      const size_t iPoint = color[k];
+      auto nodes = geometry.nodes;
+      const auto coord_i = nodes->GetCoord(iPoint);
+
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading, unless the loop is colored. ---*/
+      if (colored || omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(coord_i, nDim);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        AD::SetPreaccIn(field(iPoint,iVar));
+
+      /*--- Clear gradient and Rmatrix. ---*/
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          Rmatrix(iPoint, iDim, jDim) = 0.0;
+
+
+      for (auto jPoint : nodes->GetPoints(iPoint))
+      {
+        const auto coord_j = geometry.nodes->GetCoord(jPoint);
+        AD::SetPreaccIn(coord_j, nDim);
+
+
+        /*--- Distance vector from iPoint to jPoint ---*/
+
+        su2double dist_ij[nDim] = {0.0};
+        GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+
+
+        /*--- Compute inverse weight, default 1 (unweighted). ---*/
+
+        su2double weight = 1.0;
+        if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+        /*--- Sumations for entries of upper triangular matrix R. ---*/
+
+        if (weight > 0.0)
+        {
+          weight = 1.0 / weight;
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            for (size_t jDim = iDim; jDim < nDim; ++jDim)
+              Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+          if (nDim == 3)
+            Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+
+          /*--- Entries of c:= transpose(A)*b ---*/
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            AD::SetPreaccIn(field(jPoint,iVar));
+
+            su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+          }
+        }
+      }
+
+      if (periodic)
+      {
+        /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+
+        AD::EndPreacc();
+      }
+      else {
+        /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
+
+        solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  if (colored) AD::EndNoSharedReading();
+
+  /*--- Correct the gradient values across any periodic boundaries. ---*/
+
+  if (periodic)
   {
-    auto nodes = geometry.nodes;
-    const auto coord_i = nodes->GetCoord(iPoint);
+    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+    {
+      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    }
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(coord_i, nDim);
+    /*--- Second loop over points of the grid to compute final gradient. ---*/
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      AD::SetPreaccIn(field(iPoint,iVar));
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+      solveLeastSquares<nDim, true>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+    END_SU2_OMP_FOR
+  }
 
-    /*--- Clear gradient and Rmatrix. ---*/
+  /*--- If no solver was provided we do not communicate ---*/
+
+  if (solver != nullptr)
+  {
+    /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+    solver->CompleteComms(&geometry, &config, kindMpiComm);
+  }
+
+}
+
+/*!
+ * \brief Edge-based version of computeGradientsLeastSquares, each edge is visited
+ *        once and its contributions to R and c (the right-hand side) are added to
+ *        both end points (the contributions are the same for i and j).
+ * \note See computeGradientsGreenGaussEdge for notes on coloring, SIMD, and AD,
+ *       and computeGradientsLeastSquares for the arguments.
+ */
+template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
+void computeGradientsLeastSquaresEdge(CSolver* solver,
+                                      MPI_QUANTITIES kindMpiComm,
+                                      PERIODIC_QUANTITIES kindPeriodicComm,
+                                      CGeometry& geometry,
+                                      const CConfig& config,
+                                      bool weighted,
+                                      const FieldType& field,
+                                      size_t varBegin,
+                                      size_t varEnd,
+                                      GradientType& gradient,
+                                      RMatrixType& Rmatrix)
+{
+  using Double = simd::Array<su2double>;
+  using Int = simd::Array<unsigned long, Double::Size>;
+
+  const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const size_t nPoint = geometry.GetnPoint();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MIN_CHUNK = 32;
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- Clear gradient and Rmatrix, the edge loop also updates halo points. ---*/
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPoint; ++iPoint)
+  {
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         gradient(iPoint, iVar, iDim) = 0.0;
@@ -219,26 +379,189 @@ void computeGradientsLeastSquares(CSolver* solver,
     for (size_t iDim = 0; iDim < nDim; ++iDim)
       for (size_t jDim = 0; jDim < nDim; ++jDim)
         Rmatrix(iPoint, iDim, jDim) = 0.0;
+  }
+  END_SU2_OMP_FOR
 
+  /*--- The coloring is built on first use, only one thread may do it. ---*/
 
-    for (auto jPoint : nodes->GetPoints(iPoint))
+  SU2_OMP_MASTER
+  geometry.GetEdgeColoring();
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  const auto& coloring = geometry.GetEdgeColoring();
+  const auto& coords = geometry.nodes->GetCoord();
+
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor)
+  {
+    const auto edges = coloring.innerIdx(iColor);
+    const size_t nColorEdge = coloring.getNumNonZeros(iColor);
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_CHUNK, geometry.GetEdgeColorGroupSize()))
+    for (size_t k = 0; k < nColorEdge; k += Double::Size)
     {
-      const auto coord_j = geometry.nodes->GetCoord(jPoint);
-      AD::SetPreaccIn(coord_j, nDim);
+      const size_t nLane = min<size_t>(Double::Size, nColorEdge-k);
 
+      /*--- Gather edge data, inactive lanes repeat the first edge of the batch. ---*/
 
-      /*--- Distance vector from iPoint to jPoint ---*/
+      Int iPoint, jPoint;
+      Double dist_ij[nDim];
 
-      su2double dist_ij[nDim] = {0.0};
-      GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+      for (size_t j = 0; j < Double::Size; ++j) {
+        const auto iEdge = edges[k + j*(j < nLane)];
+        iPoint[j] = geometry.edges->GetNode(iEdge,0);
+        jPoint[j] = geometry.edges->GetNode(iEdge,1);
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim][j] = coords(jPoint[j],iDim) - coords(iPoint[j],iDim);
+      }
+
+      /*--- Inverse weight, default 1 (unweighted), coincident points are skipped. ---*/
+
+      Double weight = 1.0;
+      if (weighted) {
+        Double sqDist = 0.0;
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          sqDist += dist_ij[iDim] * dist_ij[iDim];
+        for (size_t j = 0; j < Double::Size; ++j) {
+          if (sqDist[j] > 0.0) weight[j] = 1.0 / sqDist[j];
+          else weight[j] = 0.0;
+        }
+      }
+
+      /*--- Entries of upper triangular matrix R, same storage as the point-based method. ---*/
+
+      Double Rij[nDim][nDim];
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim)
+          Rij[iDim][jDim] = dist_ij[iDim] * dist_ij[jDim] * weight;
+
+      if (nDim == 3) Rij[nDim-1][1] = dist_ij[0] * dist_ij[nDim-1] * weight;
+
+      for (size_t j = 0; j < nLane; ++j) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          for (size_t jDim = iDim; jDim < nDim; ++jDim) {
+            Rmatrix(iPoint[j],iDim,jDim) += Rij[iDim][jDim][j];
+            Rmatrix(jPoint[j],iDim,jDim) += Rij[iDim][jDim][j];
+          }
+        }
+        if (nDim == 3) {
+          Rmatrix(iPoint[j],nDim-1,1) += Rij[nDim-1][1][j];
+          Rmatrix(jPoint[j],nDim-1,1) += Rij[nDim-1][1][j];
+        }
+      }
+
+      /*--- Entries of c:= transpose(A)*b ---*/
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        Double delta_ij;
+        for (size_t j = 0; j < Double::Size; ++j)
+          delta_ij[j] = field(jPoint[j],iVar) - field(iPoint[j],iVar);
+        delta_ij *= weight;
+
+        Double c_ij[nDim];
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          c_ij[iDim] = dist_ij[iDim] * delta_ij;
+
+        for (size_t j = 0; j < nLane; ++j) {
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            gradient(iPoint[j], iVar, iDim) += c_ij[iDim][j];
+            gradient(jPoint[j], iVar, iDim) += c_ij[iDim][j];
+          }
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Correct the gradient values across any periodic boundaries. ---*/
+
+  if (periodic)
+  {
+    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+    {
+      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    }
+  }
+
+  /*--- Loop over points of the grid to compute final gradient. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+  END_SU2_OMP_FOR
+
+  /*--- If no solver was provided we do not communicate ---*/
+
+  if (solver != nullptr)
+  {
+    /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+    solver->CompleteComms(&geometry, &config, kindMpiComm);
+  }
+
+}
+/*!
+ * \brief Compute the least-squares weights of each point-neighbor pair, i.e. the vectors
+ *        W_ij = inv(R_i) * w_ij * (x_j - x_i), such that grad_i = sum_j W_ij * (u_j - u_i).
+ * \note The weights are stored with the layout of the point-to-point adjacency, the
+ *       "variables" of solveLeastSquares become the neighbors of the point.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[out] weights - Weights of each point-neighbor pair.
+ */
+template<size_t nDim, class RMatrixType>
+void computeLeastSquaresWeights(CGeometry& geometry,
+                                bool weighted,
+                                RMatrixType& Rmatrix,
+                                su2activematrix& weights)
+{
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const auto outerPtr = geometry.nodes->GetPoints().outerPtr();
+
+  /*--- View of the weights of one point as a "gradient" over its neighbors. ---*/
 
+  struct {
+    su2activematrix* weights;
+    size_t offset;
+    su2double& operator() (size_t, size_t jNeigh, size_t iDim) { return (*weights)(offset+jNeigh, iDim); }
+  } pointWeights;
+  pointWeights.weights = &weights;
 
-      /*--- Compute inverse weight, default 1 (unweighted). ---*/
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto nodes = geometry.nodes;
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        Rmatrix(iPoint, iDim, jDim) = 0.0;
+
+    pointWeights.offset = outerPtr[iPoint];
+    size_t nNeigh = 0;
+
+    for (auto jPoint : nodes->GetPoints(iPoint))
+    {
+      const auto coord_j = nodes->GetCoord(jPoint);
+
+      su2double dist_ij[nDim] = {0.0};
+      GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
 
       su2double weight = 1.0;
-      if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+      if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
 
-      /*--- Sumations for entries of upper triangular matrix R. ---*/
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        pointWeights(iPoint, nNeigh, iDim) = 0.0;
 
       if (weight > 0.0)
       {
@@ -251,27 +574,102 @@ void computeGradientsLeastSquares(CSolver* solver,
         if (nDim == 3)
           Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
 
-        /*--- Entries of c:= transpose(A)*b ---*/
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          pointWeights(iPoint, nNeigh, iDim) = dist_ij[iDim] * weight;
+      }
+      ++nNeigh;
+    }
+
+    /*--- Multiply the weights by inv(R). ---*/
 
+    solveLeastSquares<nDim, false>(iPoint, 0, nNeigh, Rmatrix, pointWeights);
+  }
+  END_SU2_OMP_FOR
+}
+
+/*!
+ * \brief Version of computeGradientsLeastSquares that uses precomputed weights,
+ *        the gradient of each point is a sparse matrix-vector product.
+ * \note The weights are computed on first use, and again after the grid moves
+ *       (see CGeometry::InvalidateLeastSquaresWeights). Not compatible with periodicity.
+ *       Rmatrix is only updated when the weights are computed.
+ *       See computeGradientsLeastSquares for the arguments.
+ */
+template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
+void computeGradientsLeastSquaresStored(CSolver* solver,
+                                        MPI_QUANTITIES kindMpiComm,
+                                        CGeometry& geometry,
+                                        const CConfig& config,
+                                        bool weighted,
+                                        const FieldType& field,
+                                        size_t varBegin,
+                                        size_t varEnd,
+                                        GradientType& gradient,
+                                        RMatrixType& Rmatrix)
+{
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- Allocation happens on first use, only one thread may do it. ---*/
+
+  SU2_OMP_MASTER
+  geometry.GetLeastSquaresWeights(weighted);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  auto& weights = geometry.GetLeastSquaresWeights(weighted);
+
+  if (!geometry.GetLeastSquaresWeightsValid(weighted)) {
+    computeLeastSquaresWeights<nDim>(geometry, weighted, Rmatrix, weights);
+
+    SU2_OMP_MASTER
+    geometry.SetLeastSquaresWeightsValid(weighted, true);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  const auto outerPtr = geometry.nodes->GetPoints().outerPtr();
+
+  /*--- Loop over the point colors when recording with threads (see CGeometry::GetPointLoopColors). ---*/
+
+  bool colored = false;
+  const auto colors = geometry.GetPointLoopColors(colored);
+  if (colored) AD::StartNoSharedReading();
+
+  for (const auto& color : colors) {
+    SU2_OMP_FOR_DYN(nextMultiple(chunkSize, color.groupSize))
+    for (size_t i = 0; i < color.size; ++i)
+    {
+      const size_t iPoint = color[i];
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading, unless the loop is colored. ---*/
+      if (colored || omp_get_num_threads() == 1) AD::StartPreacc();
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        AD::SetPreaccIn(field(iPoint,iVar));
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+
+      auto k = outerPtr[iPoint];
+
+      for (auto jPoint : geometry.nodes->GetPoints(iPoint))
+      {
         for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
         {
           AD::SetPreaccIn(field(jPoint,iVar));
 
-          su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+          const su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
 
           for (size_t iDim = 0; iDim < nDim; ++iDim)
-            gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+            gradient(iPoint, iVar, iDim) += weights(k,iDim) * delta_ij;
         }
+        ++k;
       }
-    }
-
-    if (periodic)
-    {
-      /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
-
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        for (size_t jDim = 0; jDim < nDim; ++jDim)
-          AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
 
       for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
         for (size_t iDim = 0; iDim < nDim; ++iDim)
@@ -279,32 +677,11 @@ void computeGradientsLeastSquares(CSolver* solver,
 
       AD::EndPreacc();
     }
-    else {
-      /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
-
-      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
-    }
-  }
-  END_SU2_OMP_FOR
-
-  /*--- Correct the gradient values across any periodic boundaries. ---*/
-
-  if (periodic)
-  {
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-    }
-
-    /*--- Second loop over points of the grid to compute final gradient. ---*/
-
-    SU2_OMP_FOR_DYN(chunkSize)
-    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-      solveLeastSquares<nDim, true>(iPoint, varBegin, varEnd, Rmatrix, gradient);
     END_SU2_OMP_FOR
   }
 
+  if (colored) AD::EndNoSharedReading();
+
   /*--- If no solver was provided we do not communicate ---*/
 
   if (solver != nullptr)
@@ -319,7 +696,7 @@ void computeGradientsLeastSquares(CSolver* solver,
 } // end namespace
 
 /*!
- * \brief Instantiations for 2D and 3D.
+ * \brief Instantiations for 2D and 3D, point-based, edge-based, or with stored weights according to the config.
  */
 template<class FieldType, class GradientType, class RMatrixType>
 void computeGradientsLeastSquares(CSolver* solver,
@@ -333,14 +710,60 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varEnd,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+#ifdef CODI_REVERSE_TYPE
+  /*--- Record as an external function, with a passive geometry the gradient is linear in the field and
+   *    its transpose is applied by recomputing the weights (see computeGradientsLeastSquares_b). ---*/
+  if ((config.GetnMarker_Periodic() == 0) && detail::useExternalGradients(geometry, config)) {
+    auto primal = [&]() {
+      computeGradientsLeastSquares(nullptr, kindMpiComm, kindPeriodicComm, geometry, config,
+                                   weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    };
+    switch (geometry.GetnDim()) {
+    case 2:
+      detail::recordExternalGradients<2>(geometry, config, field, varBegin, varEnd, weighted, gradient,
+                                         detail::computeGradientsLeastSquares_b<2>, primal);
+      break;
+    case 3:
+      detail::recordExternalGradients<3>(geometry, config, field, varBegin, varEnd, weighted, gradient,
+                                         detail::computeGradientsLeastSquares_b<3>, primal);
+      break;
+    default:
+      SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+      break;
+    }
+
+    if (solver == nullptr) return;
+
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    return;
+  }
+#endif
+  const bool edgeBased = config.GetEdgeBasedGradients();
+  const bool stored = config.GetPrecomputeLSWeights() && (config.GetnMarker_Periodic() == 0);
+
   switch (geometry.GetnDim()) {
   case 2:
-    detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    if (stored)
+      detail::computeGradientsLeastSquaresStored<2>(solver, kindMpiComm, geometry, config,
+                                                    weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    else if (edgeBased)
+      detail::computeGradientsLeastSquaresEdge<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                                  weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    else
+      detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                              weighted, field, varBegin, varEnd, gradient, Rmatrix);
     break;
   case 3:
-    detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    if (stored)
+      detail::computeGradientsLeastSquaresStored<3>(solver, kindMpiComm, geometry, config,
+                                                    weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    else if (edgeBased)
+      detail::computeGradientsLeastSquaresEdge<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                                  weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    else
+      detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                              weighted, field, varBegin, varEnd, gradient, Rmatrix);
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
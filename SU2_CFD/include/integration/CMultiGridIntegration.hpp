@@ -52,7 +52,30 @@ public:
                            CNumerics ******numerics_container, CConfig **config,
                            unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
 
+  /*!
+   * \brief Restrict solution from fine grid to a coarse grid.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] sol_fine - Pointer to the solution on the fine grid.
+   * \param[out] sol_coarse - Pointer to the solution on the coarse grid.
+   * \param[in] geo_fine - Geometrical definition of the fine grid.
+   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] InclSharedDomain - Include the shared domain in the interpolation.
+   */
+  void SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
+
 private:
+  /*!
+   * \brief Whether the turbulence variables are fixed (Dirichlet) at a viscous wall marker.
+   * \note Rough walls and wall functions impose the wall values through the boundary condition.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMarker - Index of the marker.
+   * \return True at smooth walls without wall functions.
+   */
+  static bool TurbDirichletWall(const CConfig *config, unsigned short iMarker);
+
   /*!
    * \brief Perform a Full-Approximation Storage (FAS) Multigrid.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -71,13 +94,14 @@ private:
 
   /*!
    * \brief Compute the forcing term.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] geo_coarse - Geometrical definition of the coarse grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+  void SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                        CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
 
   /*!
@@ -89,11 +113,13 @@ private:
 
   /*!
    * \brief Set the value of the corrected fine grid solution.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[out] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh);
+  void SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
+                                 CConfig *config, unsigned short iMesh);
 
   /*!
    * \brief Compute the gradient in coarse grid using the fine grid information.
@@ -155,20 +181,6 @@ private:
   void SmoothProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *solver, CGeometry *geometry,
                                     unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config);
 
-  /*!
-   * \brief Restrict solution from fine grid to a coarse grid.
-   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
-   * \param[in] sol_fine - Pointer to the solution on the fine grid.
-   * \param[out] sol_coarse - Pointer to the solution on the coarse grid.
-   * \param[in] geo_fine - Geometrical definition of the fine grid.
-   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
-   * \param[in] config - Definition of the particular problem.
-   * \param[in] iMesh - Index of the mesh in multigrid computations.
-   * \param[in] InclSharedDomain - Include the shared domain in the interpolation.
-   */
-  void SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
-                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
-
   /*!
    * \brief Initialize the adjoint solution using the primal problem.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -35,6 +35,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <vector>
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
@@ -72,6 +73,27 @@ protected:
   unsigned short nVar = 0;
   static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
 
+  /*!
+   * \brief Point-to-point communication pattern of an interface (pair of markers), built from the
+   *        donor information of the interpolator such that each rank only receives the donors it needs.
+   * \note The ranks in the send/recv lists may include this rank, that data is copied instead of sent.
+   */
+  struct CTransferPlan {
+    bool active = false;                  /*!< \brief Whether the markers form an interface between the zones. */
+    int markDonor = -1, markTarget = -1;  /*!< \brief Local indices of the donor and target markers. */
+    vector<unsigned long> donorVertex;    /*!< \brief Donor vertices of this rank needed by any rank. */
+    vector<int> sendRank, recvRank;       /*!< \brief Ranks to which we send, and from which we receive. */
+    vector<unsigned long> sendPtr;        /*!< \brief Start of the data for each rank in the send buffer. */
+    vector<unsigned long> recvPtr;        /*!< \brief Start of the data from each rank in the receive buffer. */
+    vector<unsigned long> sendIdx;        /*!< \brief Position in donorVertex of each sent value. */
+    vector<unsigned long> donorSlot;      /*!< \brief Row of the receive buffer for each donor of each target vertex. */
+  };
+  vector<CTransferPlan> TransferPlans;          /*!< \brief Communication pattern of each interface. */
+  const CInterpolator* PlanInterpolator = nullptr; /*!< \brief Interpolator for which the patterns were built. */
+  unsigned long PlanUpdates = 0;                /*!< \brief Version of the transfer coefficients used by the patterns. */
+  SU2_MPI::Comm PlanComm;                       /*!< \brief Communicator of the interpolator, in which the patterns are built. */
+  int PlanRank = 0;                             /*!< \brief Rank of this process in PlanComm. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -91,7 +113,7 @@ public:
   virtual ~CInterface(void);
 
   /*!
-   * \brief Interpolate data and broadcast it into all processors, for nonmatching meshes.
+   * \brief Interpolate data and send it to the processors that need it, for nonmatching meshes.
    * \param[in] interpolator - Object defining the interpolation.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
@@ -106,6 +128,19 @@ public:
                      const CConfig *donor_config, const CConfig *target_config);
 
 protected:
+  /*!
+   * \brief Build the point-to-point communication patterns of the interfaces between two zones.
+   * \note This is collective, it needs to be repeated when the interpolator is updated.
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  void SetTransferPlans(const CInterpolator& interpolator, const CGeometry *donor_geometry,
+                        const CGeometry *target_geometry, const CConfig *donor_config,
+                        const CConfig *target_config);
+
   /*!
    * \brief A virtual member.
    */
@@ -195,17 +230,17 @@ public:
                          const CConfig *donor_config, const CConfig *target_config, unsigned short iMarkerInt);
 
   /*!
-   * \brief Interpolate data and scatter it into different processors, for matching meshes.
-   * \param[in] donor_solution - Solution from the donor mesh.
+   * \brief Interpolate the gathered donor averages to the span-wise sections of the target and set them.
+   * \param[in] donorAverages - Averages of the interface, from CMixingPlaneInterface::AllgatherDonorAverages.
    * \param[in] target_solution - Solution from the target mesh.
-   * \param[in] donor_geometry - Geometry of the donor mesh.
    * \param[in] target_geometry - Geometry of the target mesh.
    * \param[in] donor_config - Definition of the problem at the donor mesh.
    * \param[in] target_config - Definition of the problem at the target mesh.
+   * \param[in] iMarkerInt - Index of the mixing-plane interface.
    */
-  void AllgatherAverage(CSolver *donor_solution, CSolver *target_solution,
-                        CGeometry *donor_geometry, CGeometry *target_geometry,
-                        const CConfig *donor_config, const CConfig *target_config, unsigned short iMarkerInt);
+  void SetTargetAverages(const vector<su2double>& donorAverages, CSolver *target_solution,
+                         CGeometry *target_geometry, const CConfig *donor_config,
+                         const CConfig *target_config, unsigned short iMarkerInt);
 
   /*!
    * \brief Interpolate data and scatter it into different processors, for matching meshes.
@@ -31,6 +31,21 @@
 #include "../CInterface.hpp"
 
 class CMixingPlaneInterface : public CInterface {
+private:
+  static constexpr unsigned short nQuant = 8;  /*!< \brief Number of averaged quantities sent per span. */
+
+  /*!
+   * \brief Get the span-wise averages of a donor marker.
+   * \param[in] donor_solution - Solution from the donor mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] Marker_Donor - Index of the donor marker.
+   * \param[in] iSpan - Index of the span.
+   * \param[out] values - The nQuant averages, -1 for the quantities that do not exist.
+   */
+  static void GetDonorAverages(const CSolver *donor_solution, const CConfig *donor_config, unsigned short nDim,
+                               unsigned long Marker_Donor, unsigned long iSpan, su2double *values);
+
 public:
   /*!
    * \overload
@@ -57,6 +72,17 @@ public:
   void GetDonor_Variable(CSolver *donor_solution, CGeometry *donor_geometry, const CConfig *donor_config,
                          unsigned long Marker_Donor, unsigned long val_Span, unsigned long Point_Donor) override;
 
+  /*!
+   * \brief Gather the span-wise averages of all the mixing-plane markers of the donor on all ranks,
+   *        in one communication. The result does not depend on the target, hence this is done once per donor.
+   * \param[in] donor_solution - Solution from the donor mesh.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[out] donorAverages - Averages of each interface (span-major, 8 values per span), empty if the marker does not exist.
+   */
+  static void AllgatherDonorAverages(const CSolver *donor_solution, const CGeometry *donor_geometry,
+                                     const CConfig *donor_config, vector<vector<su2double> >& donorAverages);
+
   /*!
    * \brief Set the variable that has been received from the target mesh into the target mesh.
    * \param[in] target_solution - Solution from the target mesh.
@@ -28,7 +28,9 @@
 
 #pragma once
 
+#include <memory>
 #include "CIteration.hpp"
+#include "../../../Common/include/toolboxes/CBinomialCheckpointing.hpp"
 
 class CFluidIteration;
 
@@ -40,6 +42,9 @@ class CFluidIteration;
 class CDiscAdjFluidIteration final : public CIteration {
  private:
   const bool turbulent;                      /*!< \brief Stores the turbulent flag. */
+  CBinomialCheckpointing checkpoints;        /*!< \brief In-memory primal checkpoints for the unsteady adjoint. */
+  std::unique_ptr<CFluidIteration> primal_iteration; /*!< \brief Used to recompute the primal time steps. */
+  std::unique_ptr<COutput> primal_output;            /*!< \brief Monitors the convergence of the recomputed steps. */
 
   /*!
    * \brief load unsteady solution for unsteady problems
@@ -53,13 +58,75 @@ class CDiscAdjFluidIteration final : public CIteration {
   void LoadUnsteady_Solution(CGeometry**** geometry, CSolver***** solver, CConfig** config, unsigned short val_iZone,
                              unsigned short val_iInst, int val_DirectIter);
 
+  /*!
+   * \brief Get the primal solvers whose solution is loaded (or recomputed) for each time step.
+   */
+  vector<unsigned short> GetPrimalSolvers(const CConfig* config) const {
+    vector<unsigned short> sols = {FLOW_SOL};
+    if (turbulent) sols.push_back(TURB_SOL);
+    if (config->GetWeakly_Coupled_Heat()) sols.push_back(HEAT_SOL);
+    return sols;
+  }
+
+  /*!
+   * \brief Get the primal solution of a time step, either from file or by recomputing it from the checkpoints.
+   * \note Arguments as in Preprocess, the solution of the time step is left in the Solution
+   * containers (as LoadUnsteady_Solution does) and the time-level containers are not modified.
+   * \param[in] val_DirectIter - Direct iteration to load.
+   */
+  void GetUnsteady_Solution(COutput* output, CIntegration**** integration, CGeometry**** geometry, CSolver***** solver,
+                            CNumerics****** numerics, CConfig** config, CSurfaceMovement** surface_movement,
+                            CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox, unsigned short val_iZone,
+                            unsigned short val_iInst, int val_DirectIter);
+
+  /*!
+   * \brief Restore the closest checkpoint before a time step and advance the primal to that step,
+   * taking new checkpoints according to the binomial schedule.
+   * \param[in] val_DirectIter - Time step to recompute.
+   */
+  void RecomputeUnsteady_Solution(COutput* output, CIntegration**** integration, CGeometry**** geometry,
+                                  CSolver***** solver, CNumerics****** numerics, CConfig** config,
+                                  CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
+                                  CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst,
+                                  long val_DirectIter);
+
+  /*!
+   * \brief Copy the primal solution (and for 2nd order dual time the solution at time n) to a checkpoint.
+   * \param[in] solver - Solvers of the finest grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] data - Checkpoint.
+   */
+  void StoreCheckpoint(CSolver* const* solver, const CConfig* config, vector<passivedouble>& data) const;
+
+  /*!
+   * \brief Set the primal solution (and time levels) of all grids from a checkpoint.
+   * \param[in] geometry - Geometry of all grid levels.
+   * \param[in] solver - Solvers of all grid levels.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] data - Checkpoint.
+   */
+  void RestoreCheckpoint(CGeometry** geometry, CSolver*** solver, CConfig* config, const vector<passivedouble>& data) const;
+
+  /*!
+   * \brief Communicate the primal solution of the finest grid, restrict it to the coarse grids,
+   * and update the dependent variables (as done after loading a restart).
+   * \param[in] geometry - Geometry of all grid levels.
+   * \param[in] solver - Solvers of all grid levels.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void RestrictPrimal_Solution(CGeometry** geometry, CSolver*** solver, CConfig* config) const;
+
  public:
   /*!
    * \brief Constructor of the class.
    * \param[in] config - Definition of the particular problem.
    */
-  explicit CDiscAdjFluidIteration(const CConfig *config) : CIteration(config),
-    turbulent(config->GetKind_Solver() == DISC_ADJ_RANS || config->GetKind_Solver() == DISC_ADJ_INC_RANS) {}
+  explicit CDiscAdjFluidIteration(const CConfig *config);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CDiscAdjFluidIteration() override;
 
   /*!
    * \brief Preprocessing to prepare for an iteration of the physics.
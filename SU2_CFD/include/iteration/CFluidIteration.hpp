@@ -71,6 +71,20 @@ class CFluidIteration : public CIteration {
                CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox, unsigned short val_iZone,
                unsigned short val_iInst) override;
 
+  /*!
+   * \brief Iterate the models that are solved after the flow (turbulence, transition, heat, radiation),
+   *        and adapt the CFL number, the flow update must have been completed.
+   * \param[in] integration - Container vector with all the integration methods.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method (the way in which the equations are solved).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Index of the zone.
+   * \param[in] val_iInst - Index of the instance layer.
+   */
+  void IterateModels(CIntegration**** integration, CGeometry**** geometry, CSolver***** solver,
+                     CNumerics****** numerics, CConfig** config, unsigned short val_iZone, unsigned short val_iInst);
+
   /*!
    * \brief Iterate the fluid system for a number of Inner_Iter iterations.
    * \param[in] output - Pointer to the COutput class.
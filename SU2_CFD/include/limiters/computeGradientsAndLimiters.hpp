@@ -0,0 +1,378 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Fused computation of gradients and slope limiters in a single sweep.
+ * \note This combines the point loops of the generic gradient implementations
+ *       and of computeLimiters_impl, see the notes there.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "computeLimiters.hpp"
+#include "../gradients/computeGradientsGreenGauss.hpp"
+#include "../gradients/computeGradientsLeastSquares.hpp"
+
+namespace detail {
+
+/*!
+ * \brief Compute the gradient (Green-Gauss or least-squares) and the limiter of a field
+ *        in one loop over points, i.e. while the data of each point and of its neighbors
+ *        is still in cache. The neighbor min/max values are found in the gradient loop.
+ * \note The gradient of a point must be final before its limiter is computed, therefore
+ *       this cannot be used with periodic boundaries (which require communication of
+ *       partial gradients), callers should use the separate functions in that case.
+ *       Each part is preaccumulated separately, as in the non-fused implementations.
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiCommGrad - Type of MPI communication for the gradient.
+ * \param[in] kindMpiCommLim - Type of MPI communication for the limiter.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+ * \param[in] varBegin - First variable index for which to compute gradients and limiters.
+ * \param[in] varEnd - End of computation range (nVar = end-begin).
+ * \param[in] field - Variable field.
+ * \param[out] gradient - Gradient of the field.
+ * \param[out] Rmatrix - Least-squares matrix (not used by Green-Gauss).
+ * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[out] fieldMax - As above but maximum values.
+ * \param[out] limiter - Reconstruction limiter for the field.
+ */
+template<size_t nDim, ENUM_LIMITER LimiterKind, class FieldType, class GradientType, class RMatrixType>
+void computeGradientsAndLimiters(CSolver* solver,
+                                 MPI_QUANTITIES kindMpiCommGrad,
+                                 MPI_QUANTITIES kindMpiCommLim,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 ENUM_FLOW_GRADIENT kindGradient,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 RMatrixType& Rmatrix,
+                                 FieldType& fieldMin,
+                                 FieldType& fieldMax,
+                                 FieldType& limiter)
+{
+  constexpr size_t MAXNVAR = 32;
+
+  if (varEnd > MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  const bool greenGauss = (kindGradient == GREEN_GAUSS);
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  /*--- Loop over the point colors when recording with threads (see CGeometry::GetPointLoopColors), except
+   *    for the Venkatakrishnan-Wang limiter, which reads global data (the range of the field). ---*/
+
+  bool colored = false;
+  const auto colors = geometry.GetPointLoopColors(colored, LimiterKind != VENKATAKRISHNAN_WANG);
+  if (colored) AD::StartNoSharedReading();
+
+  for (const auto& color : colors) {
+    SU2_OMP_FOR_DYN(nextMultiple(chunkSize, color.groupSize))
+    for (size_t k = 0; k < color.size; ++k)
+    {
+      const size_t iPoint = color[k];
+      auto nodes = geometry.nodes;
+      const auto coord_i = nodes->GetCoord(iPoint);
+
+      /*--- Gradient part, cannot preaccumulate if hybrid parallel due to shared reading (unless colored). ---*/
+
+      if (colored || omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(coord_i, nDim);
+      AD::SetPreaccIn(nodes->GetVolume(iPoint));
+      AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        AD::SetPreaccIn(field(iPoint,iVar));
+
+        fieldMax(iPoint,iVar) = field(iPoint,iVar);
+        fieldMin(iPoint,iVar) = field(iPoint,iVar);
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+      }
+
+      if (!greenGauss) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            Rmatrix(iPoint, iDim, jDim) = 0.0;
+      }
+
+      const su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
+
+      for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+      {
+        const size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          AD::SetPreaccIn(field(jPoint,iVar));
+
+          fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
+          fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+        }
+
+        if (greenGauss) {
+          /*--- Flip the area vector if the edge points into iPoint. ---*/
+
+          const size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
+          const su2double dir = (iPoint < jPoint)? 1.0 : -1.0;
+          const su2double weight = dir * halfOnVol;
+
+          const auto area = geometry.edges->GetNormal(iEdge);
+          AD::SetPreaccIn(area, nDim);
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+            const su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar, iDim) += flux * area[iDim];
+          }
+        }
+        else {
+          const auto coord_j = nodes->GetCoord(jPoint);
+          AD::SetPreaccIn(coord_j, nDim);
+
+          su2double dist_ij[nDim] = {0.0};
+          GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+
+          su2double weight = 1.0;
+          if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+          if (weight > 0.0) {
+            weight = 1.0 / weight;
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              for (size_t jDim = iDim; jDim < nDim; ++jDim)
+                Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+            if (nDim == 3)
+              Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+
+            for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+              const su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+              for (size_t iDim = 0; iDim < nDim; ++iDim)
+                gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+            }
+          }
+        }
+      }
+
+      if (greenGauss) {
+        /*--- Boundary fluxes of iPoint, same markers as computeGradientsGreenGauss. ---*/
+
+        if (nodes->GetBoundary(iPoint)) {
+          const su2double oneOnVol = 2.0 * halfOnVol;
+
+          for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker) {
+            const auto iVertex = nodes->GetVertex(iPoint, iMarker);
+
+            if ((iVertex < 0) ||
+                (config.GetMarker_All_KindBC(iMarker) == INTERNAL_BOUNDARY) ||
+                (config.GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) ||
+                (config.GetMarker_All_KindBC(iMarker) == PERIODIC_BOUNDARY)) continue;
+
+            const auto area = geometry.vertex[iMarker][iVertex]->GetNormal();
+            AD::SetPreaccIn(area, nDim);
+
+            for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+              const su2double flux = field(iPoint,iVar) * oneOnVol;
+
+              for (size_t iDim = 0; iDim < nDim; ++iDim)
+                gradient(iPoint, iVar, iDim) -= flux * area[iDim];
+            }
+          }
+        }
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          AD::SetPreaccOut(fieldMax(iPoint,iVar));
+          AD::SetPreaccOut(fieldMin(iPoint,iVar));
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
+        }
+        AD::EndPreacc();
+      }
+      else {
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          AD::SetPreaccOut(fieldMax(iPoint,iVar));
+          AD::SetPreaccOut(fieldMin(iPoint,iVar));
+        }
+        /*--- This ends the preaccumulation with the gradient as output. ---*/
+        solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+      }
+
+      /*--- Limiter part, the neighbor loop only computes projections now. ---*/
+
+      if (colored || omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(coord_i, nDim);
+
+      su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        AD::SetPreaccIn(field(iPoint,iVar));
+        AD::SetPreaccIn(fieldMax(iPoint,iVar));
+        AD::SetPreaccIn(fieldMin(iPoint,iVar));
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
+        projMax[iVar] = projMin[iVar] = 0.0;
+      }
+
+      for (auto jPoint : nodes->GetPoints(iPoint)) {
+
+        const auto coord_j = nodes->GetCoord(jPoint);
+        AD::SetPreaccIn(coord_j, nDim);
+
+        /*--- Distance vector from iPoint to face (middle of the edge). ---*/
+
+        su2double dist_ij[nDim] = {0.0};
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          su2double proj = 0.0;
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+          projMax[iVar] = max(projMax[iVar], proj);
+          projMin[iVar] = min(projMin[iVar], proj);
+        }
+      }
+
+      const su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        const su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                                 fieldMax(iPoint,iVar) - field(iPoint,iVar));
+
+        const su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                                 fieldMin(iPoint,iVar) - field(iPoint,iVar));
+
+        limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+
+        AD::SetPreaccOut(limiter(iPoint,iVar));
+      }
+
+      AD::EndPreacc();
+    }
+    END_SU2_OMP_FOR
+  }
+
+  if (colored) AD::EndNoSharedReading();
+
+  /*--- Obtain the gradients and limiters at halo points from the MPI ranks that own them.
+   *    If no solver was provided we do not communicate. ---*/
+
+  if (solver != nullptr)
+  {
+    solver->InitiateComms(&geometry, &config, kindMpiCommGrad);
+    solver->CompleteComms(&geometry, &config, kindMpiCommGrad);
+
+    solver->InitiateComms(&geometry, &config, kindMpiCommLim);
+    solver->CompleteComms(&geometry, &config, kindMpiCommLim);
+  }
+
+}
+} // end namespace
+
+/*!
+ * \brief A wrapper function that instantiates the fused implementation for each
+ *        kind of limiter, see computeLimiters and detail::computeGradientsAndLimiters.
+ * \note NO_LIMITER is not supported, there is nothing to fuse in that case.
+ */
+template<class FieldType, class GradientType, class RMatrixType>
+void computeGradientsAndLimiters(ENUM_FLOW_GRADIENT GradientKind,
+                                 ENUM_LIMITER LimiterKind,
+                                 CSolver* solver,
+                                 MPI_QUANTITIES kindMpiCommGrad,
+                                 MPI_QUANTITIES kindMpiCommLim,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 RMatrixType& Rmatrix,
+                                 FieldType& fieldMin,
+                                 FieldType& fieldMax,
+                                 FieldType& limiter)
+{
+  if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
+    SU2_MPI::Error("Too many dimensions to compute gradients and limiters.", CURRENT_FUNCTION);
+
+#define INSTANTIATE(KIND)\
+if (geometry.GetnDim() == 2) {\
+  detail::computeGradientsAndLimiters<2,KIND>(solver, kindMpiCommGrad, kindMpiCommLim, geometry, config, GradientKind,\
+                                              varBegin, varEnd, field, gradient, Rmatrix, fieldMin, fieldMax, limiter);\
+} else {\
+  detail::computeGradientsAndLimiters<3,KIND>(solver, kindMpiCommGrad, kindMpiCommLim, geometry, config, GradientKind,\
+                                              varBegin, varEnd, field, gradient, Rmatrix, fieldMin, fieldMax, limiter);\
+}
+  switch (LimiterKind) {
+    case BARTH_JESPERSEN:
+    {
+      INSTANTIATE(BARTH_JESPERSEN);
+      break;
+    }
+    case VENKATAKRISHNAN:
+    {
+      INSTANTIATE(VENKATAKRISHNAN);
+      break;
+    }
+    case VENKATAKRISHNAN_WANG:
+    {
+      INSTANTIATE(VENKATAKRISHNAN_WANG);
+      break;
+    }
+    case WALL_DISTANCE:
+    {
+      INSTANTIATE(WALL_DISTANCE);
+      break;
+    }
+    case SHARP_EDGES:
+    {
+      INSTANTIATE(SHARP_EDGES);
+      break;
+    }
+    default:
+    {
+      SU2_MPI::Error("Unknown or unsupported limiter type.", CURRENT_FUNCTION);
+      break;
+    }
+  }
+#undef INSTANTIATE
+}
@@ -25,6 +25,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
 
@@ -27,6 +27,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 
 /*!
  * \brief Generic limiter computation for methods based on one limiter
@@ -80,7 +82,6 @@ void computeLimiters_impl(CSolver* solver,
   if (varEnd > MAXNVAR)
     SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
 
-  const size_t nPointDomain = geometry.GetnPointDomain();
   const size_t nPoint = geometry.GetnPoint();
 
   /*--- If we do not have periodicity we can use a
@@ -93,6 +94,7 @@ void computeLimiters_impl(CSolver* solver,
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
+  const size_t nPointDomain = geometry.GetnPointDomain();
   const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
@@ -124,100 +126,110 @@ void computeLimiters_impl(CSolver* solver,
     }
   }
 
-  /*--- Compute limiter for each point. ---*/
+  /*--- Loop over the point colors when recording with threads (see CGeometry::GetPointLoopColors), except
+   *    for the Venkatakrishnan-Wang limiter, which reads global data (the range of the field). ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-  {
-    auto nodes = geometry.nodes;
-    const auto coord_i = nodes->GetCoord(iPoint);
+  bool colored = false;
+  const auto colors = geometry.GetPointLoopColors(colored, LimiterKind != VENKATAKRISHNAN_WANG);
+  if (colored) AD::StartNoSharedReading();
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(coord_i, nDim);
-
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+  for (const auto& color : colors) {
+    SU2_OMP_FOR_DYN(nextMultiple(chunkSize, color.groupSize))
+    for (size_t k = 0; k < color.size; ++k)
     {
-      AD::SetPreaccIn(field(iPoint,iVar));
+      const size_t iPoint = color[k];
+      auto nodes = geometry.nodes;
+      const auto coord_i = nodes->GetCoord(iPoint);
 
-      if (periodic) {
-        /*--- Started outside loop, so counts as input. ---*/
-        AD::SetPreaccIn(fieldMax(iPoint,iVar));
-        AD::SetPreaccIn(fieldMin(iPoint,iVar));
-      }
-      else {
-        /*--- Initialize min/max now for iPoint if not periodic. ---*/
-        fieldMax(iPoint,iVar) = field(iPoint,iVar);
-        fieldMin(iPoint,iVar) = field(iPoint,iVar);
-      }
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading, unless the loop is colored. ---*/
+      if (colored || omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(coord_i, nDim);
 
-      for(size_t iDim = 0; iDim < nDim; ++iDim)
-        AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
-    }
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        AD::SetPreaccIn(field(iPoint,iVar));
+
+        if (periodic) {
+          /*--- Started outside loop, so counts as input. ---*/
+          AD::SetPreaccIn(fieldMax(iPoint,iVar));
+          AD::SetPreaccIn(fieldMin(iPoint,iVar));
+        }
+        else {
+          /*--- Initialize min/max now for iPoint if not periodic. ---*/
+          fieldMax(iPoint,iVar) = field(iPoint,iVar);
+          fieldMin(iPoint,iVar) = field(iPoint,iVar);
+        }
 
-    /*--- Initialize min/max projection out of iPoint. ---*/
+        for(size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
+      }
 
-    su2double projMax[MAXNVAR], projMin[MAXNVAR];
+      /*--- Initialize min/max projection out of iPoint. ---*/
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      projMax[iVar] = projMin[iVar] = 0.0;
+      su2double projMax[MAXNVAR], projMin[MAXNVAR];
 
-    /*--- Compute max/min projection and values over direct neighbors. ---*/
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        projMax[iVar] = projMin[iVar] = 0.0;
 
-    for (auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+      /*--- Compute max/min projection and values over direct neighbors. ---*/
 
-      const auto coord_j = geometry.nodes->GetCoord(jPoint);
-      AD::SetPreaccIn(coord_j, nDim);
+      for (auto jPoint : geometry.nodes->GetPoints(iPoint)) {
 
-      /*--- Distance vector from iPoint to face (middle of the edge). ---*/
+        const auto coord_j = geometry.nodes->GetCoord(jPoint);
+        AD::SetPreaccIn(coord_j, nDim);
 
-      su2double dist_ij[nDim] = {0.0};
+        /*--- Distance vector from iPoint to face (middle of the edge). ---*/
 
-      for(size_t iDim = 0; iDim < nDim; ++iDim)
-        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+        su2double dist_ij[nDim] = {0.0};
 
-      /*--- Project each variable, update min/max. ---*/
+        for(size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
 
-      for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      {
-        su2double proj = 0.0;
+        /*--- Project each variable, update min/max. ---*/
 
-        for(size_t iDim = 0; iDim < nDim; ++iDim)
-          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+        for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          su2double proj = 0.0;
+
+          for(size_t iDim = 0; iDim < nDim; ++iDim)
+            proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
 
-        projMax[iVar] = max(projMax[iVar], proj);
-        projMin[iVar] = min(projMin[iVar], proj);
+          projMax[iVar] = max(projMax[iVar], proj);
+          projMin[iVar] = min(projMin[iVar], proj);
 
-        AD::SetPreaccIn(field(jPoint,iVar));
+          AD::SetPreaccIn(field(jPoint,iVar));
 
-        fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
-        fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+          fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
+          fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+        }
       }
-    }
 
-    /*--- Compute the geometric factor. ---*/
+      /*--- Compute the geometric factor. ---*/
 
-    su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+      su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
 
-    /*--- Final limiter computation for each variable, get the min limiter
-     *    out of the positive/negative projections and deltas. ---*/
+      /*--- Final limiter computation for each variable, get the min limiter
+       *    out of the positive/negative projections and deltas. ---*/
 
-    for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
-    {
-      su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
-                         fieldMax(iPoint,iVar) - field(iPoint,iVar));
+      for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                           fieldMax(iPoint,iVar) - field(iPoint,iVar));
 
-      su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
-                         fieldMin(iPoint,iVar) - field(iPoint,iVar));
+        su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                           fieldMin(iPoint,iVar) - field(iPoint,iVar));
 
-      limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+        limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
 
-      AD::SetPreaccOut(limiter(iPoint,iVar));
-    }
+        AD::SetPreaccOut(limiter(iPoint,iVar));
+      }
 
-    AD::EndPreacc();
+      AD::EndPreacc();
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
+
+  if (colored) AD::EndNoSharedReading();
 
   /*--- Account for periodic effects, take the minimum limiter on each periodic pair. ---*/
   if (periodic)
@@ -73,6 +73,8 @@ protected:
   const unsigned short fieldWidth = 12; /*!< \brief Width of each column for the screen output (hardcoded for now) */
   string historySep;              /*!< \brief Character which separates values in the history file */
   bool noWriting;                 /*!< \brief Boolean indicating whether a screen/history output should be written */
+  bool wrtScreen = true,          /*!< \brief Boolean indicating whether the screen output is enabled at runtime */
+       wrtHistory = true;         /*!< \brief Boolean indicating whether the history output is enabled at runtime */
   unsigned long curTimeIter,      /*!< \brief Current value of the time iteration index */
   curAbsTimeIter,                 /*!< \brief Current value of the time iteration index */
   curOuterIter,                   /*!< \brief Current value of the outer iteration index */
@@ -354,6 +356,16 @@ public:
    */
   inline string GetRestart_Filename() {return restartFilename;}
 
+  /*!
+   * \brief Enable or disable the screen and history output at runtime.
+   * \param[in] screen - Write the screen output.
+   * \param[in] history - Write the history output.
+   */
+  inline void SetScreenAndHistory_Output(bool screen, bool history) {
+    wrtScreen = screen;
+    wrtHistory = history;
+  }
+
   /*!
    * \brief Set the current iteration indices
    * \param[in] TimeIter  - Timer iteration index
@@ -410,6 +422,13 @@ public:
     return historyOutput_Map;
   }
 
+  /*!
+   * \brief Broadcast the values of the history fields, e.g. from the ranks that solve a zone to the others.
+   * \param[in] root - Rank that holds the values.
+   * \param[in] comm - Communicator of the broadcast.
+   */
+  void BroadcastHistoryOutput(int root, SU2_MPI::Comm comm);
+
   /*!
    * \brief Monitor the convergence of an output field
    * \param[in] config - Definition of the particular problem.
@@ -123,6 +123,17 @@ public:
    */
   void ExtractAdjoint_Solution(CGeometry *geometry, CConfig *config, bool CrossTerm) override;
 
+  /*!
+   * \brief Replace the adjoint solution, which must be the right hand side of the fixed-point adjoint
+   *        problem (i.e. the first iterate from zero), by the solution of the adjoint system linearized
+   *        with the (transposed) Jacobian of the direct solver.
+   * \note The recorded primal iteration is u - P^{-1} R(u), with P = A + D (D the pseudo-time term), hence
+   *       the adjoint is P^T A^{-T} b, which is exact if A is the exact Jacobian (it is approximate in general).
+   * \param[in] geometry - The geometrical definition of the problem.
+   * \param[in] config - The particular config.
+   */
+  void SetJacobianAdjointGuess(CGeometry *geometry, CConfig *config) override;
+
   /*!
    * \brief Set the surface sensitivity.
    * \param[in] geometry - Geometrical definition of the problem.
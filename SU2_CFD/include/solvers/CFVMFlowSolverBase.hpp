@@ -1146,6 +1146,27 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Compute the gradient of the primitive variables and their limiter in a single sweep.
+   * \note The limiter uses the reconstruction gradient, if "reconstruction" is false the
+   *       caller must ensure it is the same as the primitive gradient.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config, bool reconstruction);
+
+  /*!
+   * \brief Check if the reconstruction gradient and the limiter can be computed in a single sweep.
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>TRUE</code> if requested (FUSED_LIMITER_FLOW) and not prevented by periodicity
+   *         (partial gradients need to be communicated) or by frozen limiters in the adjoint.
+   */
+  inline bool FusedGradientLimiter(const CConfig* config) const {
+    return config->GetFusedLimiter_Flow() && (config->GetnMarker_Periodic() == 0) &&
+           !(config->GetDiscrete_Adjoint() && config->GetFrozen_Limiter_Disc());
+  }
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
@@ -1725,6 +1746,24 @@ class CFVMFlowSolverBase : public CSolver {
    */
   inline void SetTotal_CL(su2double val_Total_CL) final { TotalCoeff.CL = val_Total_CL; }
 
+  /*!
+   * \brief Store the total (inviscid + viscous) non dimensional x moment coefficient.
+   * \param[in] val_Total_CMx - Value of the total x moment coefficient.
+   */
+  inline void SetTotal_CMx(su2double val_Total_CMx) final { TotalCoeff.CMx = val_Total_CMx; }
+
+  /*!
+   * \brief Store the total (inviscid + viscous) non dimensional y moment coefficient.
+   * \param[in] val_Total_CMy - Value of the total y moment coefficient.
+   */
+  inline void SetTotal_CMy(su2double val_Total_CMy) final { TotalCoeff.CMy = val_Total_CMy; }
+
+  /*!
+   * \brief Store the total (inviscid + viscous) non dimensional z moment coefficient.
+   * \param[in] val_Total_CMz - Value of the total z moment coefficient.
+   */
+  inline void SetTotal_CMz(su2double val_Total_CMz) final { TotalCoeff.CMz = val_Total_CMz; }
+
   /*!
    * \brief Get the inviscid contribution to the lift coefficient.
    * \return Value of the lift coefficient (inviscid contribution).
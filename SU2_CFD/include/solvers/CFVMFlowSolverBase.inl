@@ -29,6 +29,7 @@
 #include "../gradients/computeGradientsGreenGauss.hpp"
 #include "../gradients/computeGradientsLeastSquares.hpp"
 #include "../limiters/computeLimiters.hpp"
+#include "../limiters/computeGradientsAndLimiters.hpp"
 #include "../numerics_simd/CNumericsSIMD.hpp"
 #include "CFVMFlowSolverBase.hpp"
 
@@ -335,6 +336,11 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
 
   if (ReducerStrategy) EdgeFluxes.Initialize(geometry.GetnEdge(), geometry.GetnEdge(), nVar, nullptr);
 
+#ifdef HAVE_OPDI
+  /*--- Point coloring to preaccumulate the gradients and limiters (see CGeometry::GetPointLoopColors). ---*/
+  if (config.GetDiscrete_Adjoint()) geometry.GetPointColoring();
+#endif
+
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
 #else
   EdgeColoring[0] = DummyGridColor<>(geometry.GetnEdge());
@@ -401,6 +407,24 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
                   nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config,
+                                                             bool reconstruction) {
+  auto kindGradient = static_cast<ENUM_FLOW_GRADIENT>(reconstruction ? config->GetKind_Gradient_Method_Recon()
+                                                                     : config->GetKind_Gradient_Method());
+  auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
+  const auto& primitives = nodes->GetPrimitive();
+  auto& rmatrix = nodes->GetRmatrix();
+  auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiter = nodes->GetLimiter_Primitive();
+  const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
+
+  computeGradientsAndLimiters(kindGradient, kindLimiter, this, comm, PRIMITIVE_LIMITER, *geometry, *config, 0,
+                              nPrimVarGrad, primitives, gradient, rmatrix, primMin, primMax, limiter);
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::Viscous_Residual_impl(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                                      CNumerics *numerics, CConfig *config) {
@@ -571,6 +595,11 @@ void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSol
 
   PrepareImplicitIteration(geometry, nullptr, config);
 
+  /*--- With the coupled harmonic balance solver, the system of all time instances
+   *    is solved by the driver, which then completes the iteration. ---*/
+
+  if (config->GetHB_CoupledImplicit()) return;
+
   /*--- Solve or smooth the linear system. ---*/
 
   SU2_OMP_FOR_(schedule(static,OMP_MIN_SIZE) SU2_NOWAIT)
@@ -1659,6 +1659,24 @@ public:
    */
   inline virtual void SetTotal_CL(su2double val_Total_CL) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_Total_CMx - Value of the total x moment coefficient.
+   */
+  inline virtual void SetTotal_CMx(su2double val_Total_CMx) { }
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_Total_CMy - Value of the total y moment coefficient.
+   */
+  inline virtual void SetTotal_CMy(su2double val_Total_CMy) { }
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_Total_CMz - Value of the total z moment coefficient.
+   */
+  inline virtual void SetTotal_CMz(su2double val_Total_CMz) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] val_Total_CD - Value of the total drag coefficient.
@@ -3620,6 +3638,13 @@ public:
    */
   inline virtual void ExtractAdjoint_Solution(CGeometry *geometry, CConfig *config, bool CrossTerm){}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - The geometrical definition of the problem.
+   * \param[in] config - The particular config.
+   */
+  inline virtual void SetJacobianAdjointGuess(CGeometry *geometry, CConfig *config){}
+
   /*!
    * \brief  A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
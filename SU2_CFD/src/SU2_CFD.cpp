@@ -120,6 +120,9 @@ int main(int argc, char *argv[]) {
     if (disc_adj) {
       driver = new CDiscAdjSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
+    else if (config.GetParareal_TimeSlices() > 1) {
+      driver = new CPararealDriver(config_file_name, nZone, MPICommunicator);
+    }
     else {
       driver = new CSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
@@ -148,6 +148,14 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CDiscAdjSinglezoneDriver::Run() {
 
+  /*--- Krylov method, for steady problems, otherwise fixed-point possibly with quasi-Newton. ---*/
+
+  if (config->GetNewtonKrylov() && !config->GetTime_Domain() &&
+      (config->GetnQuasiNewtonSamples() >= KrylovMinIters) && (nAdjoint_Iter > KrylovMinIters)) {
+    KrylovIterations();
+    return;
+  }
+
   CQuasiNewtonInvLeastSquares<passivedouble> fixPtCorrector;
   if (config->GetnQuasiNewtonSamples() > 1) {
     fixPtCorrector.resize(config->GetnQuasiNewtonSamples(),
@@ -155,58 +163,149 @@ void CDiscAdjSinglezoneDriver::Run() {
                           GetTotalNumberOfVariables(ZONE_0,true),
                           geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain());
 
-    if (TimeIter != 0) GetAllSolutions(ZONE_0, true, fixPtCorrector);
+    /*--- The history starts from the current solution (previous time step or restart). ---*/
+    if ((TimeIter != 0) || config->GetRestart()) GetAllSolutions(ZONE_0, true, fixPtCorrector);
   }
 
   for (auto Adjoint_Iter = 0ul; Adjoint_Iter < nAdjoint_Iter; Adjoint_Iter++) {
 
-    /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
-     *--- of the previous iteration. The values are passed to the AD tool.
-     *--- Issues with iteration number should be dealt with once the output structure is in place. ---*/
+    StopCalc = Iterate(Adjoint_Iter);
+
+    if (StopCalc) break;
+
+    /*--- Correct the solution with the quasi-Newton approach. ---*/
+
+    if (fixPtCorrector.size()) {
+      GetAllSolutions(ZONE_0, true, fixPtCorrector.FPresult());
+      SetAllSolutions(ZONE_0, true, fixPtCorrector.compute());
+    }
+
+  }
+
+}
+
+bool CDiscAdjSinglezoneDriver::Iterate(unsigned long Adjoint_Iter) {
 
-    config->SetInnerIter(Adjoint_Iter);
+  /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
+   *--- of the previous iteration. The values are passed to the AD tool.
+   *--- Issues with iteration number should be dealt with once the output structure is in place. ---*/
 
-    iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+  config->SetInnerIter(Adjoint_Iter);
 
-    /*--- Initialize the adjoint of the objective function with 1.0. ---*/
+  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
 
-    SetAdj_ObjFunction();
+  /*--- Initialize the adjoint of the objective function with 1.0. ---*/
 
-    /*--- Interpret the stored information by calling the corresponding routine of the AD tool. ---*/
+  SetAdj_ObjFunction();
 
-    AD::ComputeAdjoint();
+  /*--- Interpret the stored information by calling the corresponding routine of the AD tool. ---*/
 
-    /*--- Extract the computed adjoint values of the input variables and store them for the next iteration. ---*/
+  AD::ComputeAdjoint();
 
-    iteration->IterateDiscAdj(geometry_container, solver_container,
-                              config_container, ZONE_0, INST_0, false);
+  /*--- Extract the computed adjoint values of the input variables and store them for the next iteration. ---*/
 
-    /*--- Monitor the pseudo-time ---*/
+  iteration->IterateDiscAdj(geometry_container, solver_container,
+                            config_container, ZONE_0, INST_0, false);
 
-    StopCalc = iteration->Monitor(output_container[ZONE_0], integration_container, geometry_container,
-                                  solver_container, numerics_container, config_container,
-                                  surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+  /*--- Starting from zero, the first iterate is the right hand side of the fixed-point adjoint
+   *--- problem, replace it by the solution of the Jacobian-based adjoint system. ---*/
 
-    /*--- Clear the stored adjoint information to be ready for a new evaluation. ---*/
+  if ((Adjoint_Iter == 0) && config->GetDiscAdj_JacobianGuess() && !config->GetRestart()) {
+    solver[MainSolver]->SetJacobianAdjointGuess(geometry, config);
+  }
 
-    AD::ClearAdjoints();
+  /*--- Monitor the pseudo-time ---*/
 
-    /*--- Output files for steady state simulations. ---*/
+  const bool converged = iteration->Monitor(output_container[ZONE_0], integration_container, geometry_container,
+                                            solver_container, numerics_container, config_container,
+                                            surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
 
-    if (!config->GetTime_Domain()) {
-      iteration->Output(output_container[ZONE_0], geometry_container, solver_container,
-                        config_container, Adjoint_Iter, false, ZONE_0, INST_0);
-    }
+  /*--- Clear the stored adjoint information to be ready for a new evaluation. ---*/
 
-    if (StopCalc) break;
+  AD::ClearAdjoints();
 
-    /*--- Correct the solution with the quasi-Newton approach. ---*/
+  /*--- Output files for steady state simulations. ---*/
 
-    if (fixPtCorrector.size()) {
-      GetAllSolutions(ZONE_0, true, fixPtCorrector.FPresult());
-      SetAllSolutions(ZONE_0, true, fixPtCorrector.compute());
+  if (!config->GetTime_Domain()) {
+    iteration->Output(output_container[ZONE_0], geometry_container, solver_container,
+                      config_container, Adjoint_Iter, false, ZONE_0, INST_0);
+  }
+
+  return converged;
+}
+
+void CDiscAdjSinglezoneDriver::EvaluateAdjoint(bool objective) {
+
+  /*--- As if it was the first inner iteration to avoid relaxing the solution. ---*/
+
+  const auto innerIter = config->GetInnerIter();
+  config->SetInnerIter(0);
+
+  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+
+  if (objective) SetAdj_ObjFunction();
+  else SU2_TYPE::SetDerivative(ObjFunc, 0.0);
+
+  AD::ComputeAdjoint();
+
+  iteration->IterateDiscAdj(geometry_container, solver_container,
+                            config_container, ZONE_0, INST_0, false);
+
+  AD::ClearAdjoints();
+
+  config->SetInnerIter(innerIter);
+}
+
+void CDiscAdjSinglezoneDriver::KrylovIterations() {
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = GetTotalNumberOfVariables(ZONE_0, true);
+
+  AdjRHS.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  AdjSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  LinSolver.SetToleranceType(LinearToleranceType::RELATIVE);
+
+  /*--- The adjoint satisfies x = G^T x + b, where b (the gradient of the objective function through
+   *    the iteration) is the result of iterating from 0. We solve (G^T - I) x = -b starting from
+   *    the current solution, which makes restarts (RESTART_SOL= YES) safe. ---*/
+
+  GetAllSolutions(ZONE_0, true, AdjSol);
+
+  SetAllSolutions(ZONE_0, true, AdjRHS);
+  EvaluateAdjoint(true);
+  GetAllSolutions(ZONE_0, true, AdjRHS);
+  AdjRHS *= -1.0;
+
+  const auto product = AdjointProduct(this);
+
+  /*--- Each product is a tape evaluation and counts as one iteration. ---*/
+
+  for (auto Adjoint_Iter = 1ul; Adjoint_Iter + KrylovMinIters <= nAdjoint_Iter;) {
+
+    /*--- Reduce the residual by KrylovTol with restarted FGMRES, as in the multizone driver the
+     *    tolerance of each cycle adapts to the reduction obtained by the previous ones, and the
+     *    cycles stop early once it is reached. Each cycle uses +1 evaluation for the initial residual. ---*/
+
+    Scalar eps = 1.0;
+    while (eps > KrylovTol && Adjoint_Iter + KrylovMinIters <= nAdjoint_Iter) {
+      Scalar eps_l = 0.0;
+      Scalar tol_l = KrylovTol / eps;
+      const auto maxIter = min(nAdjoint_Iter-Adjoint_Iter-2ul, config->GetnQuasiNewtonSamples()-2ul);
+      Adjoint_Iter += 1 + LinSolver.FGMRES_LinSolver(AdjRHS, AdjSol, product, Identity(),
+                                                     tol_l, maxIter, eps_l, false, config);
+      eps *= eps_l;
     }
 
+    /*--- Iterate normally from the Krylov solution to monitor the residuals and write the output. ---*/
+
+    SetAllSolutions(ZONE_0, true, AdjSol);
+
+    StopCalc = Iterate(Adjoint_Iter++);
+
+    GetAllSolutions(ZONE_0, true, AdjSol);
+
+    if (StopCalc) break;
   }
 
 }
@@ -86,10 +86,12 @@
 #include "../../include/integration/CIntegrationFactory.hpp"
 
 #include "../../include/iteration/CIterationFactory.hpp"
+#include "../../include/iteration/CFluidIteration.hpp"
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 
 #include <cassert>
+#include <numeric>
 
 #ifdef VTUNEPROF
 #include <ittnotify.h>
@@ -124,6 +126,18 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   Input_Preprocessing(config_container, driver_config);
 
+  /*--- Distribute the ranks among the zones if they are solved concurrently. ---*/
+
+  ConcurrentZones_Preprocessing();
+
+  /*--- Distribute the ranks among the time instances if they are solved concurrently. ---*/
+
+  ConcurrentInstances_Preprocessing();
+
+  /*--- Distribute the ranks among the time slices if they are solved concurrently. ---*/
+
+  ConcurrentTimeSlices_Preprocessing();
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -161,7 +175,8 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
-      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst],
+                                dry_run || !ZoneIsLocal(iZone) || !InstanceIsLocal(iInst));
 
     }
   }
@@ -171,7 +186,7 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
   if (rank == MASTER_NODE)
     cout << "Computing wall distances." << endl;
 
-  CGeometry::ComputeWallDistance(config_container, geometry_container);
+  CGeometry::ComputeWallDistance(config_container, geometry_container, AllZonesComm());
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -226,7 +241,7 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   /*! --- Compute the wall distance again to correctly compute the derivatives if we are running direct diff mode --- */
   if (driver_config->GetDirectDiff() == D_DESIGN){
-    CGeometry::ComputeWallDistance(config_container, geometry_container);
+    CGeometry::ComputeWallDistance(config_container, geometry_container, AllZonesComm());
   }
 
   /*--- Definition of the interface and transfer conditions between different zones. ---*/
@@ -241,6 +256,7 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   if (fsi) {
     for (iZone = 0; iZone < nZone; iZone++) {
+      if (!ZoneIsLocal(iZone)) continue;
       for (iInst = 0; iInst < nInst[iZone]; iInst++){
         Solver_Restart(solver_container[iZone][iInst], geometry_container[iZone][iInst],
                        config_container[iZone], true);
@@ -276,11 +292,19 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
   Mpoints            = 0.0;
   MpointsDomain      = 0.0;
   for (iZone = 0; iZone < nZone; iZone++) {
+    if (!ZoneIsLocal(iZone)) continue;
     Mpoints       += geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPoint()/(1.0e6);
     MpointsDomain += geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()/(1.0e6);
     MDOFs         += DOFsPerPoint*geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPoint()/(1.0e6);
     MDOFsDomain   += DOFsPerPoint*geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()/(1.0e6);
   }
+  if (concurrent_zones) {
+    /*--- Each zone is counted by the first rank of its group. ---*/
+    su2double sendBuf[] = {Mpoints, MpointsDomain, MDOFs, MDOFsDomain}, recvBuf[4];
+    if (rank != zone_root_rank[rank_zone]) for (auto& val : sendBuf) val = 0.0;
+    SU2_MPI::Allreduce(sendBuf, recvBuf, 4, MPI_DOUBLE, MPI_SUM, driver_comm);
+    Mpoints = recvBuf[0]; MpointsDomain = recvBuf[1]; MDOFs = recvBuf[2]; MDOFsDomain = recvBuf[3];
+  }
 
   /*--- Reset timer for compute/output performance benchmarking. ---*/
 
@@ -352,6 +376,10 @@ void CDriver::Postprocessing() {
 
   const bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
 
+  /*--- Concurrent zones or instances, return to the communicator of the driver. ---*/
+
+  if (concurrent_zones || concurrent_instances || concurrent_slices) SU2_MPI::SetComm(driver_comm);
+
     /*--- Output some information to the console. ---*/
 
   if (rank == MASTER_NODE) {
@@ -491,6 +519,10 @@ void CDriver::Postprocessing() {
 
   if (rank == MASTER_NODE) cout << "Deleted COutput class." << endl;
 
+  if (concurrent_zones || concurrent_instances || concurrent_slices) SU2_MPI::Comm_free(&zone_comm);
+  if (concurrent_instances) SU2_MPI::Comm_free(&instance_comm);
+  if (concurrent_slices) SU2_MPI::Comm_free(&slice_comm);
+
   if (rank == MASTER_NODE) cout << "-------------------------------------------------------------------------" << endl;
 
 
@@ -599,6 +631,235 @@ void CDriver::Input_Preprocessing(CConfig **&config, CConfig *&driver_config) {
   fsi = config_container[ZONE_0]->GetFSI_Simulation();
 }
 
+void CDriver::ConcurrentZones_Preprocessing() {
+
+  driver_comm = SU2_MPI::GetComm();
+  zone_comm = driver_comm;
+
+  concurrent_zones = (nZone > 1) && driver_config->GetConcurrent_Zones() && !dry_run;
+
+  if (!concurrent_zones) return;
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"--------------------- Concurrent Zones Preprocessing --------------------" << endl;
+
+  /*--- The zones of a Jacobi iteration are independent between transfers, the other modes
+   *    need all zones in sequence or one partition of all zones. ---*/
+
+  if (driver_config->GetKind_MZSolver() != ENUM_MULTIZONE::MZ_BLOCK_JACOBI)
+    SU2_MPI::Error("CONCURRENT_ZONES requires MULTIZONE_SOLVER= BLOCK_JACOBI.", CURRENT_FUNCTION);
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto config = config_container[iZone];
+    if (config->GetDiscrete_Adjoint() || config->GetContinuous_Adjoint())
+      SU2_MPI::Error("CONCURRENT_ZONES is not available for adjoint problems.", CURRENT_FUNCTION);
+    if (config->GetBoolTurbomachinery())
+      SU2_MPI::Error("CONCURRENT_ZONES is not available for turbomachinery problems.", CURRENT_FUNCTION);
+    if (config->GetnTimeInstances() > 1)
+      SU2_MPI::Error("CONCURRENT_ZONES is not available for harmonic balance problems.", CURRENT_FUNCTION);
+  }
+
+  if (size < nZone)
+    SU2_MPI::Error("CONCURRENT_ZONES requires at least one rank per zone.", CURRENT_FUNCTION);
+
+  /*--- Relative cost of each zone, by default the number of elements (read by the master). ---*/
+
+  vector<passivedouble> cost(nZone, 1.0);
+
+  if (driver_config->GetnZone_CostWeights() != 0) {
+    if (driver_config->GetnZone_CostWeights() != nZone)
+      SU2_MPI::Error("The number of ZONE_COST_WEIGHTS must match the number of zones.", CURRENT_FUNCTION);
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      cost[iZone] = SU2_TYPE::GetValue(driver_config->GetZone_CostWeights(iZone));
+      if (cost[iZone] <= 0.0)
+        SU2_MPI::Error("The ZONE_COST_WEIGHTS must be positive.", CURRENT_FUNCTION);
+    }
+  }
+  else {
+    vector<unsigned long> nElem(nZone, 0);
+
+    if (rank == MASTER_NODE) {
+      for (iZone = 0; iZone < nZone; iZone++) {
+        const auto config = config_container[iZone];
+        nElem[iZone] = CConfig::GetnElem(config->GetMesh_FileName(), config->GetMesh_FileFormat(),
+                                         config->GetMultizone_Mesh()? iZone : 0);
+      }
+    }
+    SU2_MPI::Bcast(nElem.data(), nZone, MPI_UNSIGNED_LONG, MASTER_NODE, driver_comm);
+
+    /*--- Equal costs if any zone is unknown. ---*/
+    if (find(nElem.begin(), nElem.end(), 0ul) == nElem.end()) {
+      for (iZone = 0; iZone < nZone; iZone++) cost[iZone] = nElem[iZone];
+    }
+  }
+
+  /*--- One rank per zone, then each additional rank goes to the zone with the largest cost
+   *    per rank, which minimizes the cost of the slowest zone (all zones wait for it). ---*/
+
+  vector<int> nRankZone(nZone, 1);
+
+  for (int iRank = nZone; iRank < size; iRank++) {
+    unsigned short jZone = 0;
+    for (iZone = 1; iZone < nZone; iZone++) {
+      if (cost[iZone] / nRankZone[iZone] > cost[jZone] / nRankZone[jZone]) jZone = iZone;
+    }
+    nRankZone[jZone]++;
+  }
+
+  /*--- Contiguous groups of ranks. ---*/
+
+  zone_root_rank.resize(nZone+1);
+  zone_root_rank[0] = 0;
+  for (iZone = 0; iZone < nZone; iZone++) {
+    zone_root_rank[iZone+1] = zone_root_rank[iZone] + nRankZone[iZone];
+    if (rank >= zone_root_rank[iZone] && rank < zone_root_rank[iZone+1]) rank_zone = iZone;
+  }
+  zone_root_rank.pop_back();
+
+  SU2_MPI::Comm_split(driver_comm, rank_zone, rank, &zone_comm);
+
+  /*--- The groups work independently between transfers, the operations that involve all zones
+   *    (interpolation, transfer, wall distance, multizone output) use the driver communicator
+   *    explicitly, hence the switch is permanent (until postprocessing). ---*/
+
+  SU2_MPI::SetComm(zone_comm);
+  for (iZone = 0; iZone < nZone; iZone++)
+    config_container[iZone]->SetMPICommunicator(zone_comm);
+
+  if (rank == MASTER_NODE) {
+    const auto totalCost = accumulate(cost.begin(), cost.end(), passivedouble(0.0));
+    for (iZone = 0; iZone < nZone; iZone++) {
+      cout << "Zone " << iZone << ": " << nRankZone[iZone] << " rank(s), starting at rank " << zone_root_rank[iZone]
+           << ", relative cost " << cost[iZone] / totalCost << "." << endl;
+    }
+  }
+
+}
+
+void CDriver::ConcurrentInstances_Preprocessing() {
+
+  instance_comm = driver_comm;
+
+  const auto config = config_container[ZONE_0];
+  const unsigned short nGroup = config->GetHB_InstanceGroups();
+  const unsigned short nInstTotal = config->GetnTimeInstances();
+
+  inst_end = nInstTotal;
+
+  concurrent_instances = (nGroup > 1) && !dry_run && (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
+
+  if (!concurrent_instances) return;
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------- Concurrent Instances Preprocessing ------------------" << endl;
+
+  if (nZone > 1)
+    SU2_MPI::Error("HB_INSTANCE_GROUPS is only available for single zone problems.", CURRENT_FUNCTION);
+  if (config->GetBoolTurbomachinery())
+    SU2_MPI::Error("HB_INSTANCE_GROUPS is not available for turbomachinery problems.", CURRENT_FUNCTION);
+  if (nGroup > nInstTotal)
+    SU2_MPI::Error("HB_INSTANCE_GROUPS cannot exceed the number of TIME_INSTANCES.", CURRENT_FUNCTION);
+
+  /*--- Groups of equal size partition the mesh identically, which allows the instances to be
+   *    coupled point-by-point between counterpart ranks. ---*/
+
+  if (size % nGroup != 0)
+    SU2_MPI::Error("The number of ranks must be a multiple of HB_INSTANCE_GROUPS.", CURRENT_FUNCTION);
+
+  const int groupSize = size / nGroup;
+
+  rank_group = rank / groupSize;
+  inst_begin = (rank_group * nInstTotal) / nGroup;
+  inst_end = ((rank_group + 1) * nInstTotal) / nGroup;
+
+  SU2_MPI::Comm_split(driver_comm, rank_group, rank, &zone_comm);
+  SU2_MPI::Comm_split(driver_comm, rank % groupSize, rank_group, &instance_comm);
+
+  /*--- The groups work independently except for the coupling of the instances, which is
+   *    explicit in the HB driver, hence the switch is permanent (until postprocessing). ---*/
+
+  SU2_MPI::SetComm(zone_comm);
+  config->SetMPICommunicator(zone_comm);
+
+  if (rank == MASTER_NODE) {
+    for (unsigned short iGroup = 0; iGroup < nGroup; iGroup++) {
+      cout << "Instances " << (iGroup * nInstTotal) / nGroup << " to " << ((iGroup + 1) * nInstTotal) / nGroup - 1
+           << ": " << groupSize << " rank(s), starting at rank " << iGroup * groupSize << "." << endl;
+    }
+  }
+
+}
+
+void CDriver::ConcurrentTimeSlices_Preprocessing() {
+
+  slice_comm = driver_comm;
+
+  const auto config = config_container[ZONE_0];
+  const unsigned short nSlice = config->GetParareal_TimeSlices();
+  const bool dual_time = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
+                         (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+
+  const unsigned long timeBegin = config->GetRestart()? config->GetRestart_Iter() : 0;
+  const unsigned long timeEnd = config->GetnTime_Iter();
+
+  slice_begin = timeBegin;
+  slice_end = timeEnd;
+
+  concurrent_slices = (nSlice > 1) && !dry_run;
+
+  if (!concurrent_slices) return;
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------ Concurrent Time Slices Preprocessing -----------------" << endl;
+
+  if (nZone > 1 || config->GetMultizone_Problem())
+    SU2_MPI::Error("PARAREAL_TIME_SLICES is only available for single zone problems.", CURRENT_FUNCTION);
+  if (!dual_time || config->GetUnst_CFL() != 0.0)
+    SU2_MPI::Error("PARAREAL_TIME_SLICES requires dual time stepping with a fixed TIME_STEP (UNST_CFL_NUMBER= 0).", CURRENT_FUNCTION);
+  if (config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint())
+    SU2_MPI::Error("PARAREAL_TIME_SLICES is not available for adjoint problems.", CURRENT_FUNCTION);
+  if (config->GetGrid_Movement() || config->GetDeform_Mesh() || config->GetBoolTurbomachinery())
+    SU2_MPI::Error("PARAREAL_TIME_SLICES is not available with grid movement or for turbomachinery problems.", CURRENT_FUNCTION);
+  if (!config->GetFluidProblem() && !config->GetHeatProblem())
+    SU2_MPI::Error("PARAREAL_TIME_SLICES is only available for fluid and heat problems.", CURRENT_FUNCTION);
+  if (timeEnd < timeBegin + nSlice)
+    SU2_MPI::Error("PARAREAL_TIME_SLICES cannot exceed the number of time iterations.", CURRENT_FUNCTION);
+
+  /*--- Groups of equal size partition the mesh identically, which allows the state at the end
+   *    of a slice to be sent point-by-point to the counterpart rank of the next slice. ---*/
+
+  if (size % nSlice != 0)
+    SU2_MPI::Error("The number of ranks must be a multiple of PARAREAL_TIME_SLICES.", CURRENT_FUNCTION);
+
+  const int groupSize = size / nSlice;
+  const auto nTime = timeEnd - timeBegin;
+
+  rank_slice = rank / groupSize;
+  slice_begin = timeBegin + (rank_slice * nTime) / nSlice;
+  slice_end = timeBegin + ((rank_slice + 1) * nTime) / nSlice;
+
+  /*--- The rank in slice_comm is the index of the slice. ---*/
+
+  SU2_MPI::Comm_split(driver_comm, rank_slice, rank, &zone_comm);
+  SU2_MPI::Comm_split(driver_comm, rank % groupSize, rank_slice, &slice_comm);
+
+  /*--- The slices only exchange their initial states, the switch is permanent (until postprocessing). ---*/
+
+  SU2_MPI::SetComm(zone_comm);
+  config->SetMPICommunicator(zone_comm);
+  config->SetParareal_SliceBegin(slice_begin);
+
+  if (rank == MASTER_NODE) {
+    for (unsigned short iSlice = 0; iSlice < nSlice; iSlice++) {
+      cout << "Time iterations " << timeBegin + (iSlice * nTime) / nSlice << " to "
+           << timeBegin + ((iSlice + 1) * nTime) / nSlice - 1 << ": " << groupSize
+           << " rank(s), starting at rank " << iSlice * groupSize << "." << endl;
+    }
+  }
+
+}
+
 void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry, bool dummy){
 
   if (!dummy){
@@ -1028,6 +1289,10 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
   /*--- Restart solvers, for FSI the geometry cannot be updated because the interpolation classes
    * should always use the undeformed mesh (otherwise the results would not be repeatable). ---*/
 
+  /*--- Zones and instances solved by other ranks (concurrent zones or instances) only need the containers. ---*/
+
+  if (!ZoneIsLocal(config->GetiZone()) || !InstanceIsLocal(iInst)) return;
+
   if (!fsi) Solver_Restart(solver, geometry, config, true);
 
   /*--- Set up any necessary inlet profiles ---*/
@@ -2288,7 +2553,7 @@ void CDriver::Interface_Preprocessing(CConfig **config, CSolver***** solver, CGe
 
       /*--- If there is a common interface setup the interpolation and transfer. ---*/
 
-      if (!CInterpolator::CheckZonesInterface(config[donor], config[target])) {
+      if (!CInterpolator::CheckZonesInterface(config[donor], config[target], AllZonesComm())) {
         interface_type = NO_COMMON_INTERFACE;
       }
       else {
@@ -2299,7 +2564,8 @@ void CDriver::Interface_Preprocessing(CConfig **config, CSolver***** solver, CGe
         /*--- Setup the interpolation. ---*/
 
         interpolation[donor][target] = unique_ptr<CInterpolator>(CInterpolatorFactory::CreateInterpolator(
-                                       geometry, config, interpolation[target][donor].get(), donor, target));
+                                       geometry, config, interpolation[target][donor].get(), donor, target,
+                                       AllZonesComm()));
 
         /*--- The type of variables transferred depends on the donor/target physics. ---*/
 
@@ -2490,6 +2756,9 @@ void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COu
    surface comma-separated value, and convergence history files (both in serial
    and in parallel). ---*/
 
+  /*--- With concurrent zones, the outputs of the zones belong to the group of ranks of each zone
+   *    (communicator of their config), and only the group that solves a zone writes its files. ---*/
+
   for (iZone = 0; iZone < nZone; iZone++){
 
     if (rank == MASTER_NODE)
@@ -2500,7 +2769,7 @@ void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COu
     output[iZone] = COutputFactory::CreateOutput(kindSolver, config[iZone], nDim);
 
     /*--- If dry-run is used, do not open/overwrite history file. ---*/
-    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run);
+    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run && ZoneIsLocal(iZone) && (rank_group == 0));
 
     output[iZone]->PreprocessVolumeOutput(config[iZone]);
 
@@ -2737,8 +3006,10 @@ void CFluidDriver::Preprocess(unsigned long Iter) {
   if(!fsi) {
     for (iZone = 0; iZone < nZone; iZone++) {
       if (config_container[iZone]->GetFluidProblem()) {
-        for (iInst = 0; iInst < nInst[iZone]; iInst++)
-          solver_container[iZone][iInst][MESH_0][FLOW_SOL]->SetInitialCondition(geometry_container[iZone][INST_0], solver_container[iZone][iInst], config_container[iZone], Iter);
+        for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+          if (!InstanceIsLocal(iInst)) continue;
+          solver_container[iZone][iInst][MESH_0][FLOW_SOL]->SetInitialCondition(geometry_container[iZone][iInst], solver_container[iZone][iInst], config_container[iZone], Iter);
+        }
       }
     }
   }
@@ -2884,6 +3155,14 @@ bool CFluidDriver::Monitor(unsigned long ExtIter) {
       StopCalc = integration_container[ZONE_0][INST_0][ADJFLOW_SOL]->GetConvergence(); break;
   }
 
+  /*--- With concurrent instances, the group of the first instance decides for all. ---*/
+
+  if (concurrent_instances) {
+    int stop = StopCalc;
+    SU2_MPI::Bcast(&stop, 1, MPI_INT, 0, instance_comm);
+    StopCalc = stop;
+  }
+
   /*--- Set StopCalc to true if max. number of iterations has been reached ---*/
 
   StopCalc = StopCalc || (ExtIter == Max_Iter - 1);
@@ -2899,6 +3178,7 @@ void CFluidDriver::Output(unsigned long InnerIter) {
     const auto inst = config_container[iZone]->GetiInst();
 
     for (iInst = 0; iInst < nInst[iZone]; ++iInst) {
+      if (!InstanceIsLocal(iInst)) continue;
       config_container[iZone]->SetiInst(iInst);
       output_container[iZone]->SetResult_Files(geometry_container[iZone][iInst][MESH_0],
                                                config_container[iZone],
@@ -2991,13 +3271,19 @@ void CTurbomachineryDriver::SetMixingPlane(unsigned short donorZone){
   unsigned short targetZone, nMarkerInt, iMarkerInt ;
   nMarkerInt     = config_container[donorZone]->GetnMarker_MixingPlaneInterface()/2;
 
+  if (nZone < 2) return;
+
+  /* --- gather the average values of all the interfaces of the donorZone once, they do not depend on the target ---*/
+  vector<vector<su2double> > donorAverages;
+  CMixingPlaneInterface::AllgatherDonorAverages(solver_container[donorZone][INST_0][MESH_0][FLOW_SOL],
+      geometry_container[donorZone][INST_0][MESH_0], config_container[donorZone], donorAverages);
+
   /* --- transfer the average value from the donorZone to the targetZone*/
   for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++){
     for (targetZone = 0; targetZone < nZone; targetZone++) {
       if (targetZone != donorZone){
-        interface_container[donorZone][targetZone]->AllgatherAverage(solver_container[donorZone][INST_0][MESH_0][FLOW_SOL],solver_container[targetZone][INST_0][MESH_0][FLOW_SOL],
-            geometry_container[donorZone][INST_0][MESH_0],geometry_container[targetZone][INST_0][MESH_0],
-            config_container[donorZone], config_container[targetZone], iMarkerInt );
+        interface_container[donorZone][targetZone]->SetTargetAverages(donorAverages[iMarkerInt-1], solver_container[targetZone][INST_0][MESH_0][FLOW_SOL],
+            geometry_container[targetZone][INST_0][MESH_0], config_container[donorZone], config_container[targetZone], iMarkerInt );
       }
     }
   }
@@ -3161,8 +3447,20 @@ CHBDriver::CHBDriver(char* confFile,
   /*--- allocate dynamic memory for the Harmonic Balance operator ---*/
   D = new su2double*[nInstHB]; for (kInst = 0; kInst < nInstHB; kInst++) D[kInst] = new su2double[nInstHB];
 
+  /*--- The operator is computed on the first update, until then the instances are not coupled
+   *    (consistent with the source terms, which are also computed there). ---*/
+  for (kInst = 0; kInst < nInstHB; kInst++)
+    for (unsigned short jInst = 0; jInst < nInstHB; jInst++) D[kInst][jInst] = 0.0;
+
+  /*--- With concurrent instances, the convergence history (of the instances of the first group)
+   *    and the special output of the HB problem are written by the master rank of the driver. ---*/
+
+  if (concurrent_instances) SU2_MPI::SetComm(driver_comm);
+
   output_legacy = COutputFactory::CreateLegacyOutput(config_container[ZONE_0]);
 
+  if (concurrent_instances) SU2_MPI::SetComm(zone_comm);
+
   /*--- Open the convergence history file ---*/
   ConvHist_file = nullptr;
   ConvHist_file = new ofstream*[nZone];
@@ -3171,6 +3469,7 @@ CHBDriver::CHBDriver(char* confFile,
     if (rank == MASTER_NODE){
       ConvHist_file[iZone] = new ofstream[nInst[iZone]];
       for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+        if (!InstanceIsLocal(iInst)) continue;
         output_legacy->SetConvHistory_Header(&ConvHist_file[iZone][iInst], config_container[iZone], iZone, iInst);
       }
     }
@@ -3205,20 +3504,24 @@ void CHBDriver::Run() {
   /*--- Run a single iteration of a Harmonic Balance problem. Preprocess all
    all zones before beginning the iteration. ---*/
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
+  for (iInst = inst_begin; iInst < inst_end; iInst++)
     iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
+  for (iInst = inst_begin; iInst < inst_end; iInst++)
     iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
+  if (config_container[ZONE_0]->GetHB_CoupledImplicit()) SolveCoupledImplicit();
+
+  ReduceHarmonicBalance_Coefficients();
+
   /*--- Update the convergence history file (serial and parallel computations). ---*/
 
   for (iZone = 0; iZone < nZone; iZone++) {
-    for (iInst = 0; iInst < nInst[iZone]; iInst++)
+    for (iInst = inst_begin; iInst < inst_end; iInst++)
       output_legacy->SetConvHistory_Body(&ConvHist_file[iZone][iInst], geometry_container, solver_container,
           config_container, integration_container, false, UsedTime, iZone, iInst);
   }
@@ -3227,11 +3530,8 @@ void CHBDriver::Run() {
 
 void CHBDriver::Update() {
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
-
-  }
+  /*--- Compute the harmonic balance terms across all zones ---*/
+  SetHarmonicBalance();
 
   /*--- Precondition the harmonic balance source terms ---*/
   if (config_container[ZONE_0]->GetHB_Precondition() == YES) {
@@ -3239,7 +3539,7 @@ void CHBDriver::Update() {
 
   }
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
+  for (iInst = inst_begin; iInst < inst_end; iInst++) {
 
     /*--- Update the harmonic balance terms across all zones ---*/
     iteration_container[ZONE_0][iInst]->Update(output_container[ZONE_0], integration_container, geometry_container,
@@ -3275,133 +3575,128 @@ void CHBDriver::ResetConvergence() {
 
 }
 
-void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
+void CHBDriver::SetHarmonicBalance() {
 
-  unsigned short iVar, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
-  unsigned long iPoint;
-  bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const auto config = config_container[ZONE_0];
+  const bool adjoint = config->GetContinuous_Adjoint();
+
+  /*--- The implicit (extrapolated) source is not needed when the spectral operator is part of the system. ---*/
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !config->GetHB_CoupledImplicit();
   if (adjoint) {
-    implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
+    implicit = (config->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   }
 
-  unsigned long InnerIter = config_container[ZONE_0]->GetInnerIter();
-
-  /*--- Retrieve values from the config file ---*/
-  su2double *U = new su2double[nVar];
-  su2double *U_old = new su2double[nVar];
-  su2double *Psi = new su2double[nVar];
-  su2double *Psi_old = new su2double[nVar];
-  su2double *Source = new su2double[nVar];
-  su2double deltaU, deltaPsi;
-
-  /*--- Compute period of oscillation ---*/
-  su2double period = config_container[ZONE_0]->GetHarmonicBalance_Period();
-
-  /*--- Non-dimensionalize the input period, if necessary.  */
-  period /= config_container[ZONE_0]->GetTime_Ref();
-
-  if (InnerIter == 0)
+  if (config->GetInnerIter() == 0)
     ComputeHB_Operator();
 
   /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
   /*--- Loop over all grid levels ---*/
-  for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+  for (unsigned short iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    SetHarmonicBalance_Source(iMGlevel, adjoint? ADJFLOW_SOL : FLOW_SOL, implicit, adjoint);
+  }
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
+  /*--- Source term for a turbulence model, only on the finest mesh level (turbulence is
+   *    always solved on the original grid only). ---*/
+  if (config->GetKind_Solver() == RANS) {
+    SetHarmonicBalance_Source(MESH_0, TURB_SOL, false, false);
+  }
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source[iVar] = 0.0;
-      }
+}
 
-      /*--- Step across the columns ---*/
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+void CHBDriver::SetHarmonicBalance_Source(unsigned short iMGlevel, unsigned short iSol, bool implicit, bool transpose) {
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- All instances have the same partition (also on the counterpart ranks of other groups). ---*/
+  const unsigned long nPoint = geometry_container[ZONE_0][inst_begin][iMGlevel]->GetnPoint();
+  const unsigned short nVar = solver_container[ZONE_0][inst_begin][iMGlevel][iSol]->GetnVar();
+  const size_t nPointVar = nPoint * nVar;
 
-          if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += U[iVar]*D[iInst][jInst];
+  /*--- Row i of the source is the sum over the columns j of D[i][j] times the solution of instance j,
+   *    this rank adds the columns of its instances to all rows. ---*/
 
-            if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaU = U[iVar] - U_old[iVar];
-              Source[iVar] += deltaU*D[iInst][jInst];
-            }
+  vector<su2double> Source(nInstHB * nPointVar, 0.0);
 
-          }
+  for (unsigned short jInst = inst_begin; jInst < inst_end; jInst++) {
+    const auto nodes = solver_container[ZONE_0][jInst][iMGlevel][iSol]->GetNodes();
 
-          else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += Psi[iVar]*D[jInst][iInst];
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        const su2double U = nodes->GetSolution(iPoint, iVar);
+        const su2double deltaU = implicit? U - nodes->GetSolution_Old(iPoint, iVar) : su2double(0.0);
 
-            if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaPsi = Psi[iVar] - Psi_old[iVar];
-              Source[iVar] += deltaPsi*D[jInst][iInst];
-            }
-          }
+        for (unsigned short iInst = 0; iInst < nInstHB; iInst++) {
+          const su2double Dij = transpose? D[jInst][iInst] : D[iInst][jInst];
+          auto& source = Source[iInst * nPointVar + iPoint * nVar + iVar];
+          source += U * Dij;
+          if (implicit) source += deltaU * Dij;
         }
+      }
+    }
+  }
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-        }
+  /*--- With concurrent instances, each group only needs the rows of its instances, the partial
+   *    sums of those rows are reduced on the counterpart rank of that group. ---*/
 
-      }
+  if (concurrent_instances) {
+    const vector<su2double> partialSource(Source);
+    const unsigned short nGroup = config_container[ZONE_0]->GetHB_InstanceGroups();
+
+    for (unsigned short iGroup = 0; iGroup < nGroup; iGroup++) {
+      const size_t offset = GroupFirstInstance(iGroup) * nPointVar;
+      const int count = (GroupFirstInstance(iGroup+1) - GroupFirstInstance(iGroup)) * nPointVar;
+      SU2_MPI::Reduce(partialSource.data() + offset, Source.data() + offset, count, MPI_DOUBLE, MPI_SUM,
+                      iGroup, instance_comm);
     }
   }
 
-  /*--- Source term for a turbulence model ---*/
-  if (config_container[ZONE_0]->GetKind_Solver() == RANS) {
+  /*--- Store the sources of the local instances. ---*/
 
-    /*--- Extra variables needed if we have a turbulence model. ---*/
-    unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
-    su2double *U_Turb = new su2double[nVar_Turb];
-    su2double *Source_Turb = new su2double[nVar_Turb];
+  for (unsigned short iInst = inst_begin; iInst < inst_end; iInst++) {
+    const auto nodes = solver_container[ZONE_0][iInst][iMGlevel][iSol]->GetNodes();
 
-    /*--- Loop over only the finest mesh level (turbulence is always solved
-     on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst * nPointVar + iPoint * nVar + iVar]);
+  }
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-          Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
-        }
-      }
+}
 
-      /*--- Store sources for current iZone ---*/
-      for (iVar = 0; iVar < nVar_Turb; iVar++)
-        solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source_Turb[iVar]);
-    }
+void CHBDriver::ReduceHarmonicBalance_Coefficients() {
+
+  if (!concurrent_instances) return;
 
-    delete [] U_Turb;
-    delete [] Source_Turb;
+  /*--- The groups hold the coefficients of their instances (zero otherwise), the sum over
+   *    the counterpart ranks gives all of them to all ranks. ---*/
+
+  constexpr unsigned short nCoeff = 5;
+  vector<su2double> localCoeff(nInstHB * nCoeff, 0.0), coeff(nInstHB * nCoeff);
+
+  for (iInst = inst_begin; iInst < inst_end; iInst++) {
+    const auto solver = solver_container[ZONE_0][iInst][MESH_0][FLOW_SOL];
+    localCoeff[iInst * nCoeff + 0] = solver->GetTotal_CL();
+    localCoeff[iInst * nCoeff + 1] = solver->GetTotal_CD();
+    localCoeff[iInst * nCoeff + 2] = solver->GetTotal_CMx();
+    localCoeff[iInst * nCoeff + 3] = solver->GetTotal_CMy();
+    localCoeff[iInst * nCoeff + 4] = solver->GetTotal_CMz();
   }
 
-  delete [] Source;
-  delete [] U;
-  delete [] U_old;
-  delete [] Psi;
-  delete [] Psi_old;
+  SU2_MPI::Allreduce(localCoeff.data(), coeff.data(), coeff.size(), MPI_DOUBLE, MPI_SUM, instance_comm);
+
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    if (InstanceIsLocal(iInst)) continue;
+    const auto solver = solver_container[ZONE_0][iInst][MESH_0][FLOW_SOL];
+    solver->SetTotal_CL(coeff[iInst * nCoeff + 0]);
+    solver->SetTotal_CD(coeff[iInst * nCoeff + 1]);
+    solver->SetTotal_CMx(coeff[iInst * nCoeff + 2]);
+    solver->SetTotal_CMy(coeff[iInst * nCoeff + 3]);
+    solver->SetTotal_CMz(coeff[iInst * nCoeff + 4]);
+  }
 
 }
 
 void CHBDriver::StabilizeHarmonicBalance() {
 
   unsigned short i, j, k, iVar, iInst, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+  unsigned short nVar = solver_container[ZONE_0][inst_begin][MESH_0][FLOW_SOL]->GetnVar();
   unsigned long iPoint;
   bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
 
@@ -3420,11 +3715,45 @@ void CHBDriver::StabilizeHarmonicBalance() {
   /*--- Loop over all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
+    const unsigned long nPoint = geometry_container[ZONE_0][inst_begin][iMGlevel]->GetnPoint();
+    const size_t nPointVar = nPoint * nVar;
+
+    /*--- Gather the data needed by the stabilization, the sources of all instances and the time
+     *    step of the first instance. With concurrent instances, each group sends the sources of its
+     *    instances to the counterpart ranks of the other groups, and the first group the time step. ---*/
+
+    vector<su2double> instSource(nInstHB * nPointVar), Delta_Time(nPoint);
+
+    for (iInst = inst_begin; iInst < inst_end; iInst++) {
+      const auto nodes = solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes();
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+        for (iVar = 0; iVar < nVar; iVar++)
+          instSource[iInst * nPointVar + iPoint * nVar + iVar] = nodes->GetHarmonicBalance_Source(iPoint, iVar);
+        if (iInst == INST_0)
+          Delta_Time[iPoint] = nodes->GetDelta_Time(iPoint);
+      }
+    }
+
+    if (concurrent_instances) {
+      const unsigned short nGroup = config_container[ZONE_0]->GetHB_InstanceGroups();
+      vector<int> counts(nGroup), displs(nGroup);
+      for (unsigned short iGroup = 0; iGroup < nGroup; iGroup++) {
+        displs[iGroup] = GroupFirstInstance(iGroup) * nPointVar;
+        counts[iGroup] = (GroupFirstInstance(iGroup+1) - GroupFirstInstance(iGroup)) * nPointVar;
+      }
+      const vector<su2double> localSource(instSource.begin() + displs[rank_group],
+                                          instSource.begin() + displs[rank_group] + counts[rank_group]);
+
+      SU2_MPI::Allgatherv(localSource.data(), counts[rank_group], MPI_DOUBLE, instSource.data(),
+                          counts.data(), displs.data(), MPI_DOUBLE, instance_comm);
+      SU2_MPI::Bcast(Delta_Time.data(), nPoint, MPI_DOUBLE, 0, instance_comm);
+    }
+
     /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint(); iPoint++) {
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
       /*--- Get time step for current node ---*/
-      Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+      Delta = Delta_Time[iPoint];
 
       /*--- Setup stabilization matrix for this node ---*/
       for (iInst = 0; iInst < nInstHB; iInst++) {
@@ -3523,12 +3852,12 @@ void CHBDriver::StabilizeHarmonicBalance() {
 
         /*--- Get current source terms (not yet preconditioned) and zero source array to prepare preconditioning ---*/
         for (iInst = 0; iInst < nInstHB; iInst++) {
-          Source_old[iInst] = solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->GetHarmonicBalance_Source(iPoint, iVar);
+          Source_old[iInst] = instSource[iInst * nPointVar + iPoint * nVar + iVar];
           Source[iInst] = 0;
         }
 
         /*--- Step through columns ---*/
-        for (iInst = 0; iInst < nInstHB; iInst++) {
+        for (iInst = inst_begin; iInst < inst_end; iInst++) {
           for (jInst = 0; jInst < nInstHB; jInst++) {
             Source[iInst] += P[iInst][jInst]*Source_old[jInst];
           }
@@ -3558,6 +3887,113 @@ void CHBDriver::StabilizeHarmonicBalance() {
 
 }
 
+void CHBDriver::SolveCoupledImplicit() {
+
+  const auto config = config_container[ZONE_0];
+  const auto nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+  const auto nPointDomain = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain();
+
+  vector<CSysMatrix<HBScalar>*> matrices(nInstHB);
+  vector<CGeometry*> geometries(nInstHB);
+
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    matrices[iInst] = &solver_container[ZONE_0][iInst][MESH_0][FLOW_SOL]->Jacobian;
+    geometries[iInst] = geometry_container[ZONE_0][iInst][MESH_0];
+  }
+
+  /*--- The vectors of the coupled system hold the domain points of all instances. ---*/
+
+  if (HBLinSysRes.GetNBlk() != nInstHB * nPointDomain) {
+    HBLinSysRes.Initialize(nInstHB * nPointDomain, nInstHB * nPointDomain, nVar, 0.0);
+    HBLinSysSol.Initialize(nInstHB * nPointDomain, nInstHB * nPointDomain, nVar, 0.0);
+  }
+
+  /*--- The residual of instance i contains Vol * sum_j D[i][j] * U_j (see SetHarmonicBalance_Source),
+   *    the blocks of the Jacobians of the instances are coupled by the HB operator. Each instance
+   *    is preconditioned with its own (pseudo-time) Jacobian. ---*/
+
+  if (!HBMatVec) {
+    const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(config->GetKind_Linear_Solver_Prec());
+    HBMatVec.reset(new CInstanceCoupledProduct<HBScalar>(matrices, geometries, config, nVar, D));
+    HBPrecond.reset(new CInstanceBlockPreconditioner<HBScalar>(kindPrec, matrices, geometries, config, nVar));
+  }
+
+  /*--- The operator is (re)computed by the update of the first inner iteration. ---*/
+
+  HBMatVec->SetCoupling(D);
+
+  const auto& mat_vec = *HBMatVec;
+  auto& precond = *HBPrecond;
+
+  const HBScalar tol = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+  const auto maxIter = config->GetLinear_Solver_Iter();
+
+  unsigned long iterLinSol = 0;
+  HBScalar resLinSol = 0.0;
+
+  SU2_OMP_PARALLEL_(if(solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetHasHybridParallel()))
+  {
+    for (unsigned short jInst = 0; jInst < nInstHB; jInst++)
+      mat_vec.SetInstance(solver_container[ZONE_0][jInst][MESH_0][FLOW_SOL]->LinSysRes, jInst, HBLinSysRes);
+
+    HBLinSysSol = HBScalar(0.0);
+
+    precond.Build();
+
+    unsigned long iter = 0;
+    HBScalar residual = 0.0;
+
+    switch (config->GetKind_Linear_Solver()) {
+      case FGMRES:
+        iter = HBSystem.FGMRES_LinSolver(HBLinSysRes, HBLinSysSol, mat_vec, precond, tol, maxIter, residual, false, config);
+        break;
+      case RESTARTED_FGMRES:
+        iter = HBSystem.RFGMRES_LinSolver(HBLinSysRes, HBLinSysSol, mat_vec, precond, tol, maxIter, residual, false, config);
+        break;
+      case BCGSTAB:
+        iter = HBSystem.BCGSTAB_LinSolver(HBLinSysRes, HBLinSysSol, mat_vec, precond, tol, maxIter, residual, false, config);
+        break;
+      default:
+        SU2_MPI::Error("Unsupported linear solver for the coupled harmonic balance system.", CURRENT_FUNCTION);
+    }
+
+    SU2_OMP_MASTER {
+      iterLinSol = iter;
+      resLinSol = residual;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    /*--- Update the solution of each instance. ---*/
+
+    for (unsigned short jInst = 0; jInst < nInstHB; jInst++) {
+      auto solver = solver_container[ZONE_0][jInst][MESH_0][FLOW_SOL];
+
+      mat_vec.GetInstance(HBLinSysSol, jInst, solver->LinSysSol);
+
+      SU2_OMP_MASTER {
+        solver->SetIterLinSolver(iterLinSol);
+        solver->SetResLinSolver(resLinSol);
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+
+      solver->CompleteImplicitIteration(geometries[jInst], solver_container[ZONE_0][jInst][MESH_0], config);
+    }
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- The models (e.g. turbulence) and the CFL adaptation use the updated flow state,
+   *    harmonic balance problems are fluid problems (see CIterationFactory). ---*/
+
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    auto iteration = static_cast<CFluidIteration*>(iteration_container[ZONE_0][iInst]);
+    iteration->IterateModels(integration_container, geometry_container, solver_container,
+                             numerics_container, config_container, ZONE_0, iInst);
+  }
+
+}
+
 void CHBDriver::ComputeHB_Operator() {
 
   const   complex<su2double> J(0.0,1.0);
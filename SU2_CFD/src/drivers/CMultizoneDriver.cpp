@@ -234,6 +234,8 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
       config_container[iZone]->SetPhysicalTime(0.0);
     }
 
+    if (!ZoneIsLocal(iZone)) continue;
+
     /*--- Set the initial condition for EULER/N-S/RANS ---------------------------------------------*/
     /*--- For FSI, the initial conditions are set, after the mesh has been moved. --------------------------------------*/
     if (!fsi && config_container[iZone]->GetFluidProblem()) {
@@ -253,7 +255,7 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Run a predictor step ---*/
   for (iZone = 0; iZone < nZone; iZone++) {
-    if (config_container[iZone]->GetPredictor())
+    if (ZoneIsLocal(iZone) && config_container[iZone]->GetPredictor())
       iteration_container[iZone][INST_0]->Predictor(output_container[iZone], integration_container, geometry_container,
                                                     solver_container, numerics_container, config_container, surface_movement,
                                                     grid_movement, FFDBox, iZone, INST_0);
@@ -368,6 +370,8 @@ void CMultizoneDriver::Run_Jacobi() {
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
       driver_config->SetOuterIter(iOuter_Iter);
 
+      if (!ZoneIsLocal(iZone)) continue;
+
       /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
       iteration_container[iZone][INST_0]->Solve(output_container[iZone], integration_container, geometry_container,
                                                 solver_container, numerics_container, config_container,
@@ -398,6 +402,8 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
+    if (!ZoneIsLocal(iZone)) continue;
+
     /*--- Account for all the solvers in this zone. ---*/
 
     auto solvers = solver_container[iZone][INST_0][MESH_0];
@@ -413,6 +419,13 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   }
 
+  /*--- With concurrent zones, each group broadcasts the history of its zone to all ranks. ---*/
+
+  if (concurrent_zones) {
+    for (iZone = 0; iZone < nZone; iZone++)
+      output_container[iZone]->BroadcastHistoryOutput(zone_root_rank[iZone], driver_comm);
+  }
+
   /*--- Print out the convergence data to screen and history file. ---*/
 
   driver_output->SetMultizoneHistory_Output(output_container, config_container, driver_config,
@@ -440,9 +453,10 @@ void CMultizoneDriver::Update() {
     /*--- If a mesh update is required due to the transfer of data ---*/
     if (UpdateMesh > 0) DynamicMeshUpdate(iZone, TimeIter);
 
-    iteration_container[iZone][INST_0]->Update(output_container[iZone], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, iZone, INST_0);
+    if (ZoneIsLocal(iZone))
+      iteration_container[iZone][INST_0]->Update(output_container[iZone], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, iZone, INST_0);
 
     /*--- Set the Convergence_FSI boolean to false for the next time step ---*/
     for (unsigned short iSol = 0; iSol < MAX_SOLS-1; iSol++){
@@ -467,6 +481,7 @@ void CMultizoneDriver::Output(unsigned long TimeIter) {
   bool wrote_files = false;
 
   for (iZone = 0; iZone < nZone; iZone++){
+    if (!ZoneIsLocal(iZone)) continue;
     wrote_files = output_container[iZone]->SetResult_Files(geometry_container[iZone][INST_0][MESH_0],
                                                             config_container[iZone],
                                                             solver_container[iZone][INST_0][MESH_0], TimeIter, StopCalc );
@@ -495,15 +510,16 @@ void CMultizoneDriver::DynamicMeshUpdate(unsigned long TimeIter) {
     const auto harmonic_balance = (config_container[iZone]->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
     /*--- Dynamic mesh update ---*/
     if ((config_container[iZone]->GetGrid_Movement()) && (!harmonic_balance) && (!fsi)) {
-      iteration_container[iZone][INST_0]->SetGrid_Movement(geometry_container[iZone][INST_0],surface_movement[iZone],
-                                                           grid_movement[iZone][INST_0], solver_container[iZone][INST_0],
-                                                           config_container[iZone], 0, TimeIter);
+      if (ZoneIsLocal(iZone))
+        iteration_container[iZone][INST_0]->SetGrid_Movement(geometry_container[iZone][INST_0],surface_movement[iZone],
+                                                             grid_movement[iZone][INST_0], solver_container[iZone][INST_0],
+                                                             config_container[iZone], 0, TimeIter);
       AnyDeformMesh = true;
     }
   }
   /*--- Update the wall distances if the mesh was deformed. ---*/
   if (AnyDeformMesh) {
-    CGeometry::ComputeWallDistance(config_container, geometry_container);
+    CGeometry::ComputeWallDistance(config_container, geometry_container, AllZonesComm());
   }
 }
 
@@ -511,24 +527,28 @@ void CMultizoneDriver::DynamicMeshUpdate(unsigned short val_iZone, unsigned long
 
   auto iteration = iteration_container[val_iZone][INST_0];
 
-  /*--- Legacy dynamic mesh update - Only if GRID_MOVEMENT = YES ---*/
-  if (config_container[val_iZone]->GetGrid_Movement()) {
-    iteration->SetGrid_Movement(geometry_container[val_iZone][INST_0],surface_movement[val_iZone],
-                                grid_movement[val_iZone][INST_0], solver_container[val_iZone][INST_0],
-                                config_container[val_iZone], 0, TimeIter);
-  }
+  /*--- This is called between transfers, with concurrent zones only the group of the zone deforms it. ---*/
+  if (ZoneIsLocal(val_iZone)) {
 
-  /*--- New solver - all the other routines in SetGrid_Movement should be adapted to this one ---*/
-  /*--- Works if DEFORM_MESH = YES ---*/
-  iteration->SetMesh_Deformation(geometry_container[val_iZone][INST_0],
-                                 solver_container[val_iZone][INST_0][MESH_0],
-                                 numerics_container[val_iZone][INST_0][MESH_0],
-                                 config_container[val_iZone], RECORDING::CLEAR_INDICES);
+    /*--- Legacy dynamic mesh update - Only if GRID_MOVEMENT = YES ---*/
+    if (config_container[val_iZone]->GetGrid_Movement()) {
+      iteration->SetGrid_Movement(geometry_container[val_iZone][INST_0],surface_movement[val_iZone],
+                                  grid_movement[val_iZone][INST_0], solver_container[val_iZone][INST_0],
+                                  config_container[val_iZone], 0, TimeIter);
+    }
+
+    /*--- New solver - all the other routines in SetGrid_Movement should be adapted to this one ---*/
+    /*--- Works if DEFORM_MESH = YES ---*/
+    iteration->SetMesh_Deformation(geometry_container[val_iZone][INST_0],
+                                   solver_container[val_iZone][INST_0][MESH_0],
+                                   numerics_container[val_iZone][INST_0][MESH_0],
+                                   config_container[val_iZone], RECORDING::CLEAR_INDICES);
+  }
 
   /*--- Update the wall distances if the mesh was deformed. ---*/
   if (config_container[val_iZone]->GetGrid_Movement() ||
       config_container[val_iZone]->GetDeform_Mesh()) {
-    CGeometry::ComputeWallDistance(config_container, geometry_container);
+    CGeometry::ComputeWallDistance(config_container, geometry_container, AllZonesComm());
   }
 }
 
@@ -0,0 +1,307 @@
+/*!
+ * \file CPararealDriver.cpp
+ * \brief The main subroutines for the parallel-in-time (parareal) driver.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CPararealDriver.hpp"
+#include "../../include/definition_structure.hpp"
+#include "../../include/output/COutput.hpp"
+#include "../../include/iteration/CIteration.hpp"
+
+namespace {
+/*--- Solvers that carry the state of the problem, i.e. those integrated in time. ---*/
+constexpr int StateSolvers[] = {FLOW_SOL, TURB_SOL, TRANS_SOL, HEAT_SOL};
+}
+
+CPararealDriver::CPararealDriver(char* confFile,
+                                 unsigned short val_nZone,
+                                 SU2_Comm MPICommunicator) : CSinglezoneDriver(confFile,
+                                                                               val_nZone,
+                                                                               MPICommunicator) {
+  const auto config = config_container[ZONE_0];
+
+  nSlice = config->GetParareal_TimeSlices();
+  nIter = min<unsigned long>(config->GetParareal_Iter(), nSlice);
+  if (nIter == 0)
+    SU2_MPI::Error("PARAREAL_ITER must be positive.", CURRENT_FUNCTION);
+
+  /*--- The coarse propagator covers the slice with (at most) the same number of steps. ---*/
+
+  nCoarseStep = min(config->GetParareal_CoarseSteps(), slice_end - slice_begin);
+  if (nCoarseStep == 0)
+    SU2_MPI::Error("PARAREAL_COARSE_STEPS must be positive.", CURRENT_FUNCTION);
+
+  fineTimeStep = config->GetDelta_UnstTimeND();
+  coarseTimeStep = fineTimeStep * static_cast<su2double>(slice_end - slice_begin) / nCoarseStep;
+
+  CheckPartitions();
+}
+
+void CPararealDriver::CheckPartitions() const {
+
+  /*--- Compare the size of the state and the global indices of the points of each rank with those
+   *    of its counterpart in the first slice. ---*/
+
+  vector<su2double> state;
+  GetState(state);
+
+  const auto geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  vector<unsigned long> local = {state.size()};
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+    local.push_back(geometry->nodes->GetGlobalIndex(iPoint));
+
+  unsigned long nFirst = local.size();
+  SU2_MPI::Bcast(&nFirst, 1, MPI_UNSIGNED_LONG, 0, slice_comm);
+
+  vector<unsigned long> first(nFirst);
+  if (rank_slice == 0) first = local;
+  SU2_MPI::Bcast(first.data(), nFirst, MPI_UNSIGNED_LONG, 0, slice_comm);
+
+  unsigned short mismatch = (first != local), anyMismatch = 0;
+  SU2_MPI::Allreduce(&mismatch, &anyMismatch, 1, MPI_UNSIGNED_SHORT, MPI_MAX, driver_comm);
+
+  if (anyMismatch)
+    SU2_MPI::Error("The time slices are not partitioned identically, their states cannot be exchanged.\n"
+                   "Use one rank per time slice.", CURRENT_FUNCTION);
+}
+
+void CPararealDriver::GetState(vector<su2double>& state) const {
+
+  state.clear();
+
+  for (unsigned short iMesh = 0; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+    const auto geometry = geometry_container[ZONE_0][INST_0][iMesh];
+
+    for (auto iSol : StateSolvers) {
+      const auto solver = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (solver == nullptr) continue;
+      const auto nodes = solver->GetNodes();
+
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+        for (auto iVar = 0u; iVar < solver->GetnVar(); iVar++) {
+          state.push_back(nodes->GetSolution_time_n(iPoint, iVar));
+          state.push_back(nodes->GetSolution_time_n1(iPoint, iVar));
+        }
+      }
+    }
+  }
+}
+
+void CPararealDriver::SetState(const vector<su2double>& state) {
+
+  const auto config = config_container[ZONE_0];
+  auto geometries = geometry_container[ZONE_0][INST_0];
+  auto solvers = solver_container[ZONE_0][INST_0];
+
+  size_t i = 0;
+
+  for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (auto iSol : StateSolvers) {
+      const auto solver = solvers[iMesh][iSol];
+      if (solver == nullptr) continue;
+      auto nodes = solver->GetNodes();
+
+      for (auto iPoint = 0ul; iPoint < geometries[iMesh]->GetnPoint(); iPoint++) {
+        for (auto iVar = 0u; iVar < solver->GetnVar(); iVar++) {
+          nodes->SetSolution(iPoint, iVar, state[i]);
+          nodes->Set_Solution_time_n(iPoint, iVar, state[i]);
+          nodes->Set_Solution_time_n1(iPoint, iVar, state[i+1]);
+          i += 2;
+        }
+      }
+    }
+  }
+
+  /*--- Recompute the primitive variables and the eddy viscosity, as when loading a restart. ---*/
+
+  if (!config->GetFluidProblem()) return;
+
+  SU2_OMP_PARALLEL_(if(solvers[MESH_0][FLOW_SOL]->GetHasHybridParallel()))
+  {
+    for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      solvers[iMesh][FLOW_SOL]->Preprocessing(geometries[iMesh], solvers[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+      if (solvers[iMesh][TURB_SOL] != nullptr)
+        solvers[iMesh][TURB_SOL]->Postprocessing(geometries[iMesh], solvers[iMesh], config, iMesh);
+    }
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+void CPararealDriver::ScaleTimeLevels(su2double factor, vector<su2double>& state) {
+
+  for (size_t i = 0; i < state.size(); i += 2)
+    state[i+1] = state[i] + factor * (state[i+1] - state[i]);
+}
+
+void CPararealDriver::Propagate(bool coarse, bool output) {
+
+  const auto config = config_container[ZONE_0];
+  const auto nFineStep = slice_end - slice_begin;
+  const auto nStep = coarse? nCoarseStep : nFineStep;
+  const auto timeStep = coarse? coarseTimeStep : fineTimeStep;
+
+  config->SetDelta_UnstTimeND(timeStep);
+
+  for (auto iStep = 0ul; iStep < nStep; iStep++) {
+
+    /*--- The coarse steps are mapped to the fine time iterations they cover. ---*/
+
+    TimeIter = slice_begin + (iStep * nFineStep) / nStep;
+
+    config->SetTimeIter(TimeIter);
+    config->SetPhysicalTime(static_cast<su2double>(slice_begin)*fineTimeStep + static_cast<su2double>(iStep)*timeStep);
+
+    Run();
+
+    Postprocess();
+
+    Update();
+
+    if (output) {
+      Monitor(TimeIter);
+      Output(TimeIter);
+    }
+  }
+
+  config->SetDelta_UnstTimeND(fineTimeStep);
+}
+
+void CPararealDriver::CoarsePropagate(const vector<su2double>& begin, vector<su2double>& end) {
+
+  /*--- For the second order scheme the time level n-1 is interpolated (or extrapolated) to the
+   *    coarse time step, and back to the fine time step at the end of the slice. ---*/
+
+  end = begin;
+  ScaleTimeLevels(coarseTimeStep / fineTimeStep, end);
+  SetState(end);
+
+  Propagate(true, false);
+
+  GetState(end);
+  ScaleTimeLevels(fineTimeStep / coarseTimeStep, end);
+}
+
+void CPararealDriver::SendState(const vector<su2double>& state) const {
+
+  if (rank_slice + 1 == nSlice) return;
+  SU2_MPI::Send(state.data(), state.size(), MPI_DOUBLE, rank_slice + 1, rank_slice, slice_comm);
+}
+
+void CPararealDriver::RecvState(vector<su2double>& state) const {
+
+  /*--- The sizes were checked by CheckPartitions. ---*/
+  if (rank_slice == 0) return;
+  SU2_MPI::Status status;
+  SU2_MPI::Recv(state.data(), state.size(), MPI_DOUBLE, rank_slice - 1, rank_slice - 1, slice_comm, &status);
+}
+
+void CPararealDriver::StartSolver() {
+
+  const auto config = config_container[ZONE_0];
+  const auto output = output_container[ZONE_0];
+
+  StartTime = SU2_MPI::Wtime();
+
+  config->Set_StartTime(StartTime);
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
+
+  if (rank == MASTER_NODE) {
+    cout << endl <<"Simulation Run using the Parareal Driver" << endl;
+    cout << "The simulation will run for " << config->GetnTime_Iter() - (config->GetRestart()? config->GetRestart_Iter() : 0)
+         << " time steps in " << nSlice << " concurrent time slices, with at most " << nIter << " parareal iterations." << endl;
+  }
+
+  /*--- Initial condition, the slices other than the first receive their initial state. ---*/
+
+  TimeIter = config->GetRestart()? config->GetRestart_Iter() : 0;
+
+  Preprocess(TimeIter);
+
+  vector<su2double> start, coarse, fine, next;
+  GetState(start);
+
+  /*--- Initial (sequential) coarse sweep, only the final fine sweep writes output. ---*/
+
+  output->SetScreenAndHistory_Output(false, false);
+
+  RecvState(start);
+  CoarsePropagate(start, coarse);
+  SendState(coarse);
+
+  bool converged = false;
+
+  for (unsigned long iIter = 0; ; iIter++) {
+
+    const bool last = converged || (iIter + 1 == nIter);
+
+    /*--- Fine sweep, concurrent for all slices, the screen output is that of the last slice. ---*/
+
+    if (last) output->SetScreenAndHistory_Output(rank_slice + 1 == nSlice, true);
+
+    SetState(start);
+    Propagate(false, last);
+
+    if (last) break;
+
+    GetState(fine);
+
+    /*--- Correction sweep. The initial state of the first iIter+1 slices is already exact
+     *    (it is the result of fine sweeps only), their fine solution is sent as is. ---*/
+
+    next = start;
+    RecvState(next);
+
+    if (rank_slice > iIter) {
+      vector<su2double> coarseNext;
+      CoarsePropagate(next, coarseNext);
+      for (size_t i = 0; i < fine.size(); i++) fine[i] += coarseNext[i] - coarse[i];
+      coarse = move(coarseNext);
+    }
+    SendState(fine);
+
+    /*--- Relative change of the initial states of the slices. ---*/
+
+    su2double sums[2] = {0.0}, globalSums[2] = {0.0};
+    for (size_t i = 0; i < next.size(); i++) {
+      sums[0] += pow(next[i] - start[i], 2);
+      sums[1] += pow(next[i], 2);
+    }
+    SU2_MPI::Allreduce(sums, globalSums, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    su2double change = sqrt(globalSums[0] / max(globalSums[1], su2double(EPS))), maxChange = 0.0;
+    SU2_MPI::Allreduce(&change, &maxChange, 1, MPI_DOUBLE, MPI_MAX, driver_comm);
+
+    converged = (maxChange < config->GetParareal_Tol());
+    swap(start, next);
+
+    if (rank == MASTER_NODE) {
+      cout << "Parareal iteration " << iIter + 1 << ": maximum relative change of the slice states "
+           << maxChange << "." << endl;
+    }
+  }
+
+}
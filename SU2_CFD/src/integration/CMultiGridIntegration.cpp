@@ -31,6 +31,11 @@
 
 CMultiGridIntegration::CMultiGridIntegration() : CIntegration() { }
 
+bool CMultiGridIntegration::TurbDirichletWall(const CConfig *config, unsigned short iMarker) {
+  return !config->GetWall_Functions() &&
+    (config->GetWallRoughnessProperties(config->GetMarker_All_TagBound(iMarker)).first == WALL_TYPE::SMOOTH);
+}
+
 void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                                                 CSolver *****solver_container,
                                                 CNumerics ******numerics_container,
@@ -107,6 +112,33 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
   MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
                   FinestMesh, RecursiveParam, RunTime_EqSystem, iZone, iInst);
 
+  /*--- For the turbulence model, update the eddy viscosity on the finest mesh and copy the
+   *    fine solution to the coarse levels, these are used by the next flow multigrid cycle. ---*/
+
+  if (RunTime_EqSystem == RUNTIME_TURB_SYS) {
+
+    solver_container[iZone][iInst][FinestMesh][Solver_Position]->Postprocessing(geometry[iZone][iInst][FinestMesh],
+                                                                                solver_container[iZone][iInst][FinestMesh],
+                                                                                config[iZone], FinestMesh);
+
+    for (unsigned short iMesh = FinestMesh; iMesh < config[iZone]->GetnMGLevels(); iMesh++) {
+
+      SetRestricted_Solution(RunTime_EqSystem,
+                             solver_container[iZone][iInst][iMesh][Solver_Position],
+                             solver_container[iZone][iInst][iMesh+1][Solver_Position],
+                             geometry[iZone][iInst][iMesh],
+                             geometry[iZone][iInst][iMesh+1],
+                             config[iZone]);
+
+      SetRestricted_EddyVisc(RunTime_EqSystem,
+                             solver_container[iZone][iInst][iMesh][Solver_Position],
+                             solver_container[iZone][iInst][iMesh+1][Solver_Position],
+                             geometry[iZone][iInst][iMesh],
+                             geometry[iZone][iInst][iMesh+1],
+                             config[iZone]);
+    }
+  }
+
 
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
 
@@ -247,7 +279,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     /*--- Compute $P_(k+1) = I^(k+1)_k(r_k) - r_(k+1) ---*/
 
-    SetForcing_Term(solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
+    SetForcing_Term(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
 
     /*--- Restore the time integration settings. ---*/
 
@@ -271,7 +303,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SmoothProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config->GetMG_CorrecSmooth(iMesh), 1.25, config);
 
-    SetProlongated_Correction(solver_fine, geometry_fine, config, iMesh);
+    SetProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config, iMesh);
 
 
     /*--- Solution post-smoothing in the prolongated grid. ---*/
@@ -345,6 +377,9 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetViscous_Wall(iMarker)) {
 
+      const bool turb_sys = (RunTime_EqSystem == RUNTIME_TURB_SYS);
+      if (turb_sys && !TurbDirichletWall(config, iMarker)) continue;
+
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
 
@@ -353,8 +388,14 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
         /*--- For dirichlet boundary condtions, set the correction to zero.
          Note that Solution_Old stores the correction not the actual value ---*/
 
-        su2double zero[3] = {0.0};
-        sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
+        if (turb_sys) {
+          for (iVar = 0; iVar < nVar; iVar++)
+            sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse, iVar, 0.0);
+        }
+        else {
+          su2double zero[3] = {0.0};
+          sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
+        }
 
       }
       END_SU2_OMP_FOR
@@ -452,7 +493,7 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
 
 }
 
-void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine,
+void CMultiGridIntegration::SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
                                                       CConfig *config, unsigned short iMesh) {
   unsigned long Point_Fine;
   unsigned short iVar;
@@ -461,6 +502,10 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
   const unsigned short nVar = sol_fine->GetnVar();
   const su2double factor = config->GetDamp_Correc_Prolong();
 
+  /*--- The turbulence variables must remain positive (except for the negative SA model),
+   *    a coarse grid correction may remove at most 99% of the current value. ---*/
+  const bool positive = (RunTime_EqSystem == RUNTIME_TURB_SYS) && (config->GetKind_Turb_Model() != SA_NEG);
+
   SU2_OMP_FOR_STAT(roundUpDiv(geo_fine->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Fine = 0; Point_Fine < geo_fine->GetnPointDomain(); Point_Fine++) {
     Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
@@ -469,7 +514,10 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
       /*--- Prevent a fine grid divergence due to a coarse grid divergence ---*/
       if (Residual_Fine[iVar] != Residual_Fine[iVar])
         Residual_Fine[iVar] = 0.0;
-      Solution_Fine[iVar] += factor*Residual_Fine[iVar];
+      if (positive)
+        Solution_Fine[iVar] = max(Solution_Fine[iVar] + factor*Residual_Fine[iVar], 0.01*Solution_Fine[iVar]);
+      else
+        Solution_Fine[iVar] += factor*Residual_Fine[iVar];
     }
   }
   END_SU2_OMP_FOR
@@ -496,8 +544,9 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
   END_SU2_OMP_FOR
 }
 
-void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                                            CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                            CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                                            unsigned short iMesh) {
 
   unsigned long Point_Fine, Point_Coarse, iVertex;
   unsigned short iMarker, iVar, iChildren;
@@ -529,10 +578,15 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetViscous_Wall(iMarker)) {
+      const bool turb_sys = (RunTime_EqSystem == RUNTIME_TURB_SYS);
+      if (turb_sys && !TurbDirichletWall(config, iMarker)) continue;
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+        if (turb_sys)
+          sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
+        else
+          sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
       }
       END_SU2_OMP_FOR
     }
@@ -568,6 +622,7 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const unsigned short nVar = sol_coarse->GetnVar();
   const bool grid_movement = config->GetGrid_Movement();
+  const bool sst = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
   su2double *Solution = new su2double[nVar];
 
@@ -602,6 +657,10 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetViscous_Wall(iMarker)) {
 
+      /*--- The turbulence wall values are only fixed at smooth walls without wall functions. ---*/
+
+      const bool turb_wall = (Solver_Position == TURB_SOL) && TurbDirichletWall(config, iMarker);
+
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
 
@@ -627,6 +686,16 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
           sol_coarse->GetNodes()->SetVelSolutionDVector(Point_Coarse);
         }
 
+        if (turb_wall) {
+
+          /*--- The wall value of nu_tilde and of k is zero, the wall value of omega depends
+           *    on the first cell height and is imposed by the coarse level boundary condition. ---*/
+
+          const unsigned short nVarWall = sst ? 1 : nVar;
+          for (iVar = 0; iVar < nVarWall; iVar++)
+            sol_coarse->GetNodes()->SetSolution(Point_Coarse, iVar, 0.0);
+        }
+
       }
       END_SU2_OMP_FOR
     }
@@ -59,103 +59,207 @@ CInterface::~CInterface(void) {
   delete[] SpanLevelDonor;
 }
 
-void CInterface::BroadcastData(const CInterpolator& interpolator,
-                               CSolver *donor_solution, CSolver *target_solution,
-                               CGeometry *donor_geometry, CGeometry *target_geometry,
-                               const CConfig *donor_config, const CConfig *target_config) {
-  static_assert(su2activematrix::Storage == StorageType::RowMajor,"");
+void CInterface::SetTransferPlans(const CInterpolator& interpolator, const CGeometry *donor_geometry,
+                                  const CGeometry *target_geometry, const CConfig *donor_config,
+                                  const CConfig *target_config) {
 
-  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
-                        donor_config, target_config);
+  const unsigned short nMarkerInt = donor_config->GetMarker_n_ZoneInterface()/2;
 
-  /*--- Loop over interface markers. ---*/
+  /*--- The donor processors of the interpolator are ranks in its communicator. ---*/
+
+  PlanComm = interpolator.GetComm();
+  PlanRank = SU2_MPI::GetRank(PlanComm);
 
-  for (auto iMarkerInt = 0u; iMarkerInt < donor_config->GetMarker_n_ZoneInterface()/2; iMarkerInt++) {
+  TransferPlans.clear();
+  TransferPlans.resize(nMarkerInt);
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
+
+    auto& plan = TransferPlans[iMarkerInt];
+
+    plan.markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
+    plan.markTarget = target_config->FindInterfaceMarker(iMarkerInt);
 
     /*--- Check if this interface connects the two zones, if not continue. ---*/
 
-    const auto markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
-    const auto markTarget = target_config->FindInterfaceMarker(iMarkerInt);
+    plan.active = CInterpolator::CheckInterfaceBoundary(plan.markDonor, plan.markTarget, PlanComm);
+    if (!plan.active) continue;
 
-    if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
+    /*--- Donors of the target vertices of this rank, as (rank, global index) pairs. ---*/
 
-    /*--- Count donor vertices on this rank. ---*/
+    vector<pair<int, unsigned long> > donors;
 
-    int nLocalVertexDonor = 0;
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
-        /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+    if (plan.markTarget >= 0) {
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(plan.markTarget); iVertex++) {
+        const auto iPoint = target_geometry->vertex[plan.markTarget][iVertex]->GetNode();
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+        const auto& targetVertex = interpolator.targetVertices[plan.markTarget][iVertex];
+        for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); iDonor++)
+          donors.emplace_back(targetVertex.processor[iDonor], targetVertex.globalPoint[iDonor]);
       }
     }
 
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
+    /*--- Sorted without repetitions, this is also the layout of the receive buffer. ---*/
+
+    auto needed = donors;
+    sort(needed.begin(), needed.end());
+    needed.erase(unique(needed.begin(), needed.end()), needed.end());
+
+    plan.donorSlot.resize(donors.size());
+    for (auto i = 0ul; i < donors.size(); ++i)
+      plan.donorSlot[i] = lower_bound(needed.begin(), needed.end(), donors[i]) - needed.begin();
+
+    /*--- Exchange the number of values each rank needs from the others. ---*/
+
+    const int nRank = SU2_MPI::GetSize(PlanComm);
+    vector<int> nRecv(nRank, 0), nSend(nRank, 0);
+    for (const auto& donor : needed) ++nRecv[donor.first];
 
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+    SU2_MPI::Alltoall(nRecv.data(), 1, MPI_INT, nSend.data(), 1, MPI_INT, PlanComm);
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
+    plan.sendPtr.assign(1, 0);
+    plan.recvPtr.assign(1, 0);
+    for (int iRank = 0; iRank < nRank; ++iRank) {
+      if (nSend[iRank]) {
+        plan.sendRank.push_back(iRank);
+        plan.sendPtr.push_back(plan.sendPtr.back() + nSend[iRank]);
+      }
+      if (nRecv[iRank]) {
+        plan.recvRank.push_back(iRank);
+        plan.recvPtr.push_back(plan.recvPtr.back() + nRecv[iRank]);
+      }
     }
 
-    /*--- Fill send buffers. ---*/
+    /*--- Send the global indices of the needed donors to their ranks. ---*/
 
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+    vector<unsigned long> recvIdx(needed.size()), sendIdx(plan.sendPtr.back());
+    for (auto i = 0ul; i < needed.size(); ++i) recvIdx[i] = needed[i].second;
 
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    vector<SU2_MPI::Request> requests(plan.sendRank.size() + plan.recvRank.size());
+    auto nRequest = 0ul;
 
-        /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
+    for (auto i = 0ul; i < plan.sendRank.size(); ++i) {
+      if (plan.sendRank[i] == PlanRank) continue;
+      SU2_MPI::Irecv(&sendIdx[plan.sendPtr[i]], plan.sendPtr[i+1] - plan.sendPtr[i], MPI_UNSIGNED_LONG,
+                     plan.sendRank[i], 0, PlanComm, &requests[nRequest++]);
+    }
+    for (auto i = 0ul; i < plan.recvRank.size(); ++i) {
+      if (plan.recvRank[i] == PlanRank) {
+        const auto j = find(plan.sendRank.begin(), plan.sendRank.end(), PlanRank) - plan.sendRank.begin();
+        copy(&recvIdx[plan.recvPtr[i]], &recvIdx[plan.recvPtr[i+1]], &sendIdx[plan.sendPtr[j]]);
+        continue;
+      }
+      SU2_MPI::Isend(&recvIdx[plan.recvPtr[i]], plan.recvPtr[i+1] - plan.recvPtr[i], MPI_UNSIGNED_LONG,
+                     plan.recvRank[i], 0, PlanComm, &requests[nRequest++]);
+    }
+    SU2_MPI::Waitall(nRequest, requests.data(), MPI_STATUSES_IGNORE);
 
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+    /*--- Map the requested global indices to donor vertices of this rank, each vertex
+     * is only stored once (and evaluated once) even if several ranks need it. ---*/
 
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
-        }
+    vector<pair<unsigned long, unsigned long> > localDonor;
+    if (plan.markDonor >= 0) {
+      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(plan.markDonor); iVertex++) {
+        const auto iPoint = donor_geometry->vertex[plan.markDonor][iVertex]->GetNode();
+        /*--- Only domain points are donors. ---*/
+        if (donor_geometry->nodes->GetDomain(iPoint))
+          localDonor.emplace_back(donor_geometry->nodes->GetGlobalIndex(iPoint), iVertex);
       }
     }
+    sort(localDonor.begin(), localDonor.end());
 
-    /*--- Gather data. ---*/
+    vector<long> position(localDonor.size(), -1);
+    plan.sendIdx.resize(sendIdx.size());
 
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+    for (auto i = 0ul; i < sendIdx.size(); ++i) {
+      const auto it = lower_bound(localDonor.begin(), localDonor.end(), make_pair(sendIdx[i], 0ul));
+      if (it == localDonor.end() || it->first != sendIdx[i])
+        SU2_MPI::Error("A donor point of the interpolation is not owned by the expected rank.", CURRENT_FUNCTION);
 
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
+      const auto k = it - localDonor.begin();
+      if (position[k] < 0) {
+        position[k] = plan.donorVertex.size();
+        plan.donorVertex.push_back(it->second);
+      }
+      plan.sendIdx[i] = position[k];
+    }
+  }
 
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  PlanInterpolator = &interpolator;
+  PlanUpdates = interpolator.GetnTransferCoeffUpdates();
+}
 
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+void CInterface::BroadcastData(const CInterpolator& interpolator,
+                               CSolver *donor_solution, CSolver *target_solution,
+                               CGeometry *donor_geometry, CGeometry *target_geometry,
+                               const CConfig *donor_config, const CConfig *target_config) {
+  static_assert(su2activematrix::Storage == StorageType::RowMajor,"");
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
+                        donor_config, target_config);
+
+  /*--- The communication patterns only change when the interpolator is updated. ---*/
+
+  if ((PlanInterpolator != &interpolator) || (PlanUpdates != interpolator.GetnTransferCoeffUpdates())) {
+    SetTransferPlans(interpolator, donor_geometry, target_geometry, donor_config, target_config);
+  }
+
+  /*--- Loop over interface markers. ---*/
+
+  for (const auto& plan : TransferPlans) {
+
+    if (!plan.active) continue;
+
+    const auto markDonor = plan.markDonor;
+    const auto markTarget = plan.markTarget;
+
+    /*--- Evaluate the donor variables that are needed by any rank. ---*/
+
+    su2activematrix donorVar(plan.donorVertex.size(), nVar);
+
+    for (auto i = 0ul; i < plan.donorVertex.size(); ++i) {
+      const auto iVertex = plan.donorVertex[i];
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+      for (auto iVar = 0u; iVar < nVar; iVar++) donorVar(i, iVar) = Donor_Variable[iVar];
+    }
+
+    /*--- Fill the send buffer and exchange data with the neighbor ranks. ---*/
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+    su2activematrix sendVar(plan.sendIdx.size(), nVar), recvVar(plan.recvPtr.back(), nVar);
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+    for (auto i = 0ul; i < plan.sendIdx.size(); ++i)
+      for (auto iVar = 0u; iVar < nVar; iVar++) sendVar(i, iVar) = donorVar(plan.sendIdx[i], iVar);
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
+    vector<SU2_MPI::Request> requests(plan.sendRank.size() + plan.recvRank.size());
+    auto nRequest = 0ul;
+
+    for (auto i = 0ul; i < plan.recvRank.size(); ++i) {
+      if (plan.recvRank[i] == PlanRank) continue;
+      SU2_MPI::Irecv(recvVar[plan.recvPtr[i]], (plan.recvPtr[i+1] - plan.recvPtr[i]) * nVar, MPI_DOUBLE,
+                     plan.recvRank[i], 0, PlanComm, &requests[nRequest++]);
+    }
+    for (auto i = 0ul; i < plan.sendRank.size(); ++i) {
+      if (plan.sendRank[i] == PlanRank) {
+        const auto j = find(plan.recvRank.begin(), plan.recvRank.end(), PlanRank) - plan.recvRank.begin();
+        for (auto k = 0ul; k < plan.sendPtr[i+1] - plan.sendPtr[i]; ++k)
+          for (auto iVar = 0u; iVar < nVar; iVar++)
+            recvVar(plan.recvPtr[j] + k, iVar) = sendVar(plan.sendPtr[i] + k, iVar);
+        continue;
+      }
+      SU2_MPI::Isend(sendVar[plan.sendPtr[i]], (plan.sendPtr[i+1] - plan.sendPtr[i]) * nVar, MPI_DOUBLE,
+                     plan.sendRank[i], 0, PlanComm, &requests[nRequest++]);
     }
+    SU2_MPI::Waitall(nRequest, requests.data(), MPI_STATUSES_IGNORE);
 
-    /*--- Loop over target vertices. ---*/
+    /*--- This rank does not need to do more work. ---*/
+    if (markTarget < 0) continue;
+
+    /*--- Loop over target vertices, the donors are visited in the order used to build the plan. ---*/
+
+    auto iSlot = 0ul;
 
     for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
       const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
@@ -170,18 +274,10 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
       /*--- For the number of donor points. ---*/
       for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
 
-        /*--- Get the global index of the donor and the interpolation coefficient. ---*/
-
-        const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
         const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
 
-        /*--- Find the index of the global donor point in the donor data. ---*/
-
-        const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
-        assert(idx < static_cast<long>(donorIdx.size()));
-
         /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+        RecoverTarget_Variable(recvVar[plan.donorSlot[iSlot++]], donorCoeff);
 
         /*--- If the value is not directly aggregated in the previous function. ---*/
         if (!valAggregated)
@@ -326,319 +422,54 @@ void CInterface::PreprocessAverage(CGeometry *donor_geometry, CGeometry *target_
 }
 
 
-void CInterface::AllgatherAverage(CSolver *donor_solution, CSolver *target_solution,
-                                  CGeometry *donor_geometry, CGeometry *target_geometry,
-                                  const CConfig *donor_config, const CConfig *target_config, unsigned short iMarkerInt){
-
-  unsigned short  nMarkerDonor, nMarkerTarget;    // Number of markers on the interface, donor and target side
-  unsigned short  iMarkerDonor, iMarkerTarget;    // Variables for iteration over markers
-  unsigned short iSpan, nSpanDonor, nSpanTarget;
-  int Marker_Donor = -1, Marker_Target = -1;
-  su2double *avgPressureDonor = nullptr, *avgDensityDonor = nullptr, *avgNormalVelDonor = nullptr,
-      *avgTangVelDonor = nullptr, *avg3DVelDonor = nullptr, *avgNuDonor = nullptr,
-      *avgOmegaDonor = nullptr, *avgKineDonor = nullptr;
-  su2double *avgPressureTarget = nullptr, *avgDensityTarget = nullptr, *avgNormalVelTarget = nullptr,
-      *avg3DVelTarget = nullptr, *avgTangVelTarget = nullptr, *avgNuTarget = nullptr,
-      *avgOmegaTarget = nullptr, *avgKineTarget = nullptr;
+void CInterface::SetTargetAverages(const vector<su2double>& donorAverages, CSolver *target_solution,
+                                   CGeometry *target_geometry, const CConfig *donor_config,
+                                   const CConfig *target_config, unsigned short iMarkerInt){
 
-#ifdef HAVE_MPI
-  int iSize;
-  su2double *BuffAvgPressureDonor = NULL, *BuffAvgDensityDonor = NULL, *BuffAvgNormalVelDonor = NULL,
-      *BuffAvg3DVelDonor = NULL, *BuffAvgTangVelDonor = NULL, *BuffAvgNuDonor = NULL,
-      *BuffAvgKineDonor = NULL, *BuffAvgOmegaDonor = NULL;
-  int nSpanSize, *BuffMarkerDonor;
-#endif
+  constexpr unsigned short nQuant = 8;
+  const unsigned short nSpanDonor = donor_config->GetnSpanWiseSections() +1;
+  const unsigned short nSpanTarget = target_config->GetnSpanWiseSections() +1;
 
-
-  nMarkerTarget  = target_geometry->GetnMarker();
-  nMarkerDonor   = donor_geometry->GetnMarker();
-  nSpanDonor     = donor_config->GetnSpanWiseSections() +1;
-  nSpanTarget    = target_config->GetnSpanWiseSections() +1;
-
-
-  avgDensityDonor                  = new su2double[nSpanDonor];
-  avgPressureDonor                 = new su2double[nSpanDonor];
-  avgNormalVelDonor                = new su2double[nSpanDonor];
-  avgTangVelDonor                  = new su2double[nSpanDonor];
-  avg3DVelDonor                    = new su2double[nSpanDonor];
-  avgNuDonor                       = new su2double[nSpanDonor];
-  avgKineDonor                     = new su2double[nSpanDonor];
-  avgOmegaDonor                    = new su2double[nSpanDonor];
-
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]         = -1.0;
-    avgPressureDonor[iSpan]        = -1.0;
-    avgNormalVelDonor[iSpan]       = -1.0;
-    avgTangVelDonor[iSpan]         = -1.0;
-    avg3DVelDonor[iSpan]           = -1.0;
-    avgNuDonor[iSpan]              = -1.0;
-    avgKineDonor[iSpan]            = -1.0;
-    avgOmegaDonor[iSpan]           = -1.0;
-  }
-
-  avgDensityTarget                 = new su2double[nSpanTarget];
-  avgPressureTarget                = new su2double[nSpanTarget];
-  avgNormalVelTarget               = new su2double[nSpanTarget];
-  avgTangVelTarget                 = new su2double[nSpanTarget];
-  avg3DVelTarget                   = new su2double[nSpanTarget];
-  avgNuTarget                      = new su2double[nSpanTarget];
-  avgKineTarget                    = new su2double[nSpanTarget];
-  avgOmegaTarget                   = new su2double[nSpanTarget];
-
-
-  for (iSpan = 0; iSpan < nSpanTarget; iSpan++){
-    avgDensityTarget[iSpan]        = -1.0;
-    avgPressureTarget[iSpan]       = -1.0;
-    avgNormalVelTarget[iSpan]      = -1.0;
-    avgTangVelTarget[iSpan]        = -1.0;
-    avg3DVelTarget[iSpan]          = -1.0;
-    avgNuTarget[iSpan]             = -1.0;
-    avgKineTarget[iSpan]           = -1.0;
-    avgOmegaTarget[iSpan]          = -1.0;
-  }
-
-  /*--- Outer loop over the markers on the Mixing-Plane interface: compute one by one ---*/
-  /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerMixingPlane ---*/
-  Marker_Donor = -1;
-  Marker_Target = -1;
-
-  /*--- The donor and target markers are tagged with the same index.
-   *--- This is independent of the MPI domain decomposition.
-   *--- We need to loop over all markers on both sides  ---*/
-
-  /*--- On the donor side ---*/
-
-  for (iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++){
-    /*--- If the tag GetMarker_All_MixingPlaneInterface equals the index we are looping at ---*/
-    if ( donor_config->GetMarker_All_MixingPlaneInterface(iMarkerDonor) == iMarkerInt ){
-      /*--- We have identified the local index of the Donor marker ---*/
-      /*--- Now we are going to store the average values that belong to Marker_Donor on each processor ---*/
-      /*--- Store the identifier for the structural marker ---*/
-      Marker_Donor = iMarkerDonor;
-      /*--- Exit the for loop: we have found the local index for Mixing-Plane interface ---*/
-      break;
-    }
-    else {
-      /*--- If the tag hasn't matched any tag within the donor markers ---*/
-      Marker_Donor = -1;
-    }
-  }
-  /*--- Here we want to make available the quantities for all the processors and collect them in a buffer
-   * for each span of the donor the span-wise height vector also so
-   * that then we can interpolate on the target side  ---*/
-  if (Marker_Donor != -1){
-    for(iSpan = 0; iSpan < nSpanDonor; iSpan++){
-      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iSpan, rank);
-      avgDensityDonor[iSpan]          = Donor_Variable[0];
-      avgPressureDonor[iSpan]         = Donor_Variable[1];
-      avgNormalVelDonor[iSpan]        = Donor_Variable[2];
-      avgTangVelDonor[iSpan]          = Donor_Variable[3];
-      avg3DVelDonor[iSpan]            = Donor_Variable[4];
-      avgNuDonor[iSpan]               = Donor_Variable[5];
-      avgKineDonor[iSpan]             = Donor_Variable[6];
-      avgOmegaDonor[iSpan]            = Donor_Variable[7];
-    }
-  }
-
-#ifdef HAVE_MPI
-  nSpanSize = size*nSpanDonor;
-  BuffAvgDensityDonor                 = new su2double[nSpanSize];
-  BuffAvgPressureDonor                = new su2double[nSpanSize];
-  BuffAvgNormalVelDonor               = new su2double[nSpanSize];
-  BuffAvgTangVelDonor                 = new su2double[nSpanSize];
-  BuffAvg3DVelDonor                   = new su2double[nSpanSize];
-  BuffAvgNuDonor                      = new su2double[nSpanSize];
-  BuffAvgKineDonor                    = new su2double[nSpanSize];
-  BuffAvgOmegaDonor                   = new su2double[nSpanSize];
-  BuffMarkerDonor                     = new int[size];
-
-  for (iSpan=0;iSpan<nSpanSize;iSpan++){
-    BuffAvgDensityDonor[iSpan]        = -1.0;
-    BuffAvgPressureDonor[iSpan]       = -1.0;
-    BuffAvgNormalVelDonor[iSpan]      = -1.0;
-    BuffAvgTangVelDonor[iSpan]        = -1.0;
-    BuffAvg3DVelDonor[iSpan]          = -1.0;
-    BuffAvgNuDonor[iSpan]             = -1.0;
-    BuffAvgKineDonor[iSpan]           = -1.0;
-    BuffAvgOmegaDonor[iSpan]          = -1.0;
-  }
-
-  for (iSize=0; iSize<size;iSize++){
-    BuffMarkerDonor[iSize]            = -1;
-  }
-
-  SU2_MPI::Allgather(avgDensityDonor, nSpanDonor , MPI_DOUBLE, BuffAvgDensityDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgPressureDonor, nSpanDonor , MPI_DOUBLE, BuffAvgPressureDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgNormalVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNormalVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgTangVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgTangVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avg3DVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvg3DVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgNuDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNuDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgKineDonor, nSpanDonor , MPI_DOUBLE, BuffAvgKineDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgOmegaDonor, nSpanDonor , MPI_DOUBLE, BuffAvgOmegaDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, SU2_MPI::GetComm());
-
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]            = -1.0;
-    avgPressureDonor[iSpan]           = -1.0;
-    avgNormalVelDonor[iSpan]          = -1.0;
-    avgTangVelDonor[iSpan]            = -1.0;
-    avg3DVelDonor[iSpan]              = -1.0;
-    avgNuDonor[iSpan]                 = -1.0;
-    avgKineDonor[iSpan]               = -1.0;
-    avgOmegaDonor[iSpan]              = -1.0;
-  }
-
-  Marker_Donor= -1;
-
-  for (iSize=0; iSize<size;iSize++){
-    if(BuffAvgDensityDonor[nSpanDonor*iSize] > 0.0){
-      for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-        avgDensityDonor[iSpan]        = BuffAvgDensityDonor[nSpanDonor*iSize + iSpan];
-        avgPressureDonor[iSpan]       = BuffAvgPressureDonor[nSpanDonor*iSize + iSpan];
-        avgNormalVelDonor[iSpan]      = BuffAvgNormalVelDonor[nSpanDonor*iSize + iSpan];
-        avgTangVelDonor[iSpan]        = BuffAvgTangVelDonor[nSpanDonor*iSize + iSpan];
-        avg3DVelDonor[iSpan]          = BuffAvg3DVelDonor[nSpanDonor*iSize + iSpan];
-        avgNuDonor[iSpan]             = BuffAvgNuDonor[nSpanDonor*iSize + iSpan];
-        avgKineDonor[iSpan]           = BuffAvgKineDonor[nSpanDonor*iSize + iSpan];
-        avgOmegaDonor[iSpan]          = BuffAvgOmegaDonor[nSpanDonor*iSize + iSpan];
-      }
-      Marker_Donor                    = BuffMarkerDonor[iSize];
-      break;
-    }
-  }
-  delete [] BuffAvgDensityDonor;
-  delete [] BuffAvgPressureDonor;
-  delete [] BuffAvgNormalVelDonor;
-  delete [] BuffAvgTangVelDonor;
-  delete [] BuffAvg3DVelDonor;
-  delete [] BuffAvgNuDonor;
-  delete [] BuffAvgKineDonor;
-  delete [] BuffAvgOmegaDonor;
-  delete [] BuffMarkerDonor;
-#endif
+  if (donorAverages.empty()) return;
 
   /*--- On the target side we have to identify the marker as well ---*/
-  for (iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++){
-    /*--- If the tag GetMarker_All_MixingPlaneInterface(iMarkerTarget) equals the index we are looping at ---*/
-    if ( target_config->GetMarker_All_MixingPlaneInterface(iMarkerTarget) == iMarkerInt ){
-      /*--- Store the identifier for the fluid marker ---*/
+  int Marker_Target = -1;
+  for (unsigned short iMarkerTarget = 0; iMarkerTarget < target_geometry->GetnMarker(); iMarkerTarget++){
+    if (target_config->GetMarker_All_MixingPlaneInterface(iMarkerTarget) == iMarkerInt){
       Marker_Target = iMarkerTarget;
-      /*--- Exit the for loop: we have found the local index for iMarkerFSI on the FEA side ---*/
       break;
     }
-    else {
-      /*--- If the tag hasn't matched any tag within the Flow markers ---*/
-      Marker_Target = -1;
-    }
   }
+  if (Marker_Target == -1) return;
 
+  auto donor = [&](unsigned short iSpan, unsigned short iQuant) { return donorAverages[iSpan*nQuant + iQuant]; };
 
-  if (Marker_Target != -1 && Marker_Donor != -1){
+  for (unsigned short iSpan = 0; iSpan < nSpanTarget; iSpan++){
+    for (unsigned short iQuant = 0; iQuant < nQuant; iQuant++){
 
-    /*--- linear interpolation of the average value of for the internal span-wise levels ---*/
-    for(iSpan = 1; iSpan < nSpanTarget -2 ; iSpan++){
-      avgDensityTarget[iSpan]             = SpanValueCoeffTarget[iSpan]*(avgDensityDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgDensityDonor[SpanLevelDonor[iSpan]]);
-      avgDensityTarget[iSpan]            += avgDensityDonor[SpanLevelDonor[iSpan]];
-      avgPressureTarget[iSpan]            = SpanValueCoeffTarget[iSpan]*(avgPressureDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgPressureDonor[SpanLevelDonor[iSpan]]);
-      avgPressureTarget[iSpan]           += avgPressureDonor[SpanLevelDonor[iSpan]];
-      avgNormalVelTarget[iSpan]           = SpanValueCoeffTarget[iSpan]*(avgNormalVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgNormalVelDonor[SpanLevelDonor[iSpan]]);
-      avgNormalVelTarget[iSpan]          += avgNormalVelDonor[SpanLevelDonor[iSpan]];
-      avgTangVelTarget[iSpan]             = SpanValueCoeffTarget[iSpan]*(avgTangVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgTangVelDonor[SpanLevelDonor[iSpan]]);
-      avgTangVelTarget[iSpan]            += avgTangVelDonor[SpanLevelDonor[iSpan]];
-      avg3DVelTarget[iSpan]               = SpanValueCoeffTarget[iSpan]*(avg3DVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avg3DVelDonor[SpanLevelDonor[iSpan]]);
-      avg3DVelTarget[iSpan]              += avg3DVelDonor[SpanLevelDonor[iSpan]];
-      avgNuTarget[iSpan]                  = SpanValueCoeffTarget[iSpan]*(avgNuDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgNuDonor[SpanLevelDonor[iSpan]]);
-      avgNuTarget[iSpan]                 += avgNuDonor[SpanLevelDonor[iSpan]];
-      avgKineTarget[iSpan]                = SpanValueCoeffTarget[iSpan]*(avgKineDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgKineDonor[SpanLevelDonor[iSpan]]);
-      avgKineTarget[iSpan]               += avgKineDonor[SpanLevelDonor[iSpan]];
-      avgOmegaTarget[iSpan]               = SpanValueCoeffTarget[iSpan]*(avgOmegaDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgOmegaDonor[SpanLevelDonor[iSpan] ]);
-      avgOmegaTarget[iSpan]              += avgOmegaDonor[SpanLevelDonor[iSpan]];
+      if (iSpan == nSpanTarget - 1){
+        /*--- transfer 1D values ---*/
+        Target_Variable[iQuant] = donor(nSpanDonor - 1, iQuant);
+      }
+      else if (iSpan == nSpanTarget - 2){
+        /*--- transfer values at the shroud ---*/
+        Target_Variable[iQuant] = donor(nSpanDonor - 2, iQuant);
+      }
+      else if (iSpan == 0){
+        /*--- transfer values at the hub ---*/
+        Target_Variable[iQuant] = donor(0, iQuant);
+      }
+      else {
+        /*--- linear interpolation of the average value of for the internal span-wise levels ---*/
+        const auto iSpanDonor = SpanLevelDonor[iSpan];
+        Target_Variable[iQuant]  = SpanValueCoeffTarget[iSpan]*(donor(iSpanDonor + 1, iQuant) - donor(iSpanDonor, iQuant));
+        Target_Variable[iQuant] += donor(iSpanDonor, iQuant);
+      }
     }
 
-
-    /*--- transfer values at the hub ---*/
-    avgDensityTarget[0]                      = avgDensityDonor[0];
-    avgPressureTarget[0]                     = avgPressureDonor[0];
-    avgNormalVelTarget[0]                    = avgNormalVelDonor[0];
-    avgTangVelTarget[0]                      = avgTangVelDonor[0];
-    avg3DVelTarget[0]                        = avg3DVelDonor[0];
-    avgNuTarget[0]                           = avgNuDonor[0];
-    avgKineTarget[0]                         = avgKineDonor[0];
-    avgOmegaTarget[0]                        = avgOmegaDonor[0];
-
-    /*--- transfer values at the shroud ---*/
-    avgDensityTarget[nSpanTarget - 2]        = avgDensityDonor[nSpanDonor - 2];
-    avgPressureTarget[nSpanTarget - 2]       = avgPressureDonor[nSpanDonor - 2];
-    avgNormalVelTarget[nSpanTarget - 2]      = avgNormalVelDonor[nSpanDonor - 2];
-    avgTangVelTarget[nSpanTarget - 2]        = avgTangVelDonor[nSpanDonor - 2];
-    avg3DVelTarget[nSpanTarget - 2]          = avg3DVelDonor[nSpanDonor - 2];
-    avgNuTarget[nSpanTarget - 2]             = avgNuDonor[nSpanDonor - 2];
-    avgKineTarget[nSpanTarget - 2]           = avgKineDonor[nSpanDonor - 2];
-    avgOmegaTarget[nSpanTarget - 2]          = avgOmegaDonor[nSpanDonor - 2];
-
-    /*--- transfer 1D values ---*/
-    avgDensityTarget[nSpanTarget - 1]        = avgDensityDonor[nSpanDonor - 1];
-    avgPressureTarget[nSpanTarget - 1]       = avgPressureDonor[nSpanDonor - 1];
-    avgNormalVelTarget[nSpanTarget - 1]      = avgNormalVelDonor[nSpanDonor - 1];
-    avgTangVelTarget[nSpanTarget - 1]        = avgTangVelDonor[nSpanDonor - 1];
-    avg3DVelTarget[nSpanTarget - 1]          = avg3DVelDonor[nSpanDonor - 1];
-    avgNuTarget[nSpanTarget - 1]             = avgNuDonor[nSpanDonor - 1];
-    avgKineTarget[nSpanTarget - 1]           = avgKineDonor[nSpanDonor - 1];
-    avgOmegaTarget[nSpanTarget - 1]          = avgOmegaDonor[nSpanDonor - 1];
-
-
     /*---finally, the interpolated value is sent  to the target zone ---*/
-    for(iSpan = 0; iSpan < nSpanTarget ; iSpan++){
-      Target_Variable[0]                     = avgDensityTarget[iSpan];
-      Target_Variable[1]                     = avgPressureTarget[iSpan];
-      Target_Variable[2]                     = avgNormalVelTarget[iSpan];
-      Target_Variable[3]                     = avgTangVelTarget[iSpan];
-      Target_Variable[4]                     = avg3DVelTarget[iSpan];
-      Target_Variable[5]                     = avgNuTarget[iSpan];
-      Target_Variable[6]                     = avgKineTarget[iSpan];
-      Target_Variable[7]                     = avgOmegaTarget[iSpan];
-
-
-      SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, iSpan, rank);
-    }
+    SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, iSpan, rank);
   }
-
-  delete [] avgDensityDonor;
-  delete [] avgPressureDonor;
-  delete [] avgNormalVelDonor;
-  delete [] avgTangVelDonor;
-  delete [] avg3DVelDonor;
-  delete [] avgNuDonor;
-  delete [] avgKineDonor;
-  delete [] avgOmegaDonor;
-
-
-  delete [] avgDensityTarget;
-  delete [] avgPressureTarget;
-  delete [] avgNormalVelTarget;
-  delete [] avgTangVelTarget;
-  delete [] avg3DVelTarget;
-  delete [] avgNuTarget;
-  delete [] avgKineTarget;
-  delete [] avgOmegaTarget;
-
-
 }
 
 void CInterface::GatherAverageValues(CSolver *donor_solution, CSolver *target_solution, unsigned short donorZone){
@@ -53,40 +53,95 @@ void CMixingPlaneInterface::SetSpanWiseLevels(const CConfig *donor_config, const
   }
 }
 
-void CMixingPlaneInterface::GetDonor_Variable(CSolver *donor_solution, CGeometry *donor_geometry,
-                                              const CConfig *donor_config, unsigned long Marker_Donor,
-                                              unsigned long iSpan, unsigned long rank) {
+void CMixingPlaneInterface::GetDonorAverages(const CSolver *donor_solution, const CConfig *donor_config,
+                                             unsigned short nDim, unsigned long Marker_Donor,
+                                             unsigned long iSpan, su2double *values) {
 
-  unsigned short nDim = nVar - 2;
   bool turbulent = (donor_config->GetKind_Turb_Model() != NONE);
 
-
-
-  Donor_Variable[0] = donor_solution->GetAverageDensity(Marker_Donor, iSpan);
-  Donor_Variable[1] = donor_solution->GetAveragePressure(Marker_Donor, iSpan);
-  Donor_Variable[2] = donor_solution->GetAverageTurboVelocity(Marker_Donor, iSpan)[0];
-  Donor_Variable[3] = donor_solution->GetAverageTurboVelocity(Marker_Donor, iSpan)[1];
+  values[0] = donor_solution->GetAverageDensity(Marker_Donor, iSpan);
+  values[1] = donor_solution->GetAveragePressure(Marker_Donor, iSpan);
+  values[2] = donor_solution->GetAverageTurboVelocity(Marker_Donor, iSpan)[0];
+  values[3] = donor_solution->GetAverageTurboVelocity(Marker_Donor, iSpan)[1];
 
   if(nDim == 3){
-    Donor_Variable[4] = donor_solution->GetAverageTurboVelocity(Marker_Donor, iSpan)[2];
+    values[4] = donor_solution->GetAverageTurboVelocity(Marker_Donor, iSpan)[2];
   }
   else{
-    Donor_Variable[4] = -1.0;
+    values[4] = -1.0;
   }
 
   if(turbulent){
-    Donor_Variable[5] = donor_solution->GetAverageNu(Marker_Donor, iSpan);
-    Donor_Variable[6] = donor_solution->GetAverageKine(Marker_Donor, iSpan);
-    Donor_Variable[7] = donor_solution->GetAverageOmega(Marker_Donor, iSpan);
+    values[5] = donor_solution->GetAverageNu(Marker_Donor, iSpan);
+    values[6] = donor_solution->GetAverageKine(Marker_Donor, iSpan);
+    values[7] = donor_solution->GetAverageOmega(Marker_Donor, iSpan);
   }
   else{
-    Donor_Variable[5] = -1.0;
-    Donor_Variable[6] = -1.0;
-    Donor_Variable[7] = -1.0;
+    values[5] = -1.0;
+    values[6] = -1.0;
+    values[7] = -1.0;
   }
 
 }
 
+void CMixingPlaneInterface::GetDonor_Variable(CSolver *donor_solution, CGeometry *donor_geometry,
+                                              const CConfig *donor_config, unsigned long Marker_Donor,
+                                              unsigned long iSpan, unsigned long rank) {
+
+  GetDonorAverages(donor_solution, donor_config, nVar - 2, Marker_Donor, iSpan, Donor_Variable);
+
+}
+
+void CMixingPlaneInterface::AllgatherDonorAverages(const CSolver *donor_solution, const CGeometry *donor_geometry,
+                                                   const CConfig *donor_config, vector<vector<su2double> >& donorAverages){
+
+  const int size = SU2_MPI::GetSize();
+  const unsigned short nDim = donor_geometry->GetnDim();
+  const unsigned short nMarkerInt = donor_config->GetnMarker_MixingPlaneInterface()/2;
+  const unsigned short nSpanDonor = donor_config->GetnSpanWiseSections() +1;
+  const unsigned long blockSize = 1 + nSpanDonor*nQuant;
+
+  /*--- The averages of all the mixing-plane markers of the donor are packed in one buffer,
+   *    each interface has a block with a flag (1 if the marker is on this rank) and the span-wise values.
+   *    Any rank that has the marker holds the (global) averages, the buffer is gathered by all ranks
+   *    in one communication. ---*/
+
+  vector<su2double> sendBuf(nMarkerInt*blockSize, -1.0);
+
+  for (unsigned short iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++){
+
+    /*--- The donor and target markers are tagged with the same index.
+     *--- This is independent of the MPI domain decomposition. ---*/
+
+    for (unsigned short iMarkerDonor = 0; iMarkerDonor < donor_geometry->GetnMarker(); iMarkerDonor++){
+      if (donor_config->GetMarker_All_MixingPlaneInterface(iMarkerDonor) != iMarkerInt) continue;
+
+      su2double* block = &sendBuf[(iMarkerInt-1)*blockSize];
+      block[0] = 1.0;
+      for (unsigned short iSpan = 0; iSpan < nSpanDonor; iSpan++)
+        GetDonorAverages(donor_solution, donor_config, nDim, iMarkerDonor, iSpan, &block[1 + iSpan*nQuant]);
+      break;
+    }
+  }
+
+  vector<su2double> recvBuf(size*sendBuf.size());
+
+  SU2_MPI::Allgather(sendBuf.data(), sendBuf.size(), MPI_DOUBLE, recvBuf.data(), sendBuf.size(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+  /*--- Keep the values of the first rank that has each marker, empty if no rank has it. ---*/
+
+  donorAverages.assign(nMarkerInt, vector<su2double>());
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++){
+    for (int iSize = 0; iSize < size; iSize++){
+      const su2double* block = &recvBuf[iSize*sendBuf.size() + iMarkerInt*blockSize];
+      if (block[0] > 0.0){
+        donorAverages[iMarkerInt].assign(block+1, block+blockSize);
+        break;
+      }
+    }
+  }
+}
 
 void CMixingPlaneInterface::SetTarget_Variable(CSolver *target_solution, CGeometry *target_geometry,
                                                const CConfig *target_config, unsigned long Marker_Target,
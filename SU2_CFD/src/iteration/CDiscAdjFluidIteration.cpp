@@ -26,7 +26,14 @@
  */
 
 #include "../../include/iteration/CDiscAdjFluidIteration.hpp"
+#include "../../include/iteration/CFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/COutputFactory.hpp"
+
+CDiscAdjFluidIteration::CDiscAdjFluidIteration(const CConfig *config) : CIteration(config),
+  turbulent(config->GetKind_Solver() == DISC_ADJ_RANS || config->GetKind_Solver() == DISC_ADJ_INC_RANS) {}
+
+CDiscAdjFluidIteration::~CDiscAdjFluidIteration() = default;
 
 void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                         CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -54,7 +61,8 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
     if (TimeIter == 0) {
       if (dual_time_2nd) {
         /*--- Load solution at timestep n-2 ---*/
-        LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, Direct_Iter - 2);
+        GetUnsteady_Solution(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement,
+                             FFDBox, iZone, iInst, Direct_Iter - 2);
 
         /*--- Push solution back to correct array ---*/
 
@@ -83,7 +91,8 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
       }
       if (dual_time) {
         /*--- Load solution at timestep n-1 ---*/
-        LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, Direct_Iter - 1);
+        GetUnsteady_Solution(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement,
+                             FFDBox, iZone, iInst, Direct_Iter - 1);
 
         /*--- Push solution back to correct array ---*/
 
@@ -108,7 +117,8 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
 
       /*--- Load solution timestep n ---*/
 
-      LoadUnsteady_Solution(geometry, solver, config, iInst, iZone, Direct_Iter);
+      GetUnsteady_Solution(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement,
+                           FFDBox, iZone, iInst, Direct_Iter);
 
       if (config[iZone]->GetDeform_Mesh()) {
         solvers0[MESH_SOL]->LoadRestart(geometries, solver[iZone][iInst], config[iZone], Direct_Iter, true);
@@ -139,9 +149,11 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
 
       /*--- Load solution timestep n-1 | n-2 for DualTimestepping 1st | 2nd order ---*/
       if (dual_time_1st) {
-        LoadUnsteady_Solution(geometry, solver, config, iInst, iZone, Direct_Iter - 1);
+        GetUnsteady_Solution(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement,
+                             FFDBox, iZone, iInst, Direct_Iter - 1);
       } else {
-        LoadUnsteady_Solution(geometry, solver, config, iInst, iZone, Direct_Iter - 2);
+        GetUnsteady_Solution(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement,
+                             FFDBox, iZone, iInst, Direct_Iter - 2);
 
         /*--- Set volumes into correct containers ---*/
         if (config[iZone]->GetDynamic_Grid()) {
@@ -367,6 +379,231 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry**** geometry, CSolv
   }
 }
 
+void CDiscAdjFluidIteration::GetUnsteady_Solution(COutput* output, CIntegration**** integration, CGeometry**** geometry,
+                                                  CSolver***** solver, CNumerics****** numerics, CConfig** config,
+                                                  CSurfaceMovement** surface_movement,
+                                                  CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox,
+                                                  unsigned short iZone, unsigned short iInst, int DirectIter) {
+  if (config[iZone]->GetUnst_AdjointCheckpoints() > 0 && DirectIter >= config[iZone]->GetUnst_AdjointCheckpointStart()) {
+    RecomputeUnsteady_Solution(output, integration, geometry, solver, numerics, config, surface_movement,
+                               grid_movement, FFDBox, iZone, iInst, DirectIter);
+  } else {
+    LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, DirectIter);
+  }
+}
+
+void CDiscAdjFluidIteration::RecomputeUnsteady_Solution(COutput* output, CIntegration**** integration,
+                                                        CGeometry**** geometry, CSolver***** solver,
+                                                        CNumerics****** numerics, CConfig** config,
+                                                        CSurfaceMovement** surface_movement,
+                                                        CVolumetricMovement*** grid_movement,
+                                                        CFreeFormDefBox*** FFDBox, unsigned short iZone,
+                                                        unsigned short iInst, long DirectIter) {
+  auto cfg = config[iZone];
+  auto geometries = geometry[iZone][iInst];
+  auto solvers = solver[iZone][iInst];
+  const auto sols = GetPrimalSolvers(cfg);
+  const bool dual_time_2nd = (cfg->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+
+  if (!primal_iteration) primal_iteration.reset(new CFluidIteration(cfg));
+
+  /*--- The recomputed steps are converged with the criteria of the primal, monitored by a primal output
+   *    that does not write to screen or file. ---*/
+
+  if (!primal_output) {
+    const auto kindSolver = (cfg->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE)? EULER : INC_EULER;
+    primal_output.reset(COutputFactory::CreateOutput(kindSolver, cfg, geometries[MESH_0]->GetnDim()));
+    primal_output->PreprocessHistoryOutput(cfg, false);
+  }
+
+  if (checkpoints.size() == 0) {
+    checkpoints.Initialize(cfg->GetUnst_AdjointCheckpoints(), cfg->GetUnst_AdjointCheckpointStart());
+  }
+
+  /*--- The time levels are set by the caller from the loaded solutions, the primal time steps
+   *    overwrite them, hence they are saved and restored at the end. ---*/
+
+  vector<su2double> time_levels;
+  for (auto iMesh = 0u; iMesh <= cfg->GetnMGLevels(); iMesh++) {
+    for (auto iSol : sols) {
+      auto nodes = solvers[iMesh][iSol]->GetNodes();
+      for (auto iPoint = 0ul; iPoint < geometries[iMesh]->GetnPoint(); iPoint++) {
+        for (auto iVar = 0u; iVar < solvers[iMesh][iSol]->GetnVar(); iVar++) {
+          time_levels.push_back(nodes->GetSolution_time_n(iPoint, iVar));
+          time_levels.push_back(nodes->GetSolution_time_n1(iPoint, iVar));
+        }
+      }
+    }
+  }
+  const auto TimeIter = cfg->GetTimeIter();
+  const auto InnerIter = cfg->GetInnerIter();
+  const su2double PhysicalTime = cfg->GetPhysicalTime();
+
+  /*--- Start from the closest checkpoint, or from the base solution (read from file). ---*/
+
+  const int iCheck = checkpoints.Latest(DirectIter);
+  long current = checkpoints.GetStep(iCheck);
+
+  if (rank == MASTER_NODE) {
+    cout << " Recomputing flow solution of direct iteration " << DirectIter << " from "
+         << ((iCheck < 0)? "direct iteration " : "the checkpoint of iteration ") << current << "." << endl;
+  }
+
+  if (iCheck < 0) {
+    if (dual_time_2nd) {
+      LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, current - 1);
+      for (auto iMesh = 0u; iMesh <= cfg->GetnMGLevels(); iMesh++) {
+        for (auto iSol : sols) {
+          solvers[iMesh][iSol]->GetNodes()->Set_Solution_time_n();
+          solvers[iMesh][iSol]->GetNodes()->Set_Solution_time_n1();
+        }
+      }
+    }
+    LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, current);
+    for (auto iMesh = 0u; iMesh <= cfg->GetnMGLevels(); iMesh++)
+      for (auto iSol : sols) solvers[iMesh][iSol]->GetNodes()->Set_Solution_time_n();
+  }
+  else {
+    RestoreCheckpoint(geometries, solvers, cfg, checkpoints.GetData(iCheck));
+  }
+
+  /*--- Advance the primal, the inner iterations stop when the primal convergence criteria are met. ---*/
+
+  long next = checkpoints.NextCheckpoint(current, DirectIter);
+
+  while (current < DirectIter) {
+    ++current;
+    cfg->SetTimeIter(current);
+    cfg->SetPhysicalTime(static_cast<su2double>(current)*cfg->GetDelta_UnstTimeND());
+
+    primal_iteration->Preprocess(output, integration, geometry, solver, numerics, config, surface_movement,
+                                 grid_movement, FFDBox, iZone, iInst);
+
+    for (auto iIter = 0ul; iIter < cfg->GetUnst_AdjointPrimalIter(); iIter++) {
+      cfg->SetInnerIter(iIter);
+      primal_iteration->Iterate(output, integration, geometry, solver, numerics, config, surface_movement,
+                                grid_movement, FFDBox, iZone, iInst);
+      if (primal_iteration->Monitor(primal_output.get(), integration, geometry, solver, numerics, config,
+                                    surface_movement, grid_movement, FFDBox, iZone, iInst)) break;
+    }
+
+    primal_iteration->Update(output, integration, geometry, solver, numerics, config, surface_movement,
+                             grid_movement, FFDBox, iZone, iInst);
+
+    if (current == next && current < DirectIter) {
+      const int iStore = checkpoints.Store(current, DirectIter);
+      if (iStore >= 0) StoreCheckpoint(solvers[MESH_0], cfg, checkpoints.GetData(iStore));
+      next = checkpoints.NextCheckpoint(current, DirectIter);
+    }
+  }
+
+  /*--- Leave everything as if the solution had been loaded from file. ---*/
+
+  RestrictPrimal_Solution(geometries, solvers, cfg);
+
+  unsigned long iTime = 0;
+  for (auto iMesh = 0u; iMesh <= cfg->GetnMGLevels(); iMesh++) {
+    for (auto iSol : sols) {
+      auto nodes = solvers[iMesh][iSol]->GetNodes();
+      for (auto iPoint = 0ul; iPoint < geometries[iMesh]->GetnPoint(); iPoint++) {
+        for (auto iVar = 0u; iVar < solvers[iMesh][iSol]->GetnVar(); iVar++) {
+          nodes->Set_Solution_time_n(iPoint, iVar, time_levels[iTime++]);
+          nodes->Set_Solution_time_n1(iPoint, iVar, time_levels[iTime++]);
+        }
+      }
+    }
+  }
+  cfg->SetTimeIter(TimeIter);
+  cfg->SetInnerIter(InnerIter);
+  cfg->SetPhysicalTime(PhysicalTime);
+}
+
+void CDiscAdjFluidIteration::StoreCheckpoint(CSolver* const* solver, const CConfig* config,
+                                             vector<passivedouble>& data) const {
+  /*--- After the dual time update, time n holds the current solution and time n-1 the previous. ---*/
+  const bool dual_time_2nd = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+  const auto sols = GetPrimalSolvers(config);
+
+  data.clear();
+  for (auto iLevel = 0; iLevel < 1+dual_time_2nd; iLevel++) {
+    for (auto iSol : sols) {
+      const auto nodes = solver[iSol]->GetNodes();
+      for (auto iPoint = 0ul; iPoint < nodes->GetSolution().rows(); iPoint++) {
+        for (auto iVar = 0u; iVar < solver[iSol]->GetnVar(); iVar++) {
+          const su2double val = iLevel? nodes->GetSolution_time_n1(iPoint, iVar) : nodes->GetSolution(iPoint, iVar);
+          data.push_back(SU2_TYPE::GetValue(val));
+        }
+      }
+    }
+  }
+}
+
+void CDiscAdjFluidIteration::RestoreCheckpoint(CGeometry** geometry, CSolver*** solver, CConfig* config,
+                                               const vector<passivedouble>& data) const {
+  const bool dual_time_2nd = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+  const auto sols = GetPrimalSolvers(config);
+
+  auto SetSolution = [&](unsigned long offset) {
+    for (auto iSol : sols) {
+      auto nodes = solver[MESH_0][iSol]->GetNodes();
+      for (auto iPoint = 0ul; iPoint < nodes->GetSolution().rows(); iPoint++)
+        for (auto iVar = 0u; iVar < solver[MESH_0][iSol]->GetnVar(); iVar++)
+          nodes->SetSolution(iPoint, iVar, data[offset++]);
+    }
+    RestrictPrimal_Solution(geometry, solver, config);
+  };
+
+  if (dual_time_2nd) {
+    SetSolution(data.size()/2);
+    for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++) {
+      for (auto iSol : sols) {
+        solver[iMesh][iSol]->GetNodes()->Set_Solution_time_n();
+        solver[iMesh][iSol]->GetNodes()->Set_Solution_time_n1();
+      }
+    }
+  }
+  SetSolution(0);
+  for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++)
+    for (auto iSol : sols) solver[iMesh][iSol]->GetNodes()->Set_Solution_time_n();
+}
+
+void CDiscAdjFluidIteration::RestrictPrimal_Solution(CGeometry** geometry, CSolver*** solver, CConfig* config) const {
+  const auto sols = GetPrimalSolvers(config);
+
+  for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (auto iSol : sols) {
+      auto nodes = solver[iMesh][iSol]->GetNodes();
+      const auto nVar = solver[iMesh][iSol]->GetnVar();
+
+      /*--- Volume weighted average of the children control volumes. ---*/
+      if (iMesh != MESH_0) {
+        const auto fineNodes = solver[iMesh-1][iSol]->GetNodes();
+        for (auto iPoint = 0ul; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
+          const su2double Area_Parent = geometry[iMesh]->nodes->GetVolume(iPoint);
+          for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint, iVar, 0.0);
+
+          for (auto iChildren = 0u; iChildren < geometry[iMesh]->nodes->GetnChildren_CV(iPoint); iChildren++) {
+            const auto Point_Fine = geometry[iMesh]->nodes->GetChildren_CV(iPoint, iChildren);
+            const su2double weight = geometry[iMesh-1]->nodes->GetVolume(Point_Fine) / Area_Parent;
+            for (auto iVar = 0u; iVar < nVar; iVar++)
+              nodes->SetSolution(iPoint, iVar, nodes->GetSolution(iPoint, iVar) + weight*fineNodes->GetSolution(Point_Fine, iVar));
+          }
+        }
+      }
+      solver[iMesh][iSol]->InitiateComms(geometry[iMesh], config, SOLUTION);
+      solver[iMesh][iSol]->CompleteComms(geometry[iMesh], config, SOLUTION);
+    }
+
+    solver[iMesh][FLOW_SOL]->Preprocessing(geometry[iMesh], solver[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    if (turbulent) {
+      solver[iMesh][TURB_SOL]->Postprocessing(geometry[iMesh], solver[iMesh], config, iMesh);
+    }
+    if (config->GetWeakly_Coupled_Heat()) {
+      solver[iMesh][HEAT_SOL]->Postprocessing(geometry[iMesh], solver[iMesh], config, iMesh);
+    }
+  }
+}
+
 void CDiscAdjFluidIteration::IterateDiscAdj(CGeometry**** geometry, CSolver***** solver, CConfig** config,
                                             unsigned short iZone, unsigned short iInst, bool CrossTerm) {
 
@@ -60,9 +60,6 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
 
   const bool unsteady = (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                         (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
-  const bool frozen_visc = (config[val_iZone]->GetContinuous_Adjoint() && config[val_iZone]->GetFrozen_Visc_Cont()) ||
-                           (config[val_iZone]->GetDiscrete_Adjoint() && config[val_iZone]->GetFrozen_Visc_Disc());
-  const bool disc_adj = (config[val_iZone]->GetDiscrete_Adjoint());
   TimeIter = config[val_iZone]->GetTimeIter();
 
   /* --- Setting up iteration values depending on if this is a
@@ -102,6 +99,34 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
   integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config, RUNTIME_FLOW_SYS,
                                                                    val_iZone, val_iInst);
 
+  /*--- With the coupled implicit harmonic balance method the flow update is only completed by the driver,
+   *    which then iterates the models, so that they see the updated flow state. ---*/
+
+  if (!config[val_iZone]->GetHB_CoupledImplicit())
+    IterateModels(integration, geometry, solver, numerics, config, val_iZone, val_iInst);
+
+  /*--- Call Dynamic mesh update if AEROELASTIC motion was specified ---*/
+
+  if ((config[val_iZone]->GetGrid_Movement()) && (config[val_iZone]->GetAeroelastic_Simulation()) && unsteady) {
+    SetGrid_Movement(geometry[val_iZone][val_iInst], surface_movement[val_iZone], grid_movement[val_iZone][val_iInst],
+                     solver[val_iZone][val_iInst], config[val_iZone], InnerIter, TimeIter);
+
+    /*--- Apply a Wind Gust ---*/
+
+    if (config[val_iZone]->GetWind_Gust()) {
+      if (InnerIter % config[val_iZone]->GetAeroelasticIter() == 0 && InnerIter != 0)
+        SetWind_GustField(config[val_iZone], geometry[val_iZone][val_iInst], solver[val_iZone][val_iInst]);
+    }
+  }
+}
+
+void CFluidIteration::IterateModels(CIntegration**** integration, CGeometry**** geometry, CSolver***** solver,
+                                    CNumerics****** numerics, CConfig** config, unsigned short val_iZone,
+                                    unsigned short val_iInst) {
+  const bool frozen_visc = (config[val_iZone]->GetContinuous_Adjoint() && config[val_iZone]->GetFrozen_Visc_Cont()) ||
+                           (config[val_iZone]->GetDiscrete_Adjoint() && config[val_iZone]->GetFrozen_Visc_Disc());
+  const bool disc_adj = (config[val_iZone]->GetDiscrete_Adjoint());
+
   /*--- If the flow integration is not fully coupled, run the various single grid integrations. ---*/
 
   if ((config[val_iZone]->GetKind_Solver() == RANS || config[val_iZone]->GetKind_Solver() == DISC_ADJ_RANS ||
@@ -110,8 +135,12 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
     /*--- Solve the turbulence model ---*/
 
     config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
-    integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                      RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    if (config[val_iZone]->GetMG_Turb())
+      integration[val_iZone][val_iInst][TURB_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config,
+                                                                       RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    else
+      integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                        RUNTIME_TURB_SYS, val_iZone, val_iInst);
 
     /*--- Solve transition model ---*/
 
@@ -143,20 +172,6 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
                                                                    solver[val_iZone][val_iInst], config[val_iZone]);
     END_SU2_OMP_PARALLEL
   }
-
-  /*--- Call Dynamic mesh update if AEROELASTIC motion was specified ---*/
-
-  if ((config[val_iZone]->GetGrid_Movement()) && (config[val_iZone]->GetAeroelastic_Simulation()) && unsteady) {
-    SetGrid_Movement(geometry[val_iZone][val_iInst], surface_movement[val_iZone], grid_movement[val_iZone][val_iInst],
-                     solver[val_iZone][val_iInst], config[val_iZone], InnerIter, TimeIter);
-
-    /*--- Apply a Wind Gust ---*/
-
-    if (config[val_iZone]->GetWind_Gust()) {
-      if (InnerIter % config[val_iZone]->GetAeroelasticIter() == 0 && InnerIter != 0)
-        SetWind_GustField(config[val_iZone], geometry[val_iZone][val_iInst], solver[val_iZone][val_iInst]);
-    }
-  }
 }
 
 void CFluidIteration::Update(COutput* output, CIntegration**** integration, CGeometry**** geometry, CSolver***** solver,
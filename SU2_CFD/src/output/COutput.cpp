@@ -47,8 +47,8 @@
 #include "../../include/solvers/CSolver.hpp"
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
-  rank(SU2_MPI::GetRank()),
-  size(SU2_MPI::GetSize()),
+  rank(SU2_MPI::GetRank(config->GetMPICommunicator())),
+  size(SU2_MPI::GetSize(config->GetMPICommunicator())),
   nDim(ndim),
   multiZone(config->GetMultizone_Problem()),
   gridMovement(config->GetGrid_Movement()),
@@ -82,9 +82,12 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   historyFilename = config->GetMultizone_HistoryFileName(historyFilename, config->GetiZone(), hist_ext);
 
-  /*--- Append the restart iteration ---*/
+  /*--- Append the first iteration of the time slice (parareal) or the restart iteration ---*/
 
-  if (config->GetTime_Domain() && config->GetRestart()) {
+  if (config->GetParareal_TimeSlices() > 1) {
+    historyFilename = config->GetUnsteady_FileName(historyFilename, config->GetParareal_SliceBegin(), hist_ext);
+  }
+  else if (config->GetTime_Domain() && config->GetRestart()) {
     historyFilename = config->GetUnsteady_FileName(historyFilename, config->GetRestart_Iter(), hist_ext);
   }
 
@@ -248,15 +251,30 @@ void COutput::SetMultizoneHistory_Output(COutput **output, CConfig **config, CCo
 
 }
 
+void COutput::BroadcastHistoryOutput(int root, SU2_MPI::Comm comm) {
+
+  vector<su2double> values;
+  values.reserve(historyOutput_List.size());
+
+  for (const auto& name : historyOutput_List)
+    values.push_back(historyOutput_Map.at(name).value);
+
+  SU2_MPI::Bcast(values.data(), values.size(), MPI_DOUBLE, root, comm);
+
+  for (auto iField = 0ul; iField < historyOutput_List.size(); iField++)
+    historyOutput_Map.at(historyOutput_List[iField]).value = values[iField];
+
+}
+
 void COutput::OutputScreenAndHistory(CConfig *config) {
 
   if (rank == MASTER_NODE && !noWriting) {
 
-    if (WriteHistoryFile_Output(config)) SetHistoryFile_Output(config);
+    if (wrtHistory && WriteHistoryFile_Output(config)) SetHistoryFile_Output(config);
 
-    if (WriteScreen_Header(config)) SetScreen_Header(config);
+    if (wrtScreen && WriteScreen_Header(config)) SetScreen_Header(config);
 
-    if (WriteScreen_Output(config)) SetScreen_Output(config);
+    if (wrtScreen && WriteScreen_Output(config)) SetScreen_Output(config);
 
   }
 }
@@ -1722,6 +1740,10 @@ void COutput::Postprocess_HistoryData(CConfig *config){
       }
       if (config->GetDirectDiff() != NO_DERIVATIVE){
         SetHistoryOutputValue("D_" + fieldIdentifier, SU2_TYPE::GetDerivative(currentField.value));
+        for (auto iDir = 1u; iDir < SU2_TYPE::nDirections; iDir++) {
+          SetHistoryOutputValue("D" + to_string(iDir) + "_" + fieldIdentifier,
+                                SU2_TYPE::GetDerivative(currentField.value, iDir));
+        }
       }
     }
   }
@@ -1779,6 +1801,13 @@ void COutput::Postprocess_HistoryFields(CConfig *config){
         AddHistoryOutput("D_"      + fieldIdentifier, "d["     + currentField.fieldName + "]",
                          currentField.screenFormat, "D_"      + currentField.outputGroup,
                          "Derivative value (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
+        /*--- Extra tangent directions of vector forward mode. ---*/
+        for (auto iDir = 1u; iDir < SU2_TYPE::nDirections; iDir++) {
+          const auto prefix = "D" + to_string(iDir) + "_";
+          AddHistoryOutput(prefix + fieldIdentifier, "d" + to_string(iDir) + "[" + currentField.fieldName + "]",
+                           currentField.screenFormat, "D_" + currentField.outputGroup,
+                           "Derivative value in an extra direction (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
+        }
       }
     }
   }
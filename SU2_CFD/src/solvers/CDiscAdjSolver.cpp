@@ -112,6 +112,12 @@ void CDiscAdjSolver::SetRecording(CGeometry* geometry, CConfig *config){
   const bool time_n1_needed = config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
   const bool time_n_needed = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) || time_n1_needed;
 
+  /*--- A new recording starts, the activity of the grid metrics must be checked again. ---*/
+
+  SU2_OMP_MASTER
+  geometry->SetPassiveRecording(-1);
+  END_SU2_OMP_MASTER
+
   /*--- Reset the solution to the initial (converged) solution ---*/
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -387,6 +393,69 @@ void CDiscAdjSolver::ExtractAdjoint_Solution(CGeometry *geometry, CConfig *confi
 
 }
 
+void CDiscAdjSolver::SetJacobianAdjointGuess(CGeometry *geometry, CConfig *config) {
+
+  /*--- The Jacobian of the direct solver was transposed (and its preconditioner built)
+   *    when the primal linear solver was recorded, it holds P^T = A^T + D. ---*/
+
+  auto& Jacobian = direct_solver->Jacobian;
+  const auto flowNodes = direct_solver->GetNodes();
+
+  auto buildPreconditioner = [&]() {
+    switch (config->GetKind_DiscAdj_Linear_Prec()) {
+      case ILU: Jacobian.BuildILUPreconditioner(); break;
+      case JACOBI: case LINELET: Jacobian.BuildJacobiPreconditioner(); break;
+      default: break;
+    }
+  };
+
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector<su2double> sol(nPoint, nPointDomain, nVar, 0.0);
+  vector<su2double> delta(nPointDomain, 0.0);
+
+  SU2_OMP_PARALLEL_(if(GetHasHybridParallel()))
+  {
+  /*--- Remove the pseudo-time term, and set the right hand side. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    if (flowNodes->GetDelta_Time(iPoint) != 0.0) {
+      const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+      delta[iPoint] = Vol / flowNodes->GetDelta_Time(iPoint);
+      Jacobian.AddVal2Diag(iPoint, -delta[iPoint]);
+    }
+    for (auto iVar = 0u; iVar < nVar; iVar++)
+      rhs(iPoint,iVar) = nodes->GetSolution(iPoint,iVar);
+  }
+  END_SU2_OMP_FOR
+
+  buildPreconditioner();
+
+  /*--- Solve A^T y = b. ---*/
+
+  const auto iter = direct_solver->System.Solve_b(Jacobian, rhs, sol, geometry, config, false);
+
+  /*--- Adjoint solution b + D y, restore the direct Jacobian and its preconditioner. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    for (auto iVar = 0u; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, rhs(iPoint,iVar) + delta[iPoint] * sol(iPoint,iVar));
+    if (delta[iPoint] != 0.0) Jacobian.AddVal2Diag(iPoint, delta[iPoint]);
+  }
+  END_SU2_OMP_FOR
+
+  buildPreconditioner();
+
+  SU2_OMP_MASTER {
+    SetIterLinSolver(iter);
+    SetResLinSolver(direct_solver->System.GetResidual());
+  }
+  END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+}
+
 void CDiscAdjSolver::ExtractAdjoint_Variables(CGeometry *geometry, CConfig *config) {
 
   SU2_OMP_MASTER {
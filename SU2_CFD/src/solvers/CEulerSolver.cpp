@@ -55,7 +55,6 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   const auto nZone = geometry->GetnZone();
   const bool restart = (config->GetRestart() || config->GetRestart_Flow());
   const bool rans = (config->GetKind_Turb_Model() != NONE);
-  const auto direct_diff = config->GetDirectDiff();
   const bool dual_time = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                          (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
   const bool time_stepping = (config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING);
@@ -234,26 +233,28 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
 
-  switch(direct_diff) {
-    case NO_DERIVATIVE:
-      /*--- Default ---*/
-      break;
-    case D_DENSITY:
-      SU2_TYPE::SetDerivative(Density_Inf, 1.0);
-      break;
-    case D_PRESSURE:
-      SU2_TYPE::SetDerivative(Pressure_Inf, 1.0);
-      break;
-    case D_TEMPERATURE:
-      SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-      break;
-    case D_MACH: case D_AOA:
-    case D_SIDESLIP: case D_REYNOLDS:
-    case D_TURB2LAM: case D_DESIGN:
-      /*--- Already done in postprocessing of config ---*/
-      break;
-    default:
-      break;
+  for (auto iDir = 0u; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case NO_DERIVATIVE:
+        /*--- Default ---*/
+        break;
+      case D_DENSITY:
+        SU2_TYPE::SetDerivative(Density_Inf, 1.0, iDir);
+        break;
+      case D_PRESSURE:
+        SU2_TYPE::SetDerivative(Pressure_Inf, 1.0, iDir);
+        break;
+      case D_TEMPERATURE:
+        SU2_TYPE::SetDerivative(Temperature_Inf, 1.0, iDir);
+        break;
+      case D_MACH: case D_AOA:
+      case D_SIDESLIP: case D_REYNOLDS:
+      case D_TURB2LAM: case D_DESIGN:
+        /*--- Already done in postprocessing of config ---*/
+        break;
+      default:
+        break;
+    }
   }
 
   SetReferenceValues(*config);
@@ -1567,20 +1568,28 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    /*--- Gradient and limiter computation in a single sweep. ---*/
 
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+    if (limiter && !van_albada && FusedGradientLimiter(config)) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
     }
+    else {
 
-    /*--- Limiter computation ---*/
+      /*--- Gradient computation for MUSCL reconstruction. ---*/
+
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+      /*--- Limiter computation ---*/
+
+      if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    }
   }
 }
 
@@ -8596,7 +8605,7 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
   unsigned short average_process = config->GetKind_AverageProcess();
   unsigned short performance_average_process = config->GetKind_PerformanceAverageProcess();
   su2double Pressure = 0.0, Density = 0.0, Enthalpy = 0.0,  *Velocity = nullptr, *TurboVelocity,
-      Area, TotalArea, Radius1, Radius2, Vt2, TotalAreaPressure, TotalAreaDensity, *TotalAreaVelocity, *UnitNormal, *TurboNormal,
+      Area, TotalArea, Radius1, Radius2, Vt2, TotalAreaPressure, TotalAreaDensity, *TotalAreaVelocity, *TurboNormal,
       TotalMassPressure, TotalMassDensity, *TotalMassVelocity;
   string Marker_Tag, Monitoring_Tag;
   su2double val_init_pressure;
@@ -8612,7 +8621,6 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
 
   /*-- Variables declaration and allocation ---*/
   Velocity            = new su2double[nDim];
-  UnitNormal          = new su2double[nDim];
   TurboNormal         = new su2double[nDim];
   TurboVelocity       = new su2double[nDim];
   TotalVelocity       = new su2double[nDim];
@@ -8632,191 +8640,88 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
 
   const auto nSpanWiseSections = config->GetnSpanWiseSections();
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
+  /*--- Span-wise sums of all the quantities, the last span holds the sums of the whole marker (1D values).
+   *    They are accumulated in one pass over the span-wise vertex bins and reduced in one communication. ---*/
 
-    /*--- Forces initialization for contenitors ---*/
-    for (iVar=0;iVar<nVar;iVar++)
-      TotalFluxes[iVar]= 0.0;
-    for (iDim=0; iDim<nDim; iDim++) {
-      TotalVelocity[iDim]     = 0.0;
-      TotalAreaVelocity[iDim] = 0.0;
-      TotalMassVelocity[iDim] = 0.0;
-    }
+  enum : unsigned short {DENSITY, PRESSURE, AREA_DENSITY, AREA_PRESSURE, MASS_DENSITY, MASS_PRESSURE,
+                         NU, KINE, OMEGA, AREA_NU, AREA_KINE, AREA_OMEGA, MASS_NU, MASS_KINE, MASS_OMEGA, VELOCITY};
+  const unsigned short AREA_VELOCITY = VELOCITY + nDim, MASS_VELOCITY = AREA_VELOCITY + nDim,
+                       FLUXES = MASS_VELOCITY + nDim, nSum = FLUXES + nVar;
 
-    TotalDensity      = 0.0;
-    TotalPressure     = 0.0;
-    TotalAreaPressure = 0.0;
-    TotalAreaDensity  = 0.0;
-    TotalMassPressure = 0.0;
-    TotalMassDensity  = 0.0;
-    TotalNu           = 0.0;
-    TotalOmega        = 0.0;
-    TotalKine         = 0.0;
-    TotalMassNu       = 0.0;
-    TotalMassOmega    = 0.0;
-    TotalMassKine     = 0.0;
-    TotalAreaNu       = 0.0;
-    TotalAreaOmega    = 0.0;
-    TotalAreaKine     = 0.0;
-
-    Nu    = 0.0;
-    Omega = 0.0;
-    Kine  = 0.0;
+  vector<su2double> localSums((nSpanWiseSections + 1) * nSum, 0.0), spanSums(localSums.size());
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+  Nu    = 0.0;
+  Omega = 0.0;
+  Kine  = 0.0;
 
-            /*--- Retrieve Old Solution ---*/
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
 
-            /*--- Loop over the vertices to sum all the quantities pithc-wise ---*/
-            if(iSpan < nSpanWiseSections){
-              for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
-                iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
+          /*--- Loop over the vertices to sum all the quantities pitch-wise ---*/
+          for (jSpan= 0; jSpan < nSpanWiseSections; jSpan++){
+            for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,jSpan); iVertex++) {
+              iPoint = geometry->turbovertex[iMarker][jSpan][iVertex]->GetNode();
 
-                /*--- Compute the integral fluxes for the boundaries ---*/
-                Pressure = nodes->GetPressure(iPoint);
-                Density  = nodes->GetDensity(iPoint);
-                Enthalpy = nodes->GetEnthalpy(iPoint);
+              Pressure = nodes->GetPressure(iPoint);
+              Density  = nodes->GetDensity(iPoint);
+              Enthalpy = nodes->GetEnthalpy(iPoint);
 
-                /*--- Normal vector for this vertex (negate for outward convention) ---*/
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetNormal(UnitNormal);
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
-                Area = geometry->turbovertex[iMarker][iSpan][iVertex]->GetArea();
-                su2double VelNormal = 0.0, VelSq = 0.0;
+              geometry->turbovertex[iMarker][jSpan][iVertex]->GetTurboNormal(TurboNormal);
+              Area = geometry->turbovertex[iMarker][jSpan][iVertex]->GetArea();
 
-                for (iDim = 0; iDim < nDim; iDim++) {
-                  Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-                  VelNormal += UnitNormal[iDim]*Velocity[iDim];
-                  VelSq += Velocity[iDim]*Velocity[iDim];
-                }
+              for (iDim = 0; iDim < nDim; iDim++)
+                Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
 
-                ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
+              ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
 
-                /*--- Compute different integral quantities for the boundary of interest ---*/
+              if(turbulent){
+                if(menter_sst){
+                  Kine  = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+                  Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
+                }
+                if(spalart_allmaras){
+                  Nu    = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+                }
+              }
 
-                TotalDensity          += Density;
-                TotalPressure         += Pressure;
+              /*--- The vertex contributes to its span and to the 1D values ---*/
+              for (auto sum : {&localSums[jSpan*nSum], &localSums[nSpanWiseSections*nSum]}) {
+
+                sum[DENSITY]          += Density;
+                sum[PRESSURE]         += Pressure;
                 for (iDim = 0; iDim < nDim; iDim++)
-                  TotalVelocity[iDim] += Velocity[iDim];
+                  sum[VELOCITY+iDim]  += Velocity[iDim];
 
-                TotalAreaPressure         += Area*Pressure;
-                TotalAreaDensity          += Area*Density;
+                sum[AREA_PRESSURE]    += Area*Pressure;
+                sum[AREA_DENSITY]     += Area*Density;
                 for (iDim = 0; iDim < nDim; iDim++)
-                  TotalAreaVelocity[iDim] += Area*Velocity[iDim];
+                  sum[AREA_VELOCITY+iDim] += Area*Velocity[iDim];
 
-                TotalMassPressure         += Area*(Density*TurboVelocity[0] )*Pressure;
-                TotalMassDensity          += Area*(Density*TurboVelocity[0] )*Density;
+                sum[MASS_PRESSURE]    += Area*(Density*TurboVelocity[0] )*Pressure;
+                sum[MASS_DENSITY]     += Area*(Density*TurboVelocity[0] )*Density;
                 for (iDim = 0; iDim < nDim; iDim++)
-                  TotalMassVelocity[iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
+                  sum[MASS_VELOCITY+iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
 
-                TotalFluxes[0]      += Area*(Density*TurboVelocity[0]);
-                TotalFluxes[1]      += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
+                sum[FLUXES]           += Area*(Density*TurboVelocity[0]);
+                sum[FLUXES+1]         += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
                 for (iDim = 2; iDim < nDim+1; iDim++)
-                  TotalFluxes[iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
-                TotalFluxes[nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
-
-
-                /*--- Compute turbulent integral quantities for the boundary of interest ---*/
+                  sum[FLUXES+iDim]    += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
+                sum[FLUXES+nDim+1]    += Area*(Density*TurboVelocity[0]*Enthalpy);
 
                 if(turbulent){
-                  if(menter_sst){
-                    Kine = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                    Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
-                  }
-                  if(spalart_allmaras){
-                    Nu = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                  }
-
-                  TotalKine   += Kine;
-                  TotalOmega  += Omega;
-                  TotalNu     += Nu;
-
-                  TotalAreaKine    += Area*Kine;
-                  TotalAreaOmega   += Area*Omega;
-                  TotalAreaNu      += Area*Nu;
-
-                  TotalMassKine    += Area*(Density*TurboVelocity[0] )*Kine;
-                  TotalMassOmega   += Area*(Density*TurboVelocity[0] )*Omega;
-                  TotalMassNu      += Area*(Density*TurboVelocity[0] )*Nu;
+                  sum[KINE]           += Kine;
+                  sum[OMEGA]          += Omega;
+                  sum[NU]             += Nu;
 
+                  sum[AREA_KINE]      += Area*Kine;
+                  sum[AREA_OMEGA]     += Area*Omega;
+                  sum[AREA_NU]        += Area*Nu;
 
-                }
-              }
-            }
-            else{
-              for (jSpan= 0; jSpan < nSpanWiseSections; jSpan++){
-                for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,jSpan); iVertex++) {
-                  iPoint = geometry->turbovertex[iMarker][jSpan][iVertex]->GetNode();
-
-                  /*--- Compute the integral fluxes for the boundaries ---*/
-                  Pressure = nodes->GetPressure(iPoint);
-                  Density  = nodes->GetDensity(iPoint);
-                  Enthalpy = nodes->GetEnthalpy(iPoint);
-
-                  /*--- Normal vector for this vertex (negate for outward convention) ---*/
-                  geometry->turbovertex[iMarker][jSpan][iVertex]->GetNormal(UnitNormal);
-                  geometry->turbovertex[iMarker][jSpan][iVertex]->GetTurboNormal(TurboNormal);
-                  Area = geometry->turbovertex[iMarker][jSpan][iVertex]->GetArea();
-                  su2double VelNormal = 0.0, VelSq = 0.0;
-
-                  for (iDim = 0; iDim < nDim; iDim++) {
-                    Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-                    VelNormal += UnitNormal[iDim]*Velocity[iDim];
-                    VelSq += Velocity[iDim]*Velocity[iDim];
-                  }
-
-                  ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
-
-                  /*--- Compute different integral quantities for the boundary of interest ---*/
-
-                  TotalDensity          += Density;
-                  TotalPressure         += Pressure;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalVelocity[iDim] += Velocity[iDim];
-
-                  TotalAreaPressure         += Area*Pressure;
-                  TotalAreaDensity          += Area*Density;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalAreaVelocity[iDim] += Area*Velocity[iDim];
-
-                  TotalMassPressure         += Area*(Density*TurboVelocity[0] )*Pressure;
-                  TotalMassDensity          += Area*(Density*TurboVelocity[0] )*Density;
-                  for (iDim = 0; iDim < nDim; iDim++)
-                    TotalMassVelocity[iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
-
-                  TotalFluxes[0]      += Area*(Density*TurboVelocity[0]);
-                  TotalFluxes[1]      += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
-                  for (iDim = 2; iDim < nDim+1; iDim++)
-                    TotalFluxes[iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
-                  TotalFluxes[nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
-
-
-                  /*--- Compute turbulent integral quantities for the boundary of interest ---*/
-
-                  if(turbulent){
-                    if(menter_sst){
-                      Kine  = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                      Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
-                    }
-                    if(spalart_allmaras){
-                      Nu    = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-                    }
-
-                    TotalKine   += Kine;
-                    TotalOmega  += Omega;
-                    TotalNu     += Nu;
-
-                    TotalAreaKine   += Area*Kine;
-                    TotalAreaOmega  += Area*Omega;
-                    TotalAreaNu     += Area*Nu;
-
-                    TotalMassKine    += Area*(Density*TurboVelocity[0] )*Kine;
-                    TotalMassOmega   += Area*(Density*TurboVelocity[0] )*Omega;
-                    TotalMassNu      += Area*(Density*TurboVelocity[0] )*Nu;
-
-                  }
+                  sum[MASS_KINE]      += Area*(Density*TurboVelocity[0] )*Kine;
+                  sum[MASS_OMEGA]     += Area*(Density*TurboVelocity[0] )*Omega;
+                  sum[MASS_NU]        += Area*(Density*TurboVelocity[0] )*Nu;
                 }
               }
             }
@@ -8824,50 +8729,40 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-
-    /*--- Add information using all the nodes ---*/
-
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-
-    TotalDensity = Allreduce(TotalDensity);
-    TotalPressure = Allreduce(TotalPressure);
-    TotalAreaDensity = Allreduce(TotalAreaDensity);
-    TotalAreaPressure = Allreduce(TotalAreaPressure);
-    TotalMassDensity = Allreduce(TotalMassDensity);
-    TotalMassPressure = Allreduce(TotalMassPressure);
-
-    TotalNu = Allreduce(TotalNu);
-    TotalKine = Allreduce(TotalKine);
-    TotalOmega = Allreduce(TotalOmega);
-    TotalAreaNu = Allreduce(TotalAreaNu);
-    TotalAreaKine = Allreduce(TotalAreaKine);
-    TotalAreaOmega = Allreduce(TotalAreaOmega);
-
-    TotalMassNu = Allreduce(TotalMassNu);
-    TotalMassKine = Allreduce(TotalMassKine);
-    TotalMassOmega = Allreduce(TotalMassOmega);
-
-    su2double* buffer = new su2double[max(nVar,nDim)];
+  /*--- Add information using all the nodes ---*/
 
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
+  SU2_MPI::Allreduce(localSums.data(), spanSums.data(), localSums.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
-    Allreduce_inplace(nVar, TotalFluxes);
-    Allreduce_inplace(nDim, TotalVelocity);
-    Allreduce_inplace(nDim, TotalAreaVelocity);
-    Allreduce_inplace(nDim, TotalMassVelocity);
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
-    delete [] buffer;
+    const su2double* sum = &spanSums[iSpan*nSum];
+
+    TotalDensity      = sum[DENSITY];
+    TotalPressure     = sum[PRESSURE];
+    TotalAreaDensity  = sum[AREA_DENSITY];
+    TotalAreaPressure = sum[AREA_PRESSURE];
+    TotalMassDensity  = sum[MASS_DENSITY];
+    TotalMassPressure = sum[MASS_PRESSURE];
+
+    TotalNu           = sum[NU];
+    TotalKine         = sum[KINE];
+    TotalOmega        = sum[OMEGA];
+    TotalAreaNu       = sum[AREA_NU];
+    TotalAreaKine     = sum[AREA_KINE];
+    TotalAreaOmega    = sum[AREA_OMEGA];
+    TotalMassNu       = sum[MASS_NU];
+    TotalMassKine     = sum[MASS_KINE];
+    TotalMassOmega    = sum[MASS_OMEGA];
 
-#endif
+    for (iVar=0;iVar<nVar;iVar++)
+      TotalFluxes[iVar] = sum[FLUXES+iVar];
+    for (iDim=0; iDim<nDim; iDim++) {
+      TotalVelocity[iDim]     = sum[VELOCITY+iDim];
+      TotalAreaVelocity[iDim] = sum[AREA_VELOCITY+iDim];
+      TotalMassVelocity[iDim] = sum[MASS_VELOCITY+iDim];
+    }
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
       for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
@@ -9168,7 +9063,6 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
 
   /*--- Free locally allocated memory ---*/
   delete [] Velocity;
-  delete [] UnitNormal;
   delete [] TurboNormal;
   delete [] TurboVelocity;
   delete [] TotalVelocity;
@@ -9239,184 +9133,97 @@ void CEulerSolver::MixedOut_Average (CConfig *config, su2double val_init_pressur
 
 void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry){
 
-  unsigned short iMarker, iMarkerTP;
-  unsigned short iSpan;
-  int markerTP;
-  su2double     densityIn, pressureIn, normalVelocityIn, tangVelocityIn, radialVelocityIn;
-  su2double     densityOut, pressureOut, normalVelocityOut, tangVelocityOut, radialVelocityOut;
-  su2double     kineIn, omegaIn, nuIn, kineOut, omegaOut, nuOut;
+  unsigned short iMarker, iMarkerTP, iSpan, iQuant;
   //TODO (turbo) implement interpolation so that Inflow and Outflow spanwise section can be different
 
   const auto nSpanWiseSections = config->GetnSpanWiseSections();
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+  /*--- The inflow and outflow performance quantities of all spans, and the turbomachinery marker,
+   *    are packed in one buffer that is gathered on the master node in one communication.
+   *    Layout: [marker, (inflow quantities, outflow quantities) of each span], -1 if not on this rank. ---*/
 
-#ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbPerfIn= NULL,*TurbPerfOut= NULL;
-    su2double *TotTurbPerfIn = NULL,*TotTurbPerfOut = NULL;
-    int *TotMarkerTP = NULL;
-
-    n1          = 8;
-    n2          = 8;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbPerfIn  = new su2double[n1];
-    TurbPerfOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbPerfIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbPerfOut[i]   = -1.0;
-#endif
+  constexpr unsigned short nQuant = 8;
+  const unsigned long bufSize = 1 + 2*nQuant*(nSpanWiseSections + 1);
 
-    densityIn            = -1.0;
-    pressureIn           = -1.0;
-    normalVelocityIn     = -1.0;
-    tangVelocityIn       = -1.0;
-    radialVelocityIn     = -1.0;
-    densityOut           = -1.0;
-    pressureOut          = -1.0;
-    normalVelocityOut    = -1.0;
-    tangVelocityOut      = -1.0;
-    radialVelocityOut    = -1.0;
-    kineIn               = -1.0;
-    omegaIn              = -1.0;
-    nuIn                 = -1.0;
-    kineOut              = -1.0;
-    omegaOut             = -1.0;
-    nuOut                = -1.0;
-
-    markerTP             = -1;
+  vector<su2double> sendBuf(bufSize, -1.0);
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
-            markerTP            = iMarkerTP;
-            densityIn           = DensityIn[iMarkerTP -1][iSpan];
-            pressureIn          = PressureIn[iMarkerTP -1][iSpan];
-            normalVelocityIn    = TurboVelocityIn[iMarkerTP -1][iSpan][0];
-            tangVelocityIn      = TurboVelocityIn[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityIn  = TurboVelocityIn[iMarkerTP -1][iSpan][2];
-            }
-            kineIn              = KineIn[iMarkerTP -1][iSpan];
-            omegaIn             = OmegaIn[iMarkerTP -1][iSpan];
-            nuIn                = NuIn[iMarkerTP -1][iSpan];
+  auto packSpan = [&](su2double* perf, su2double density, su2double pressure, const su2double* turboVelocity,
+                      su2double kine, su2double omega, su2double nu) {
+    perf[0] = density;
+    perf[1] = pressure;
+    perf[2] = turboVelocity[0];
+    perf[3] = turboVelocity[1];
+    if (nDim == 3) perf[4] = turboVelocity[2];
+    perf[5] = kine;
+    perf[6] = omega;
+    perf[7] = nu;
+  };
 
-#ifdef HAVE_MPI
-            TurbPerfIn[0]  = densityIn;
-            TurbPerfIn[1]  = pressureIn;
-            TurbPerfIn[2]  = normalVelocityIn;
-            TurbPerfIn[3]  = tangVelocityIn;
-            TurbPerfIn[4]  = radialVelocityIn;
-            TurbPerfIn[5]  = kineIn;
-            TurbPerfIn[6]  = omegaIn;
-            TurbPerfIn[7]  = nuIn;
-#endif
-          }
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        const auto m = iMarkerTP - 1;
 
-          /*--- retrieve outlet information ---*/
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
-            densityOut           = DensityOut[iMarkerTP -1][iSpan];
-            pressureOut          = PressureOut[iMarkerTP -1][iSpan];
-            normalVelocityOut    = TurboVelocityOut[iMarkerTP -1][iSpan][0];
-            tangVelocityOut      = TurboVelocityOut[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityOut  = TurboVelocityOut[iMarkerTP -1][iSpan][2];
-            }
-            kineOut              = KineOut[iMarkerTP -1][iSpan];
-            omegaOut             = OmegaOut[iMarkerTP -1][iSpan];
-            nuOut                = NuOut[iMarkerTP -1][iSpan];
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
+          sendBuf[0] = iMarkerTP;
+          for (iSpan = 0; iSpan < nSpanWiseSections + 1; iSpan++)
+            packSpan(&sendBuf[1 + 2*iSpan*nQuant], DensityIn[m][iSpan], PressureIn[m][iSpan],
+                     TurboVelocityIn[m][iSpan], KineIn[m][iSpan], OmegaIn[m][iSpan], NuIn[m][iSpan]);
+        }
 
-#ifdef HAVE_MPI
-            TurbPerfOut[0]  = densityOut;
-            TurbPerfOut[1]  = pressureOut;
-            TurbPerfOut[2]  = normalVelocityOut;
-            TurbPerfOut[3]  = tangVelocityOut;
-            TurbPerfOut[4]  = radialVelocityOut;
-            TurbPerfOut[5]  = kineOut;
-            TurbPerfOut[6]  = omegaOut;
-            TurbPerfOut[7]  = nuOut;
-#endif
-          }
+        /*--- retrieve outlet information ---*/
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
+          for (iSpan = 0; iSpan < nSpanWiseSections + 1; iSpan++)
+            packSpan(&sendBuf[1 + (2*iSpan+1)*nQuant], DensityOut[m][iSpan], PressureOut[m][iSpan],
+                     TurboVelocityOut[m][iSpan], KineOut[m][iSpan], OmegaOut[m][iSpan], NuOut[m][iSpan]);
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-    if (rank == MASTER_NODE){
-      TotTurbPerfIn       = new su2double[n1t];
-      TotTurbPerfOut      = new su2double[n2t];
-      for (i=0;i<n1t;i++)
-        TotTurbPerfIn[i]  = -1.0;
-      for (i=0;i<n2t;i++)
-        TotTurbPerfOut[i] = -1.0;
-      TotMarkerTP = new int[size];
-      for(i=0; i<size; i++){
-        TotMarkerTP[i]    = -1;
-      }
-    }
-    SU2_MPI::Gather(TurbPerfIn, n1, MPI_DOUBLE, TotTurbPerfIn, n1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Gather(TurbPerfOut, n2, MPI_DOUBLE,TotTurbPerfOut, n2, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Gather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
-    if (rank == MASTER_NODE){
-      delete [] TurbPerfIn, delete [] TurbPerfOut;
-    }
+  vector<su2double> recvBuf((rank == MASTER_NODE)? size*bufSize : 0);
 
-    if (rank == MASTER_NODE){
-      for (i=0;i<size;i++){
-        if(TotTurbPerfIn[n1*i] > 0.0){
-          densityIn        = TotTurbPerfIn[n1*i];
-          pressureIn       = TotTurbPerfIn[n1*i+1];
-          normalVelocityIn = TotTurbPerfIn[n1*i+2];
-          tangVelocityIn   = TotTurbPerfIn[n1*i+3];
-          radialVelocityIn = TotTurbPerfIn[n1*i+4];
-          kineIn           = TotTurbPerfIn[n1*i+5];
-          omegaIn          = TotTurbPerfIn[n1*i+6];
-          nuIn             = TotTurbPerfIn[n1*i+7];
-          markerTP         = TotMarkerTP[i];
-        }
+  SU2_MPI::Gather(sendBuf.data(), bufSize, MPI_DOUBLE, recvBuf.data(), bufSize, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
 
-        if(TotTurbPerfOut[n2*i] > 0.0){
-          densityOut        = TotTurbPerfOut[n1*i];
-          pressureOut       = TotTurbPerfOut[n1*i+1];
-          normalVelocityOut = TotTurbPerfOut[n1*i+2];
-          tangVelocityOut   = TotTurbPerfOut[n1*i+3];
-          radialVelocityOut = TotTurbPerfOut[n1*i+4];
-          kineOut           = TotTurbPerfOut[n1*i+5];
-          omegaOut          = TotTurbPerfOut[n1*i+6];
-          nuOut             = TotTurbPerfOut[n1*i+7];
-        }
-      }
+  if (rank != MASTER_NODE) return;
 
-      delete [] TotTurbPerfIn, delete [] TotTurbPerfOut; delete [] TotMarkerTP;
+  for (iSpan = 0; iSpan < nSpanWiseSections + 1; iSpan++) {
+
+    /*--- Any rank that has the markers holds the (global) averages. ---*/
+
+    int markerTP = -1;
+    const su2double *perfIn = &sendBuf[1], *perfOut = &sendBuf[1];
+
+    for (int i = 0; i < size; i++) {
+      const su2double* buf = &recvBuf[i*bufSize];
+      if (buf[1 + 2*iSpan*nQuant] > 0.0) {
+        perfIn = &buf[1 + 2*iSpan*nQuant];
+        markerTP = SU2_TYPE::Int(buf[0]);
+      }
+      if (buf[1 + (2*iSpan+1)*nQuant] > 0.0) {
+        perfOut = &buf[1 + (2*iSpan+1)*nQuant];
+      }
     }
 
-#endif
+    if (markerTP > -1){
+      const auto m = markerTP - 1;
 
-    if (rank == MASTER_NODE && markerTP > -1){
       /*----Quantities needed for computing the turbomachinery performance -----*/
-      DensityIn[markerTP -1][iSpan]              = densityIn;
-      PressureIn[markerTP -1][iSpan]             = pressureIn;
-      TurboVelocityIn[markerTP -1][iSpan][0]     = normalVelocityIn;
-      TurboVelocityIn[markerTP -1][iSpan][1]     = tangVelocityIn;
-      if (nDim == 3)
-        TurboVelocityIn[markerTP -1][iSpan][2]   = radialVelocityIn;
-      KineIn[markerTP -1][iSpan]                 = kineIn;
-      OmegaIn[markerTP -1][iSpan]                = omegaIn;
-      NuIn[markerTP -1][iSpan]                   = nuIn;
-
-      DensityOut[markerTP -1][iSpan]             = densityOut;
-      PressureOut[markerTP -1][iSpan]            = pressureOut;
-      TurboVelocityOut[markerTP -1][iSpan][0]    = normalVelocityOut;
-      TurboVelocityOut[markerTP -1][iSpan][1]    = tangVelocityOut;
-      if (nDim == 3)
-        TurboVelocityOut[markerTP -1][iSpan][2]  = radialVelocityOut;
-      KineOut[markerTP -1][iSpan]                = kineOut;
-      OmegaOut[markerTP -1][iSpan]               = omegaOut;
-      NuOut[markerTP -1][iSpan]                  = nuOut;
+      DensityIn[m][iSpan]   = perfIn[0];
+      PressureIn[m][iSpan]  = perfIn[1];
+      for (iQuant = 0; iQuant < nDim; iQuant++)
+        TurboVelocityIn[m][iSpan][iQuant] = perfIn[2 + iQuant];
+      KineIn[m][iSpan]      = perfIn[5];
+      OmegaIn[m][iSpan]     = perfIn[6];
+      NuIn[m][iSpan]        = perfIn[7];
+
+      DensityOut[m][iSpan]  = perfOut[0];
+      PressureOut[m][iSpan] = perfOut[1];
+      for (iQuant = 0; iQuant < nDim; iQuant++)
+        TurboVelocityOut[m][iSpan][iQuant] = perfOut[2 + iQuant];
+      KineOut[m][iSpan]     = perfOut[5];
+      OmegaOut[m][iSpan]    = perfOut[6];
+      NuOut[m][iSpan]       = perfOut[7];
     }
   }
 }
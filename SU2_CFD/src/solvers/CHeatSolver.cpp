@@ -853,6 +853,7 @@ void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solv
   su2double thermal_diffusivity, T_Conjugate, Tinterface, Tnormal_Conjugate, HeatFluxDensity, HeatFlux, Area;
 
   const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit_heat = (config->GetKind_TimeIntScheme_Heat() == EULER_IMPLICIT);
 
   const su2double Temperature_Ref = config->GetTemperature_Ref();
   const su2double rho_cp_solid = config->GetMaterialDensity(0)*config->GetSpecific_Heat_Cp();
@@ -900,7 +901,9 @@ void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solv
           HeatFluxDensity   = thermal_diffusivity*(Tinterface - Tnormal_Conjugate);
           HeatFlux          = HeatFluxDensity * Area;
 
-          if (implicit) {
+          /*--- The solid uses its own time scheme, without pseudo time stepping this term closes the system. ---*/
+
+          if (implicit_heat) {
 
             Jacobian_i[0][0] = -thermal_diffusivity*Area;
             Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
@@ -1290,6 +1293,12 @@ void CHeatSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
 
   SetResToZero();
 
+  /*--- With CHT_SOLID_NO_PSEUDO_TIME the solid conduction is solved without pseudo time stepping. The system is
+   *    closed by the linearized heat flux of the fluid, included in the matrix by BC_ConjugateHeat_Interface
+   *    (CConfig requires Robin coupling and a CHT interface), the fluid temperature is lagged. ---*/
+
+  const bool pseudo_time = !(heat_equation && config->GetCHT_SolidNoPseudoTime());
+
   /*--- Build implicit system ---*/
 
   for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
@@ -1303,8 +1312,10 @@ void CHeatSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
 
       // Identical for flow and heat
-      const su2double Delta = geometry->nodes->GetVolume(iPoint) / nodes->GetDelta_Time(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Delta);
+      if (pseudo_time) {
+        const su2double Delta = geometry->nodes->GetVolume(iPoint) / nodes->GetDelta_Time(iPoint);
+        Jacobian.AddVal2Diag(iPoint, Delta);
+      }
 
     } else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
@@ -170,26 +170,28 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
 
-  switch (config->GetDirectDiff()) {
-    case NO_DERIVATIVE:
-      /*--- Default ---*/
-      break;
-    case D_DENSITY:
-      SU2_TYPE::SetDerivative(Density_Inf, 1.0);
-      break;
-    case D_PRESSURE:
-      SU2_TYPE::SetDerivative(Pressure_Inf, 1.0);
-      break;
-    case D_TEMPERATURE:
-      SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-      break;
-    case D_MACH: case D_AOA:
-    case D_SIDESLIP: case D_REYNOLDS:
-    case D_TURB2LAM: case D_DESIGN:
-      /*--- Already done in postprocessing of config ---*/
-      break;
-    default:
-      break;
+  for (auto iDir = 0u; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case NO_DERIVATIVE:
+        /*--- Default ---*/
+        break;
+      case D_DENSITY:
+        SU2_TYPE::SetDerivative(Density_Inf, 1.0, iDir);
+        break;
+      case D_PRESSURE:
+        SU2_TYPE::SetDerivative(Pressure_Inf, 1.0, iDir);
+        break;
+      case D_TEMPERATURE:
+        SU2_TYPE::SetDerivative(Temperature_Inf, 1.0, iDir);
+        break;
+      case D_MACH: case D_AOA:
+      case D_SIDESLIP: case D_REYNOLDS:
+      case D_TURB2LAM: case D_DESIGN:
+        /*--- Already done in postprocessing of config ---*/
+        break;
+      default:
+        break;
+    }
   }
 
   SetReferenceValues(*config);
@@ -917,20 +919,28 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    /*--- Gradient and limiter computation in a single sweep. ---*/
 
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+    if (limiter && !van_albada && FusedGradientLimiter(config)) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
     }
+    else {
+
+      /*--- Gradient computation for MUSCL reconstruction. ---*/
 
-    /*--- Limiter computation ---*/
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+      /*--- Limiter computation ---*/
+
+      if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    }
   }
 }
 
@@ -45,12 +45,14 @@ CIncNSSolver::CIncNSSolver(CGeometry *geometry, CConfig *config, unsigned short
 
   /*--- Initialize the secondary values for direct derivative approximations ---*/
 
-  switch (config->GetDirectDiff()) {
-    case D_VISCOSITY:
-      SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0);
-      break;
-    default:
-      break;
+  for (auto iDir = 0u; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case D_VISCOSITY:
+        SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0, iDir);
+        break;
+      default:
+        break;
+    }
   }
 }
 
@@ -70,20 +72,33 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute gradient for MUSCL reconstruction ---*/
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+  /*--- The limiter may be computed together with the gradient that it uses. ---*/
+
+  const bool fusedLimiter = muscl && !center && limiter && !van_albada && !Output && FusedGradientLimiter(config);
+  const bool reconRequired = config->GetReconstructionGradientRequired();
+
+  if (reconRequired && muscl && !center) {
+    if (fusedLimiter) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
+    }
+    else {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
     }
   }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+  if (fusedLimiter && !reconRequired) {
+    SetPrimitive_Gradient_Limiter(geometry, config, false);
+  }
+  else if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
     SetPrimitive_Gradient_GG(geometry, config);
   }
   else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
@@ -92,7 +107,7 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (muscl && !center && limiter && !van_albada && !Output && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
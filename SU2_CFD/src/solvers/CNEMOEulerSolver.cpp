@@ -50,7 +50,6 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
   unsigned short nZone = geometry->GetnZone();
   su2double *Mvec_Inf, Alpha, Beta;
   bool restart   = (config->GetRestart() || config->GetRestart_Flow());
-  unsigned short direct_diff = config->GetDirectDiff();
   int Unst_RestartIter = 0;
   bool dual_time = ((config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                     (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND));
@@ -150,26 +149,28 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
   Temperature_ve_Inf  = config->GetTemperature_ve_FreeStreamND();
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
-  switch(direct_diff) {
-  case NO_DERIVATIVE:
-    /*--- Default ---*/
-    break;
-  case D_DENSITY:
-    SU2_TYPE::SetDerivative(Density_Inf, 1.0);
-    break;
-  case D_PRESSURE:
-    SU2_TYPE::SetDerivative(Pressure_Inf, 1.0);
-    break;
-  case D_TEMPERATURE:
-    SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-    break;
-  case D_MACH: case D_AOA:
-  case D_SIDESLIP: case D_REYNOLDS:
-  case D_TURB2LAM: case D_DESIGN:
-    /*--- Already done in postprocessing of config ---*/
-    break;
-  default:
-    break;
+  for (auto iDir = 0u; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+    case NO_DERIVATIVE:
+      /*--- Default ---*/
+      break;
+    case D_DENSITY:
+      SU2_TYPE::SetDerivative(Density_Inf, 1.0, iDir);
+      break;
+    case D_PRESSURE:
+      SU2_TYPE::SetDerivative(Pressure_Inf, 1.0, iDir);
+      break;
+    case D_TEMPERATURE:
+      SU2_TYPE::SetDerivative(Temperature_Inf, 1.0, iDir);
+      break;
+    case D_MACH: case D_AOA:
+    case D_SIDESLIP: case D_REYNOLDS:
+    case D_TURB2LAM: case D_DESIGN:
+      /*--- Already done in postprocessing of config ---*/
+      break;
+    default:
+      break;
+    }
   }
 
   SetReferenceValues(*config);
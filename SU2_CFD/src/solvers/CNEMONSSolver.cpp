@@ -43,13 +43,15 @@ CNEMONSSolver::CNEMONSSolver(CGeometry *geometry, CConfig *config, unsigned shor
   Prandtl_Turb       = config->GetPrandtl_Turb();
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
-  switch(config->GetDirectDiff()) {
-    case D_VISCOSITY:
-      SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0);
-      break;
-    default:
-      /*--- Already done upstream. ---*/
-      break;
+  for (auto iDir = 0u; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case D_VISCOSITY:
+        SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0, iDir);
+        break;
+      default:
+        /*--- Already done upstream. ---*/
+        break;
+    }
   }
 
 }
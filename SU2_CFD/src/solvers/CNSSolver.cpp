@@ -57,13 +57,15 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
 
   /*--- Initialize the seed values for forward mode differentiation. ---*/
 
-  switch(config->GetDirectDiff()) {
-    case D_VISCOSITY:
-      SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0);
-      break;
-    default:
-      /*--- Already done upstream. ---*/
-      break;
+  for (auto iDir = 0u; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case D_VISCOSITY:
+        SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0, iDir);
+        break;
+      default:
+        /*--- Already done upstream. ---*/
+        break;
+    }
   }
 
 }
@@ -88,20 +90,33 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   const auto nPrimVarGrad_bak = nPrimVarGrad;
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, 1+nDim);
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+  /*--- The limiter may be computed together with the gradient that it uses. ---*/
+
+  const bool fusedLimiter = muscl && !center && limiter && !van_albada && !Output && FusedGradientLimiter(config);
+  const bool reconRequired = config->GetReconstructionGradientRequired();
+
+  if (reconRequired && muscl && !center) {
+    if (fusedLimiter) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
+    }
+    else {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
     }
   }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+  if (fusedLimiter && !reconRequired) {
+    SetPrimitive_Gradient_Limiter(geometry, config, false);
+  }
+  else if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
     SetPrimitive_Gradient_GG(geometry, config);
   }
   else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
@@ -112,7 +127,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (muscl && !center && limiter && !van_albada && !Output && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -36,7 +36,6 @@ CRadP1Solver::CRadP1Solver(void) : CRadSolver() {
 CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(geometry, config) {
 
   unsigned short iVar;
-  unsigned short direct_diff = config->GetDirectDiff();
   bool multizone = config->GetMultizone_Problem();
 
   nDim =          geometry->GetnDim();
@@ -86,19 +85,21 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
 
-  switch(direct_diff){
-    case NO_DERIVATIVE: case D_DENSITY:
-    case D_PRESSURE: case D_VISCOSITY:
-    case D_MACH: case D_AOA:
-    case D_SIDESLIP: case D_REYNOLDS:
-    case D_TURB2LAM: case D_DESIGN:
-      /*--- Not necessary here ---*/
-      break;
-    case D_TEMPERATURE:
-      SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-      break;
-    default:
-      break;
+  for (auto iDir = 0u; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case NO_DERIVATIVE: case D_DENSITY:
+      case D_PRESSURE: case D_VISCOSITY:
+      case D_MACH: case D_AOA:
+      case D_SIDESLIP: case D_REYNOLDS:
+      case D_TURB2LAM: case D_DESIGN:
+        /*--- Not necessary here ---*/
+        break;
+      case D_TEMPERATURE:
+        SU2_TYPE::SetDerivative(Temperature_Inf, 1.0, iDir);
+        break;
+      default:
+        break;
+    }
   }
 
   SetTemperature_Inf(Temperature_Inf);
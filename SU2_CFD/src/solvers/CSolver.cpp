@@ -1882,7 +1882,7 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
       CFL *= CFLFactor;
       solverFlow->GetNodes()->SetLocalCFL(iPoint, CFL);
-      if ((iMesh == MESH_0) && solverTurb) {
+      if ((iMesh == MESH_0 || config->GetMG_Turb()) && solverTurb) {
         solverTurb->GetNodes()->SetLocalCFL(iPoint, CFL);
       }
 
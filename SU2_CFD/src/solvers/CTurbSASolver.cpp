@@ -60,9 +60,9 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
 
   nDim = geometry->GetnDim();
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or multigrid if the turbulence equations are solved on the coarse levels. ---*/
 
-  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
+  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_Turb()) {
 
     /*--- Define some auxiliar vector related with the residual ---*/
 
@@ -192,7 +192,7 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
         unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0);
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
   const auto kind_hybridRANSLES = config->GetKind_HybridRANSLES();
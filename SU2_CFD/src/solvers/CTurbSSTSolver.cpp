@@ -62,9 +62,9 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
   nDim = geometry->GetnDim();
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or multigrid if the turbulence equations are solved on the coarse levels. ---*/
 
-  if (iMesh == MESH_0) {
+  if (iMesh == MESH_0 || config->GetMG_Turb()) {
 
     /*--- Define some auxiliary vector related with the residual ---*/
 
@@ -197,7 +197,7 @@ void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contain
          unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0);
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
 
@@ -66,6 +66,10 @@ CTurbSolver::CTurbSolver(CGeometry* geometry, CConfig *config) : CSolver() {
       EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
   }
 
+#ifdef HAVE_OPDI
+  if (config->GetDiscrete_Adjoint()) geometry->GetPointColoring();
+#endif
+
   nPoint = geometry->GetnPoint();
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
 #else
@@ -87,7 +91,7 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
                                   CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0);
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
 
   /*--- Only reconstruct flow variables if MUSCL is on for flow (requires upwind) and turbulence. ---*/
@@ -561,6 +565,7 @@ void CTurbSolver::Impose_Fixed_Values(const CGeometry *geometry, const CConfig *
 void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver** solver_container, CConfig *config) {
 
   const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
+  const bool multigrid = config->GetMG_Turb();
 
   /*--- Set shared residual variables to 0 and declare
    *    local ones for current thread to work on. ---*/
@@ -589,13 +594,16 @@ void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver** solver
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
       LinSysRes.SetBlock_Zero(iPoint);
+      if (multigrid) nodes->SetRes_TruncErrorZero(iPoint);
     }
 
-    /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
+    /*--- Right hand side of the system (-Residual) and initial guess (x = 0),
+     *    including the multigrid forcing term when the FAS cycle is used. ---*/
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       unsigned long total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = -LinSysRes[total_index];
+      const su2double truncError = multigrid? nodes->GetResTruncError(iPoint)[iVar] : su2double(0.0);
+      LinSysRes[total_index] = -(LinSysRes[total_index] + truncError);
       LinSysSol[total_index] = 0.0;
 
       su2double Res = fabs(LinSysRes[total_index]);
@@ -434,18 +434,45 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
   unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
   unsigned long iVertex, iPoint;
-  su2double delta_eps, my_Gradient, localGradient, *Normal, dS, *VarCoord, Sensitivity,
-  dalpha[3], deps[3], dalpha_deps;
-  bool *UpdatePoint, MoveSurface, Local_MoveSurface;
+  su2double delta_eps, *Normal, dS, Sensitivity;
+  bool MoveSurface, Local_MoveSurface;
   CFreeFormDefBox **FFDBox;
 
   int rank = SU2_MPI::GetRank();
 
   nDV = config->GetnDV();
+  const auto nDim = geometry->GetnDim();
 
-  /*--- Boolean controlling points to be updated ---*/
+  /*--- The projection is the same linear function of the surface displacements for all design
+   *    variables, the (unique, domain) vertices of the DV markers and their weights, i.e. the
+   *    sensitivity times the inward unit normal, are gathered once. ---*/
 
-  UpdatePoint = new bool[geometry->GetnPoint()];
+  vector<CVertex*> surfVertex;
+  vector<su2double> surfWeight;
+  vector<bool> visited(geometry->GetnPoint(), false);
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) != YES) continue;
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if ((iPoint >= geometry->GetnPointDomain()) || visited[iPoint]) continue;
+      visited[iPoint] = true;
+
+      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
+
+      dS = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) dS += Normal[iDim]*Normal[iDim];
+      dS = sqrt(dS);
+
+      surfVertex.push_back(geometry->vertex[iMarker][iVertex]);
+      for (iDim = 0; iDim < nDim; iDim++) surfWeight.push_back(-Sensitivity*Normal[iDim]/dS);
+    }
+  }
+
+  /*--- Local contributions of each variable, reduced over all ranks in one operation at the end. ---*/
+
+  vector<su2double> localGradient(nDV, 0.0), totalGradient(nDV, 0.0);
 
   /*--- Definition of the FFD deformation class ---*/
 
@@ -624,49 +651,38 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 
       /*--- If the Angle of attack is not involved, reset the value of the gradient ---*/
 
-      my_Gradient = 0.0; Gradient[iDV][0] = 0.0;
+      Gradient[iDV][0] = 0.0;
 
       if (MoveSurface) {
 
         delta_eps = config->GetDV_Value(iDV);
 
-        for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-          UpdatePoint[iPoint] = true;
-
-        for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-          if (config->GetMarker_All_DV(iMarker) == YES) {
-            for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-
-              iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-              if ((iPoint < geometry->GetnPointDomain()) && UpdatePoint[iPoint]) {
-
-                Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-                VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-                Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
-
-                dS = 0.0;
-                for (iDim = 0; iDim < geometry->GetnDim(); iDim++) {
-                  dS += Normal[iDim]*Normal[iDim];
-                  deps[iDim] = VarCoord[iDim] / delta_eps;
-                }
-                dS = sqrt(dS);
-
-                dalpha_deps = 0.0;
-                for (iDim = 0; iDim < geometry->GetnDim(); iDim++) {
-                  dalpha[iDim] = Normal[iDim] / dS;
-                  dalpha_deps -= dalpha[iDim]*deps[iDim];
-                }
-
-                my_Gradient += Sensitivity*dalpha_deps;
-                UpdatePoint[iPoint] = false;
-              }
-            }
+        su2double my_Gradient = 0.0;
+        SU2_OMP_PARALLEL
+        {
+          su2double threadGradient = 0.0;
+          SU2_OMP_FOR_STAT(1024)
+          for (auto iSurf = 0ul; iSurf < surfVertex.size(); iSurf++) {
+            const auto VarCoord = surfVertex[iSurf]->GetVarCoord();
+            for (auto iDim = 0u; iDim < nDim; iDim++)
+              threadGradient += surfWeight[iSurf*nDim+iDim] * VarCoord[iDim];
           }
+          END_SU2_OMP_FOR
+          atomicAdd(threadGradient, my_Gradient);
         }
+        END_SU2_OMP_PARALLEL
+
+        localGradient[iDV] = my_Gradient / delta_eps;
       }
+    }
+  }
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      Gradient[iDV][0] += localGradient;
+  SU2_MPI::Allreduce(localGradient.data(), totalGradient.data(), nDV, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if ((config->GetDesign_Variable(iDV) != ANGLE_OF_ATTACK) &&
+        (config->GetDesign_Variable(iDV) != FFD_ANGLE_OF_ATTACK)) {
+      Gradient[iDV][0] += totalGradient[iDV];
     }
   }
 
@@ -681,16 +697,14 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
     delete [] FFDBox;
   }
 
-  delete [] UpdatePoint;
-
 }
 
 
 void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double** Gradient){
 
-  su2double *VarCoord = nullptr, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
+  su2double *VarCoord = nullptr, Sensitivity, *Normal, Area = 0.0;
   unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV;
-  unsigned long iVertex, nVertex, iPoint;
+  unsigned long iVertex, nVertex, iPoint, iGrad;
 
   const int rank = SU2_MPI::GetRank();
 
@@ -766,17 +780,25 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
     }
   }
 
-  /*--- Compute derivatives and extract gradient ---*/
+  /*--- Compute derivatives and extract gradient, the local contributions
+   *    of all variables are reduced over the ranks in one operation. ---*/
 
   AD::ComputeAdjoint();
 
-  for (iDV = 0; iDV  < nDV; iDV++){
+  vector<su2double> myGradient, totalGradient;
 
+  for (iDV = 0; iDV  < nDV; iDV++){
     for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++){
+      myGradient.push_back(SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value)));
+    }
+  }
+  totalGradient.resize(myGradient.size());
+
+  SU2_MPI::Allreduce(myGradient.data(), totalGradient.data(), myGradient.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
-      my_Gradient = SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value));
+  for (iDV = 0, iGrad = 0; iDV  < nDV; iDV++){
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++, iGrad++){
 
       /*--- Angle of Attack design variable (this is different,
        the value comes form the input file) ---*/
@@ -786,7 +808,7 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
         Gradient[iDV][iDV_Value] = config->GetAoA_Sens();
       }
 
-      Gradient[iDV][iDV_Value] += localGradient;
+      Gradient[iDV][iDV_Value] += totalGradient[iGrad];
     }
   }
 
@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+
+## \file check_jacobian_guess.py
+#  \brief Checks that the transposed Jacobian warm start (DISCADJ_JACOBIAN_GUESS)
+#         reduces the number of iterations of a steady discrete adjoint.
+#  \version 7.2.0 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import sys, csv, subprocess
+from optparse import OptionParser
+
+# Orders of magnitude the adjoint residual has to drop (w.r.t. the first iteration without guess).
+ORDERS = 4.0
+PRIMAL_ITER = 2000
+ADJOINT_ITER = 100
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+  (options, args) = parser.parse_args()
+
+  # Converged primal solution, shared by both adjoint runs
+  run(options.filename, "direct", {"MATH_PROBLEM": "DIRECT", "ITER": PRIMAL_ITER,
+                                   "CONV_RESIDUAL_MINVAL": -12, "CONV_FILENAME": "history_direct",
+                                   "SCREEN_OUTPUT": "(INNER_ITER, RMS_DENSITY, DRAG)",
+                                   "HISTORY_OUTPUT": "(ITER, RMS_RES, AERO_COEFF)"})
+
+  history = {}
+  for guess in ["NO", "YES"]:
+    name = "adjoint_guess_" + guess.lower()
+    run(options.filename, name, {"DISCADJ_JACOBIAN_GUESS": guess, "ITER": ADJOINT_ITER,
+                                 "SOLUTION_FILENAME": "restart_flow.dat", "CONV_FILENAME": "history_" + name})
+    history[guess] = read_residual("history_" + name + ".csv")
+
+  target = history["NO"][0] - ORDERS
+  iters = {guess : iterations_to(history[guess], target) for guess in history}
+
+  print("Adjoint iterations to reach rms[A_Rho] < %f: %s (no guess), %s (Jacobian guess)" %
+        (target, iters["NO"], iters["YES"]))
+
+  if iters["YES"] is None or (iters["NO"] is not None and iters["YES"] >= iters["NO"]):
+    print("The Jacobian guess did not reduce the number of adjoint iterations.")
+    sys.exit(1)
+
+def run(filename, name, options):
+  """ Writes a copy of the config file with modified options and runs SU2_CFD_AD with it. """
+
+  cfg = name + ".cfg"
+  with open(filename) as src, open(cfg, "w") as dst:
+    for line in src:
+      key = line.split("=")[0].strip()
+      if key in options: line = "%s= %s\n" % (key, options.pop(key))
+      dst.write(line)
+    for key in options: dst.write("%s= %s\n" % (key, options[key]))
+
+  with open(name + ".log", "w") as log:
+    if subprocess.call(["SU2_CFD_AD", cfg], stdout=log, stderr=subprocess.STDOUT) != 0:
+      print("SU2_CFD_AD failed for %s, see %s.log" % (cfg, name))
+      sys.exit(1)
+
+def read_residual(filename):
+  """ Returns the rms[A_Rho] column of a CSV history file. """
+
+  with open(filename) as f:
+    rows = list(csv.reader(f))
+  header = [h.strip().strip('"') for h in rows[0]]
+  col = header.index("rms[A_Rho]")
+  return [float(row[col]) for row in rows[1:]]
+
+def iterations_to(residual, target):
+  """ First iteration at which the residual is below the target, None if it is never reached. """
+
+  for i, res in enumerate(residual):
+    if res < target: return i
+  return None
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
@@ -844,6 +844,18 @@ def main():
     hb_rans_preconditioning.new_output = False
     test_list.append(hb_rans_preconditioning)
 
+    # Pitching flat plate (generated mesh), the time instances are solved by two groups of one rank (same values as in serial)
+    hb_rans_instance_groups           = TestCase('hb_rans_instance_groups')
+    hb_rans_instance_groups.cfg_dir   = "harmonic_balance/hb_rans_instance_groups"
+    hb_rans_instance_groups.cfg_file  = "flatplate_instance_groups.cfg"
+    hb_rans_instance_groups.test_iter = 25
+    hb_rans_instance_groups.test_vals = [-2.911179, -4.261495, 0.061605, 0.000050]
+    hb_rans_instance_groups.su2_exec  = "mpirun -n 2 SU2_CFD"
+    hb_rans_instance_groups.timeout   = 1600
+    hb_rans_instance_groups.tol       = 0.00001
+    hb_rans_instance_groups.new_output = False
+    test_list.append(hb_rans_instance_groups)
+
     ######################################
     ### Moving Wall                    ###
     ######################################
@@ -945,6 +957,18 @@ def main():
     unst_inc_turb_naca0015_sa.unsteady  = True
     test_list.append(unst_inc_turb_naca0015_sa)
 
+    # Laminar flat plate, two time slices solved concurrently (parareal), same values as the sequential time integration
+    unst_parareal_flatplate           = TestCase('unst_parareal_flatplate')
+    unst_parareal_flatplate.cfg_dir   = "unsteady/parareal_flatplate"
+    unst_parareal_flatplate.cfg_file  = "lam_flatplate_parareal.cfg"
+    unst_parareal_flatplate.test_iter = 9
+    unst_parareal_flatplate.test_vals = [-6.214229, -1.529372, 0.013356, 0.104991]
+    unst_parareal_flatplate.su2_exec  = "mpirun -n 2 SU2_CFD"
+    unst_parareal_flatplate.timeout   = 1600
+    unst_parareal_flatplate.tol       = 0.00001
+    unst_parareal_flatplate.unsteady  = True
+    test_list.append(unst_parareal_flatplate)
+
     # Flat plate
     flatplate_unsteady           = TestCase('flatplate_unsteady')
     flatplate_unsteady.cfg_dir   = "navierstokes/flatplate"
@@ -1286,6 +1310,18 @@ def main():
     cht_compressible.tol       = 0.00001
     test_list.append(cht_compressible)
 
+    # CHT with the zones solved concurrently, one rank per zone (same values as BLOCK_JACOBI in serial)
+    cht_concurrent_zones           = TestCase('cht_concurrent_zones')
+    cht_concurrent_zones.cfg_dir   = "coupled_cht/solid_no_pseudo_time_2d"
+    cht_concurrent_zones.cfg_file  = "cht_2d_plate_concurrent.cfg"
+    cht_concurrent_zones.test_iter = 10
+    cht_concurrent_zones.test_vals = [-3.397076, -1.001147]
+    cht_concurrent_zones.su2_exec  = "mpirun -n 2 SU2_CFD"
+    cht_concurrent_zones.timeout   = 1600
+    cht_concurrent_zones.multizone = True
+    cht_concurrent_zones.tol       = 0.00001
+    test_list.append(cht_concurrent_zones)
+
     # 2D CHT case streamwise periodicity
     sp_pinArray_cht_2d_dp_hf           = TestCase('sp_pinArray_cht_2d_dp_hf')
     sp_pinArray_cht_2d_dp_hf.cfg_dir   = "incomp_navierstokes/streamwise_periodic/chtPinArray_2d"
@@ -316,6 +316,18 @@ def main():
     turb_flatplate.tol       = 0.00001
     test_list.append(turb_flatplate)
 
+    # Flat plate, SA solved with the multigrid cycle (self-contained mesh)
+    turb_flatplate_mg_turb           = TestCase('turb_flatplate_mg_turb')
+    turb_flatplate_mg_turb.cfg_dir   = "rans/flatplate"
+    turb_flatplate_mg_turb.cfg_file  = "turb_SA_flatplate_mg_turb.cfg"
+    turb_flatplate_mg_turb.test_iter = 20
+    turb_flatplate_mg_turb.test_vals = [-5.201510, -4.102613, 0.129618, 0.001952] #last 4 columns
+    turb_flatplate_mg_turb.su2_exec  = "SU2_CFD"
+    turb_flatplate_mg_turb.new_output  = True
+    turb_flatplate_mg_turb.timeout   = 1600
+    turb_flatplate_mg_turb.tol       = 0.00001
+    test_list.append(turb_flatplate_mg_turb)
+
     # ONERA M6 Wing
     turb_oneram6           = TestCase('turb_oneram6')
     turb_oneram6.cfg_dir   = "rans/oneram6"
@@ -915,6 +927,18 @@ def main():
     hb_rans_preconditioning.tol       = 0.00001
     test_list.append(hb_rans_preconditioning)
 
+    # Pitching flat plate at a high reduced frequency, coupled implicit HB source term
+    hb_coupled_implicit           = TestCase('hb_coupled_implicit')
+    hb_coupled_implicit.cfg_dir   = "harmonic_balance/hb_coupled_implicit"
+    hb_coupled_implicit.cfg_file  = "flatplate_coupled.cfg"
+    hb_coupled_implicit.test_iter = 25
+    hb_coupled_implicit.test_vals = [-3.650847, -2.934600, 0.142116, 0.000046]
+    hb_coupled_implicit.su2_exec  = "SU2_CFD"
+    hb_coupled_implicit.new_output= False
+    hb_coupled_implicit.timeout   = 1600
+    hb_coupled_implicit.tol       = 0.00001
+    test_list.append(hb_coupled_implicit)
+
     ######################################
     ### Moving Wall                    ###
     ######################################
@@ -1428,6 +1452,18 @@ def main():
     cht_incompressible.tol       = 0.00001
     test_list.append(cht_incompressible)
 
+    # CHT with the solid conduction solved without pseudo time stepping
+    cht_solid_no_pseudo_time           = TestCase('cht_solid_no_pseudo_time')
+    cht_solid_no_pseudo_time.cfg_dir   = "coupled_cht/solid_no_pseudo_time_2d"
+    cht_solid_no_pseudo_time.cfg_file  = "cht_2d_plate.cfg"
+    cht_solid_no_pseudo_time.test_iter = 10
+    cht_solid_no_pseudo_time.test_vals = [-3.390594, -1.078384] #last 2 columns
+    cht_solid_no_pseudo_time.su2_exec  = "SU2_CFD"
+    cht_solid_no_pseudo_time.timeout   = 1600
+    cht_solid_no_pseudo_time.multizone = True
+    cht_solid_no_pseudo_time.tol       = 0.00001
+    test_list.append(cht_solid_no_pseudo_time)
+
     ##############################################
     ### Method of Manufactured Solutions (MMS) ###
     ##############################################
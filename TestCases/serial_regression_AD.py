@@ -388,6 +388,16 @@ def main():
     test_list.append(pywrapper_FEA_AD_FlowLoad)
     pass_list.append(pywrapper_FEA_AD_FlowLoad.run_test())
 
+    # Transposed Jacobian warm start of the adjoint, the script checks that it needs fewer iterations
+    discadj_jacobian_guess           = TestCase('discadj_jacobian_guess')
+    discadj_jacobian_guess.cfg_dir   = "disc_adj_navierstokes/flatplate"
+    discadj_jacobian_guess.cfg_file  = "lam_flatplate.cfg"
+    discadj_jacobian_guess.test_iter = 100
+    discadj_jacobian_guess.su2_exec  = "python check_jacobian_guess.py -f"
+    discadj_jacobian_guess.timeout   = 1600
+    test_list.append(discadj_jacobian_guess)
+    pass_list.append(discadj_jacobian_guess.run_test())
+
     # Tests summary
     print('==================================================================')
     print('Summary of the serial tests')
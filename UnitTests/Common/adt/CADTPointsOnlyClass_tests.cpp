@@ -0,0 +1,83 @@
+/*!
+ * \file CADTPointsOnlyClass_tests.cpp
+ * \brief Unit tests for the nearest neighbors search of the point ADT, the result
+ * should match a brute force search, including the tie-breaking by point ID.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <random>
+#include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
+
+TEST_CASE("ADT k nearest nodes", "[ADT]") {
+
+  const unsigned short nDim = 3;
+  const unsigned long nPoint = 500;
+
+  /*--- Points on a coarse lattice, such that there are many ties. ---*/
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> lattice(0, 6);
+
+  std::vector<su2double> coord(nDim*nPoint);
+  std::vector<unsigned long> pointID(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iDim = 0u; iDim < nDim; ++iDim) coord[iPoint*nDim+iDim] = 0.5*lattice(gen);
+    pointID[iPoint] = 3*iPoint+1;
+  }
+
+  CADTPointsOnlyClass adt(nDim, nPoint, coord.data(), pointID.data(), false);
+
+  std::uniform_real_distribution<passivedouble> dist(-0.5, 3.5);
+  std::vector<su2double> dist2;
+  std::vector<unsigned long> ids;
+  std::vector<int> ranks;
+
+  for (int iTest = 0; iTest < 50; ++iTest) {
+    su2double x[nDim];
+    for (auto iDim = 0u; iDim < nDim; ++iDim) x[iDim] = (iTest % 2)? 0.5*lattice(gen) : dist(gen);
+
+    /*--- Brute force reference. ---*/
+    std::vector<std::pair<passivedouble, unsigned long> > ref(nPoint);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      passivedouble d = 0.0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) d += pow(SU2_TYPE::GetValue(x[iDim] - coord[iPoint*nDim+iDim]), 2);
+      ref[iPoint] = std::make_pair(d, pointID[iPoint]);
+    }
+    std::sort(ref.begin(), ref.end());
+
+    for (unsigned long k : {1ul, 4ul, 9ul}) {
+      adt.DetermineNearestNodes(x, k, dist2, ids, ranks);
+      REQUIRE(ids.size() == k);
+      for (auto i = 0ul; i < k; ++i) {
+        CHECK(ids[i] == ref[i].second);
+        CHECK(SU2_TYPE::GetValue(dist2[i]) == Approx(ref[i].first));
+      }
+    }
+  }
+
+  /*--- A tree with one point returns it once. ---*/
+  CADTPointsOnlyClass single(nDim, 1, coord.data(), pointID.data(), false);
+  single.DetermineNearestNodes(coord.data()+nDim, 3, dist2, ids, ranks);
+  REQUIRE(ids.size() == 1);
+  CHECK(ids[0] == pointID[0]);
+}
@@ -156,3 +156,59 @@ TEST_CASE("Set bound control volume", "[Geometry]"){
   CHECK(TestCase->geometry->vertex[5][3]->GetNormal()[2] ==  0.03125);
 
 }
+
+namespace {
+/*--- Two groups of the same color must not have points in common in their closed neighborhoods,
+ *    and every domain point must have exactly one color. ---*/
+void CheckPointColoring(const CGeometry& geometry, const CCompressedSparsePatternUL& coloring, unsigned long groupSize) {
+
+  const auto nPointDomain = geometry.GetnPointDomain();
+  const auto& neighbors = geometry.nodes->GetPoints();
+  std::vector<int> timesColored(nPointDomain, 0);
+
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+    /*--- Group that reads or writes each point within this color. ---*/
+    std::vector<long> owner(geometry.GetnPoint(), -1);
+    const auto nColorPoints = coloring.getNumNonZeros(iColor);
+
+    for (auto k = 0ul; k < nColorPoints; ++k) {
+      const auto iPoint = coloring.getInnerIdx(iColor, k);
+      const long group = iPoint / groupSize;
+      ++timesColored[iPoint];
+
+      std::vector<unsigned long> closed(1, iPoint);
+      for (auto jPoint : neighbors.getInnerIter(iPoint)) closed.push_back(jPoint);
+
+      for (auto jPoint : closed) {
+        CHECK((owner[jPoint] < 0 || owner[jPoint] == group));
+        owner[jPoint] = group;
+      }
+    }
+  }
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) CHECK(timesColored[iPoint] == 1);
+}
+}
+
+TEST_CASE("Point coloring", "[Geometry]"){
+
+  const auto& geometry = *TestCase->geometry;
+  const auto pattern = buildClosedNeighborhoodPattern(geometry.nodes->GetPoints(), geometry.GetnPointDomain());
+
+  for (auto groupSize : {1ul, 4ul}) {
+    const auto coloring = colorSparsePattern(pattern, groupSize, true);
+    REQUIRE(!coloring.empty());
+    CHECK(coloring.getOuterSize() > 1);
+    CheckPointColoring(geometry, coloring, groupSize);
+  }
+
+  /*--- The coloring used by the gradient and limiter loops is only built with threads. ---*/
+  const auto& coloring = TestCase->geometry->GetPointColoring();
+  if (omp_get_max_threads() > 1) {
+    REQUIRE(!coloring.empty());
+    CheckPointColoring(geometry, coloring, geometry.GetPointColorGroupSize());
+  }
+  else {
+    CHECK(coloring.empty());
+  }
+
+}
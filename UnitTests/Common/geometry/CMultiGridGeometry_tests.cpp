@@ -0,0 +1,153 @@
+/*!
+ * \file CMultiGridGeometry_tests.cpp
+ * \brief Unit tests for the agglomeration of the coarse multigrid levels, with
+ * MG_INTERFACE_AGGLOMERATION the levels must not depend on the number of partitions.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+
+namespace {
+/*!
+ * \brief Build the multigrid levels of a box, partitioned over the ranks of the current communicator.
+ * \return For each coarse level, the global number of domain CVs with 0, 1, 2, ... children.
+ */
+vector<vector<unsigned long> > CoarseLevelSizes() {
+
+  const string configOptions =
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= BOX\n"
+      "INIT_OPTION= TD_CONDITIONS\n"
+      "MARKER_EULER= (y_minus, y_plus)\n"
+      "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+      "MESH_BOX_SIZE= 9,8,7\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "MGLEVEL= 2\n"
+      "MG_INTERFACE_AGGLOMERATION= YES\n";
+
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  stringstream ss(configOptions);
+  CConfig config(ss, SU2_COMPONENT::SU2_CFD, false);
+  const auto nMGLevels = config.GetnMGLevels();
+
+  vector<CGeometry*> geometry(nMGLevels+1, nullptr);
+  {
+    CPhysicalGeometry aux_geometry(&config, 0, 1);
+    aux_geometry.SetColorGrid_Parallel(&config);
+    geometry[MESH_0] = new CPhysicalGeometry(&aux_geometry, &config);
+  }
+  geometry[MESH_0]->SetSendReceive(&config);
+  geometry[MESH_0]->SetBoundaries(&config);
+  geometry[MESH_0]->SetPoint_Connectivity();
+  geometry[MESH_0]->SetElement_Connectivity();
+  geometry[MESH_0]->SetBoundVolume();
+  geometry[MESH_0]->Check_IntElem_Orientation(&config);
+  geometry[MESH_0]->Check_BoundElem_Orientation(&config);
+  geometry[MESH_0]->SetEdges();
+  geometry[MESH_0]->SetVertex(&config);
+  geometry[MESH_0]->SetControlVolume(&config, ALLOCATE);
+  geometry[MESH_0]->SetBoundControlVolume(&config, ALLOCATE);
+  geometry[MESH_0]->SetMGLevel(MESH_0);
+
+  /*--- Same sequence as CDriver::Geometrical_Preprocessing_FVM. ---*/
+
+  for (auto iMesh = 1u; iMesh <= nMGLevels; ++iMesh) {
+    geometry[iMesh] = new CMultiGridGeometry(geometry.data(), &config, iMesh);
+    geometry[iMesh]->SetPoint_Connectivity(geometry[iMesh-1]);
+    geometry[iMesh]->SetEdges();
+    geometry[iMesh]->SetVertex(geometry[iMesh-1], &config);
+    geometry[iMesh]->SetControlVolume(&config, geometry[iMesh-1], ALLOCATE);
+    geometry[iMesh]->SetBoundControlVolume(&config, geometry[iMesh-1], ALLOCATE);
+    geometry[iMesh]->SetCoord(geometry[iMesh-1]);
+    geometry[iMesh]->FindNormal_Neighbor(&config);
+    geometry[iMesh]->SetMGLevel(iMesh);
+    if (config.GetnMGLevels() != nMGLevels) break;
+  }
+  cout.rdbuf(origBuf);
+
+  vector<vector<unsigned long> > sizes;
+
+  for (auto iMesh = 1u; iMesh <= config.GetnMGLevels(); ++iMesh) {
+    const auto coarse = geometry[iMesh];
+
+    unsigned long maxChildren = 0, Global_maxChildren = 0;
+    for (auto iPoint = 0ul; iPoint < coarse->GetnPointDomain(); ++iPoint)
+      maxChildren = max<unsigned long>(maxChildren, coarse->nodes->GetnChildren_CV(iPoint));
+    SU2_MPI::Allreduce(&maxChildren, &Global_maxChildren, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+    vector<unsigned long> count(Global_maxChildren+1, 0), Global_count(Global_maxChildren+1, 0);
+    for (auto iPoint = 0ul; iPoint < coarse->GetnPointDomain(); ++iPoint)
+      count[coarse->nodes->GetnChildren_CV(iPoint)]++;
+    SU2_MPI::Allreduce(count.data(), Global_count.data(), count.size(), MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+    sizes.push_back(Global_count);
+  }
+
+  for (auto ptr : geometry) delete ptr;
+  return sizes;
+}
+}
+
+TEST_CASE("Partition independent agglomeration", "[Geometry]") {
+
+#if defined(HAVE_MPI) && !defined(HAVE_PARMETIS)
+  if (SU2_MPI::GetSize() > 1) {
+    WARN("Partitioning the mesh requires ParMETIS.");
+    return;
+  }
+#endif
+
+  const auto partitioned = CoarseLevelSizes();
+
+  /*--- Reference levels of a single partition. ---*/
+
+#ifdef HAVE_MPI
+  const auto comm = SU2_MPI::GetComm();
+  SU2_MPI::SetComm(MPI_COMM_SELF);
+#endif
+  const auto reference = CoarseLevelSizes();
+#ifdef HAVE_MPI
+  SU2_MPI::SetComm(comm);
+#endif
+
+  REQUIRE(reference.size() == 2);
+  REQUIRE(partitioned.size() == reference.size());
+
+  unsigned long nPointFine = 9*8*7;
+
+  for (auto iMesh = 0ul; iMesh < reference.size(); ++iMesh) {
+    unsigned long nCoarse = 0, nChildren = 0;
+    for (auto i = 0ul; i < reference[iMesh].size(); ++i) {
+      nCoarse += reference[iMesh][i];
+      nChildren += i*reference[iMesh][i];
+    }
+    CHECK(nChildren == nPointFine);
+    CHECK(nCoarse < nPointFine);
+    CHECK(partitioned[iMesh] == reference[iMesh]);
+    nPointFine = nCoarse;
+  }
+}
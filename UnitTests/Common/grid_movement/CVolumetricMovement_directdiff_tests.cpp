@@ -0,0 +1,86 @@
+/*!
+ * \file CVolumetricMovement_directdiff_tests.cpp
+ * \brief Direct differentiation test of the mesh deformation stiffness matrix, the tangents
+ * of the element matrices must be kept when they are added to the global matrix.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/grid_movement/CVolumetricMovement.hpp"
+
+namespace {
+/*--- Expose the stiffness matrix of the mesh deformation. ---*/
+struct CTestVolumetricMovement : public CVolumetricMovement {
+  using CVolumetricMovement::CVolumetricMovement;
+  using CVolumetricMovement::StiffMatrix;
+};
+}
+
+TEST_CASE("Stiffness matrix tangents", "[Grid Movement]") {
+
+  auto test = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase());
+  test->AddOption("SURFACE_MOVEMENT= EXTERNAL");
+  test->AddOption("MARKER_MOVING= ( y_minus )");
+  test->AddOption("DEFORM_METHOD= ELASTICITY");
+  test->InitConfig();
+  test->InitGeometry();
+
+  auto config = test->config.get();
+  auto geometry = test->geometry.get();
+  const auto nDim = geometry->GetnDim();
+
+  /*--- Seed the x coordinate of the center point, the corner of the box shares no element with it. ---*/
+
+  unsigned long center = 0, corner = 0;
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+    bool isCenter = true, isCorner = true;
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      isCenter &= (geometry->nodes->GetCoord(iPoint,iDim) == 0.5);
+      isCorner &= (geometry->nodes->GetCoord(iPoint,iDim) == 0.0);
+    }
+    if (isCenter) center = iPoint;
+    if (isCorner) corner = iPoint;
+  }
+  REQUIRE(center != corner);
+  SU2_TYPE::SetDerivative(geometry->nodes->GetCoord(center)[0], 1.0);
+
+  cout.rdbuf(nullptr);
+  CTestVolumetricMovement mover(geometry, config);
+  mover.StiffMatrix.SetValZero();
+  mover.SetFEAMethodContributions_Elem(geometry, config);
+  cout.rdbuf(test->orig_buf);
+
+  const auto nVar2 = nDim*nDim;
+  const auto blockCenter = mover.StiffMatrix.GetBlock(center, center);
+  const auto blockCorner = mover.StiffMatrix.GetBlock(corner, corner);
+
+  passivedouble derivCenter = 0.0, derivCorner = 0.0;
+  for (auto i = 0u; i < nVar2; i++) {
+    derivCenter += fabs(SU2_TYPE::GetDerivative(blockCenter[i]));
+    derivCorner += fabs(SU2_TYPE::GetDerivative(blockCorner[i]));
+  }
+  CHECK(derivCenter > 0.0);
+  CHECK(derivCorner == 0.0);
+}
@@ -0,0 +1,183 @@
+/*!
+ * \file CVolumetricMovement_tests.cpp
+ * \brief Unit tests for the RBF volumetric mesh deformation, the prescribed boundary
+ * displacements should be recovered exactly and the volume should follow smoothly.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/grid_movement/CVolumetricMovement.hpp"
+
+TEST_CASE("RBF mesh deformation", "[Grid Movement]") {
+
+  auto test = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase());
+  test->AddOption("TIME_DOMAIN= YES");
+  test->AddOption("TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER");
+  test->AddOption("TIME_STEP= 0.1");
+  test->AddOption("SURFACE_MOVEMENT= EXTERNAL");
+  test->AddOption("MARKER_MOVING= ( y_minus )");
+  test->AddOption("DEFORM_METHOD= RBF");
+  test->AddOption("DEFORM_RBF_RADIUS= 0.6");
+  test->AddOption("DEFORM_RBF_TOLERANCE= 1e-6");
+  test->InitConfig();
+  test->InitGeometry();
+
+  auto config = test->config.get();
+  auto geometry = test->geometry.get();
+  const auto nDim = geometry->GetnDim();
+  const su2double shift = 0.05;
+
+  /*--- Translate the moving marker. ---*/
+
+  const su2double varCoord[3] = {0.0, shift, 0.0};
+  vector<bool> moving(geometry->GetnPoint(), false);
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_Moving(iMarker) != YES) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      geometry->vertex[iMarker][iVertex]->SetVarCoord(varCoord);
+      moving[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+    }
+  }
+
+  su2activematrix coordOld(geometry->GetnPoint(), nDim);
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      coordOld(iPoint,iDim) = geometry->nodes->GetCoord(iPoint,iDim);
+
+  cout.rdbuf(nullptr);
+  CVolumetricMovement mover(geometry, config);
+  mover.SetVolume_Deformation(geometry, config, false);
+  cout.rdbuf(test->orig_buf);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+    const auto y = coordOld(iPoint,1);
+    const auto dy = geometry->nodes->GetCoord(iPoint,1) - y;
+
+    if (moving[iPoint]) {
+      CHECK(dy == Approx(shift));
+    }
+    else if (y == 1.0) {
+      CHECK(dy == 0.0);
+    }
+    else {
+      CHECK(fabs(dy) < shift);
+    }
+
+    /*--- The point above the center of the moving face follows it. ---*/
+    if ((coordOld(iPoint,0) == 0.5) && (y == 0.25) && (coordOld(iPoint,2) == 0.5)) {
+      CHECK(dy > 0.2*shift);
+    }
+  }
+
+}
+
+TEST_CASE("Reuse of the elasticity deformation system", "[Grid Movement]") {
+
+  auto test = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase());
+  test->AddOption("TIME_DOMAIN= YES");
+  test->AddOption("TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER");
+  test->AddOption("TIME_STEP= 0.1");
+  test->AddOption("SURFACE_MOVEMENT= EXTERNAL");
+  test->AddOption("MARKER_MOVING= ( y_minus )");
+  test->AddOption("DEFORM_LINEAR_SOLVER_ERROR= 1E-12");
+  test->AddOption("DEFORM_REUSE_SYSTEM= YES");
+  test->InitConfig();
+  test->InitGeometry();
+
+  auto config = test->config.get();
+  auto geometry = test->geometry.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nDim = geometry->GetnDim();
+
+  su2activematrix coordRef(nPoint, nDim);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      coordRef(iPoint,iDim) = geometry->nodes->GetCoord(iPoint,iDim);
+
+  /*--- Translate the moving marker and deform the reference grid, as in the convexity check of SU2_DEF. ---*/
+
+  auto deform = [&](CVolumetricMovement& mover, su2double shift) {
+    const su2double varCoord[3] = {0.0, shift, 0.0};
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_Moving(iMarker) != YES) continue;
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++)
+        geometry->vertex[iMarker][iVertex]->SetVarCoord(varCoord);
+    }
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        geometry->nodes->SetCoord(iPoint, iDim, coordRef(iPoint,iDim));
+
+    cout.rdbuf(nullptr);
+    mover.SetVolume_Deformation(geometry, config, false);
+    cout.rdbuf(test->orig_buf);
+
+    su2activematrix coord(nPoint, nDim);
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        coord(iPoint,iDim) = geometry->nodes->GetCoord(iPoint,iDim);
+    return coord;
+  };
+
+  auto checkSameCoord = [&](const su2activematrix& actual, const su2activematrix& expected) {
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        CHECK(SU2_TYPE::GetValue(actual(iPoint,iDim)) == Approx(SU2_TYPE::GetValue(expected(iPoint,iDim))));
+  };
+
+  cout.rdbuf(nullptr);
+  CVolumetricMovement mover(geometry, config);
+  cout.rdbuf(test->orig_buf);
+
+  const auto first = deform(mover, 0.05);
+  REQUIRE_FALSE(mover.GetSystemReused());
+  const auto firstIter = mover.Get_nIterMesh();
+
+  /*--- Same displacements, the factorization is reused and the previous solution is exact. ---*/
+
+  const auto second = deform(mover, 0.05);
+  REQUIRE(mover.GetSystemReused());
+  CHECK(mover.Get_nIterMesh() < firstIter);
+  checkSameCoord(second, first);
+
+  /*--- Smaller displacements, compared with a system assembled from scratch. ---*/
+
+  const auto reduced = deform(mover, 0.025);
+  REQUIRE(mover.GetSystemReused());
+
+  cout.rdbuf(nullptr);
+  CVolumetricMovement freshMover(geometry, config);
+  cout.rdbuf(test->orig_buf);
+  const auto reference = deform(freshMover, 0.025);
+  REQUIRE_FALSE(freshMover.GetSystemReused());
+  checkSameCoord(reduced, reference);
+
+  /*--- The deformed grid is not the assembled one, the system must be rebuilt. ---*/
+
+  cout.rdbuf(nullptr);
+  mover.SetVolume_Deformation(geometry, config, false);
+  cout.rdbuf(test->orig_buf);
+  CHECK_FALSE(mover.GetSystemReused());
+
+}
@@ -0,0 +1,332 @@
+/*!
+ * \file CInterpolator_tests.cpp
+ * \brief Unit tests for the interface interpolation between two non-matching grids,
+ * the local RBF interpolation should reproduce linear fields.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/interface_interpolation/CNearestNeighbor.hpp"
+#include "../../../Common/include/interface_interpolation/CRadialBasisFunction.hpp"
+#include "../../../Common/include/interface_interpolation/CSlidingMesh.hpp"
+#include "../../../Common/include/geometry/CDummyGeometry.hpp"
+#include "../../../SU2_CFD/include/interfaces/CInterface.hpp"
+
+namespace {
+
+/*--- Linear field on the y_minus face of the boxes. ---*/
+su2double linearField(const su2double* x) { return 1.0 + 2.0*x[0] - 3.0*x[2]; }
+
+/*--- Two zones with an interface on their y_minus faces, zone 1 is coarser and shifted,
+ * its points do not match zone 0. The meshes are 2D with the RECTANGLE format. ---*/
+struct CInterfaceTestCase {
+  UnitQuadTestCase zones[2];
+  CConfig* config[2];
+  CGeometry* geometry[2][1][1];
+  CGeometry** geometryInst[2][1];
+  CGeometry*** geometryZone[2];
+
+  explicit CInterfaceTestCase(const std::vector<std::string>& options, const std::string& meshFormat = "BOX",
+                              int localZone = -1, const std::vector<std::string>& targetOptions = {}) {
+    for (int iZone = 0; iZone < 2; ++iZone) {
+      auto& zoneOptions = zones[iZone].config_options;
+      if (meshFormat == "RECTANGLE") {
+        zoneOptions.replace(zoneOptions.find("MESH_FORMAT= BOX"), 16, "MESH_FORMAT= RECTANGLE");
+        zoneOptions.replace(zoneOptions.find(", z_plus, z_minus"), 17, "");
+      }
+      zones[iZone].AddOption("MARKER_ZONE_INTERFACE= ( y_minus, y_minus )");
+      for (const auto& option : options) zones[iZone].AddOption(option);
+    }
+    for (const auto& option : targetOptions) zones[1].AddOption(option);
+    /*--- The interface is not at y=0 because planes through the origin are not detected by the RBF. ---*/
+    auto& options0 = zones[0].config_options;
+    options0.replace(options0.find("MESH_BOX_OFFSET=0,0,0"), 21, "MESH_BOX_OFFSET= (0, 0.5, 0)");
+    auto& options1 = zones[1].config_options;
+    options1.replace(options1.find("MESH_BOX_SIZE=5,5,5"), 19, "MESH_BOX_SIZE= (4, 4, 4)");
+    options1.replace(options1.find("MESH_BOX_LENGTH=1,1,1"), 21, "MESH_BOX_LENGTH= (0.9, 1, 0.9)");
+    options1.replace(options1.find("MESH_BOX_OFFSET=0,0,0"), 21, "MESH_BOX_OFFSET= (0.05, 0.5, 0.05)");
+
+    for (int iZone = 0; iZone < 2; ++iZone) {
+      zones[iZone].InitConfig();
+      /*--- Zones solved by other ranks have a dummy geometry, as with concurrent zones. ---*/
+      if (localZone < 0 || localZone == iZone) zones[iZone].InitGeometry();
+      else zones[iZone].geometry.reset(new CDummyGeometry(zones[iZone].config.get()));
+      config[iZone] = zones[iZone].config.get();
+      geometry[iZone][0][0] = zones[iZone].geometry.get();
+      geometryInst[iZone][0] = geometry[iZone][0];
+      geometryZone[iZone] = geometryInst[iZone];
+    }
+  }
+};
+
+/*--- Transfers the linear field of the donor coordinates, and keeps the target values. ---*/
+class CLinearFieldInterface : public CInterface {
+public:
+  std::map<unsigned long, su2double> targetValue;
+
+  CLinearFieldInterface() : CInterface(1, 0) {}
+
+protected:
+  void GetDonor_Variable(CSolver*, CGeometry *donor_geometry, const CConfig*, unsigned long,
+                         unsigned long, unsigned long Point_Donor) override {
+    Donor_Variable[0] = linearField(donor_geometry->nodes->GetCoord(Point_Donor));
+  }
+
+  void SetTarget_Variable(CSolver*, CGeometry*, const CConfig*, unsigned long,
+                          unsigned long, unsigned long Point_Target) override {
+    targetValue[Point_Target] = Target_Variable[0];
+  }
+};
+
+/*--- Interpolate the field from zone 0 to zone 1, returns the max error and the max sum of
+ * absolute coefficients. ---*/
+template<class Interpolator>
+std::pair<passivedouble, passivedouble> interpolateLinear(const std::vector<std::string>& options) {
+
+  CInterfaceTestCase testCase(options);
+  const auto config = testCase.config;
+  const auto geometry = testCase.geometry;
+
+  Interpolator interpolator(testCase.geometryZone, config, 0, 1);
+
+  const auto donor = geometry[0][0][0];
+  const auto target = geometry[1][0][0];
+  const auto markTarget = config[1]->FindInterfaceMarker(0);
+
+  /*--- Donor values by global index. ---*/
+  std::vector<su2double> donorValue(donor->GetGlobal_nPoint());
+  for (auto iPoint = 0ul; iPoint < donor->GetnPoint(); ++iPoint)
+    donorValue[donor->nodes->GetGlobalIndex(iPoint)] = linearField(donor->nodes->GetCoord(iPoint));
+
+  passivedouble maxError = 0.0, maxAbsSum = 0.0;
+
+  for (auto iVertex = 0ul; iVertex < target->GetnVertex(markTarget); ++iVertex) {
+    const auto iPoint = target->vertex[markTarget][iVertex]->GetNode();
+    const auto& donors = interpolator.targetVertices[markTarget][iVertex];
+    REQUIRE(donors.nDonor() > 0);
+
+    su2double value = 0.0, absSum = 0.0;
+    for (auto iDonor = 0ul; iDonor < donors.nDonor(); ++iDonor) {
+      value += donors.coefficient[iDonor] * donorValue[donors.globalPoint[iDonor]];
+      absSum += fabs(donors.coefficient[iDonor]);
+    }
+    maxError = max(maxError, fabs(SU2_TYPE::GetValue(value - linearField(target->nodes->GetCoord(iPoint)))));
+    maxAbsSum = max(maxAbsSum, SU2_TYPE::GetValue(absSum));
+  }
+  return std::make_pair(maxError, maxAbsSum);
+}
+
+/*--- Checks that two sets of interpolation coefficients (of the same target marker) are equal. ---*/
+template<class DonorInfo>
+void checkSameCoefficients(const std::vector<DonorInfo>& actual, const std::vector<DonorInfo>& expected) {
+  REQUIRE(actual.size() == expected.size());
+
+  for (auto iVertex = 0ul; iVertex < actual.size(); ++iVertex) {
+    std::map<unsigned long, passivedouble> a, b;
+    for (auto iDonor = 0ul; iDonor < actual[iVertex].nDonor(); ++iDonor)
+      a[actual[iVertex].globalPoint[iDonor]] = SU2_TYPE::GetValue(actual[iVertex].coefficient[iDonor]);
+    for (auto iDonor = 0ul; iDonor < expected[iVertex].nDonor(); ++iDonor)
+      b[expected[iVertex].globalPoint[iDonor]] = SU2_TYPE::GetValue(expected[iVertex].coefficient[iDonor]);
+
+    REQUIRE(a.size() == b.size());
+    for (const auto& donor : b) CHECK(a[donor.first] == Approx(donor.second));
+  }
+}
+
+/*--- Slides the target zone (1) of a test case along x, to its initial position plus an offset. ---*/
+void slideTarget(CInterfaceTestCase& testCase, const std::vector<passivedouble>& x0, passivedouble offset) {
+  auto target = testCase.geometry[1][0][0];
+  for (auto iPoint = 0ul; iPoint < target->GetnPoint(); ++iPoint) {
+    target->nodes->SetCoord(iPoint, 0, x0[iPoint] + offset);
+  }
+}
+
+}
+
+TEST_CASE("Local RBF interpolation", "[Interpolation]") {
+
+  auto result = interpolateLinear<CRadialBasisFunction>({"KIND_RADIAL_BASIS_FUNCTION= WENDLAND_C2",
+                                                         "RADIAL_BASIS_FUNCTION_PARAMETER= 0.6",
+                                                         "RADIAL_BASIS_FUNCTION_LOCAL_POINTS= 12"});
+  CHECK(result.first < 1e-8);
+  CHECK(result.second < 3.0);
+}
+
+TEST_CASE("Nearest neighbor interpolation", "[Interpolation]") {
+
+  /*--- Inverse distance weights are positive and add up to one. ---*/
+  auto result = interpolateLinear<CNearestNeighbor>({"NUM_NEAREST_NEIGHBORS= 4"});
+  CHECK(result.second == Approx(1.0));
+}
+
+TEST_CASE("Sliding mesh update", "[Interpolation]") {
+
+  /*--- Updating the coefficients after the target zone slides along the interface must give
+   * the same result as setting them up from scratch. ---*/
+  CInterfaceTestCase moving({}, "RECTANGLE"), reference({}, "RECTANGLE");
+
+  CSlidingMesh interpolator(moving.geometryZone, moving.config, 0, 1);
+
+  for (auto testCase : {&moving, &reference}) {
+    auto target = testCase->geometry[1][0][0];
+    for (auto iPoint = 0ul; iPoint < target->GetnPoint(); ++iPoint) {
+      target->nodes->SetCoord(iPoint, 0, target->nodes->GetCoord(iPoint, 0) + 0.07);
+    }
+  }
+  interpolator.SetTransferCoeff(moving.config);
+
+  CSlidingMesh fresh(reference.geometryZone, reference.config, 0, 1);
+
+  const auto markTarget = moving.config[1]->FindInterfaceMarker(0);
+  checkSameCoefficients(interpolator.targetVertices[markTarget], fresh.targetVertices[markTarget]);
+}
+
+TEST_CASE("Sliding mesh periodic cache", "[Interpolation]") {
+
+  /*--- The target zone rotates at 1 revolution per unit time, with 4 steps per revolution the coefficients
+   * of the 5th step are those cached in the first step. The target slides back and forth with the same
+   * period (the planar interface cannot rotate), the cached coefficients must match a fresh setup. ---*/
+  const std::vector<std::string> options = {"TIME_DOMAIN= YES", "TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER",
+                                            "TIME_STEP= 0.25", "SLIDING_MESH_PERIODIC_CACHE= YES"};
+  const std::vector<std::string> rotation = {"GRID_MOVEMENT= RIGID_MOTION",
+                                             "ROTATION_RATE= (0.0, 0.0, 6.283185307179586)"};
+
+  CInterfaceTestCase moving(options, "RECTANGLE", -1, rotation), reference(options, "RECTANGLE", -1, rotation);
+
+  for (auto testCase : {&moving, &reference}) {
+    for (auto config : testCase->config) {
+      config->SetOmega_Ref(1.0);
+      config->SetDelta_UnstTimeND(0.25);
+    }
+  }
+
+  auto target = moving.geometry[1][0][0];
+  std::vector<passivedouble> x0(target->GetnPoint());
+  for (auto iPoint = 0ul; iPoint < target->GetnPoint(); ++iPoint)
+    x0[iPoint] = SU2_TYPE::GetValue(target->nodes->GetCoord(iPoint, 0));
+
+  CSlidingMesh interpolator(moving.geometryZone, moving.config, 0, 1);
+  REQUIRE(interpolator.GetPeriodSteps() == 4);
+
+  const passivedouble offset[] = {0.0, 0.07, 0.14, 0.07};
+  for (unsigned long iTime = 0; iTime <= 4; ++iTime) {
+    slideTarget(moving, x0, offset[iTime % 4]);
+    for (auto config : moving.config) config->SetTimeIter(iTime);
+    interpolator.SetTransferCoeff(moving.config);
+  }
+
+  CSlidingMesh fresh(reference.geometryZone, reference.config, 0, 1);
+
+  const auto markTarget = moving.config[1]->FindInterfaceMarker(0);
+  checkSameCoefficients(interpolator.targetVertices[markTarget], fresh.targetVertices[markTarget]);
+}
+
+TEST_CASE("Interface data transfer", "[Interpolation]") {
+
+  /*--- The transferred values must match the coefficients of the interpolator, also when
+   * the transfer is repeated with the same communication pattern. ---*/
+  CInterfaceTestCase testCase({"NUM_NEAREST_NEIGHBORS= 4"});
+  const auto config = testCase.config;
+  const auto donor = testCase.geometry[0][0][0];
+  const auto target = testCase.geometry[1][0][0];
+
+  CNearestNeighbor interpolator(testCase.geometryZone, config, 0, 1);
+  CLinearFieldInterface interface;
+
+  std::vector<su2double> donorValue(donor->GetGlobal_nPoint());
+  for (auto iPoint = 0ul; iPoint < donor->GetnPoint(); ++iPoint)
+    donorValue[donor->nodes->GetGlobalIndex(iPoint)] = linearField(donor->nodes->GetCoord(iPoint));
+
+  const auto markTarget = config[1]->FindInterfaceMarker(0);
+
+  for (int iTransfer = 0; iTransfer < 2; ++iTransfer) {
+    interface.targetValue.clear();
+    interface.BroadcastData(interpolator, nullptr, nullptr, donor, target, config[0], config[1]);
+
+    unsigned long nTarget = 0;
+    for (auto iVertex = 0ul; iVertex < target->GetnVertex(markTarget); ++iVertex) {
+      const auto iPoint = target->vertex[markTarget][iVertex]->GetNode();
+      if (!target->nodes->GetDomain(iPoint)) continue;
+      ++nTarget;
+
+      const auto& donors = interpolator.targetVertices[markTarget][iVertex];
+      su2double value = 0.0;
+      for (auto iDonor = 0ul; iDonor < donors.nDonor(); ++iDonor)
+        value += donors.coefficient[iDonor] * donorValue[donors.globalPoint[iDonor]];
+
+      REQUIRE(interface.targetValue.count(iPoint) == 1);
+      CHECK(SU2_TYPE::GetValue(interface.targetValue[iPoint]) == Approx(SU2_TYPE::GetValue(value)));
+    }
+    CHECK(nTarget > 0);
+    CHECK(interface.targetValue.size() == nTarget);
+  }
+}
+
+TEST_CASE("Interface data transfer with concurrent zones", "[Interpolation]") {
+
+  /*--- Each zone is partitioned over its own group of ranks, the interpolation and the transfer
+   * use the communicator of all ranks while the global one is that of the group. The groups have
+   * several ranks when there are more ranks than zones (mpirun -n 3 or more), in serial this is
+   * a transfer between local zones. ---*/
+  const auto driverComm = SU2_MPI::GetComm();
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const int rankZone = (size > 1) && (rank >= size / 2);
+
+  SU2_MPI::Comm zoneComm;
+  SU2_MPI::Comm_split(driverComm, rankZone, rank, &zoneComm);
+  SU2_MPI::SetComm(zoneComm);
+  {
+    CInterfaceTestCase testCase({"KIND_RADIAL_BASIS_FUNCTION= WENDLAND_C2",
+                                 "RADIAL_BASIS_FUNCTION_PARAMETER= 0.6",
+                                 "RADIAL_BASIS_FUNCTION_LOCAL_POINTS= 12"}, "BOX", (size > 1) ? rankZone : -1);
+    const auto config = testCase.config;
+    const auto donor = testCase.geometry[0][0][0];
+    const auto target = testCase.geometry[1][0][0];
+
+    CRadialBasisFunction interpolator(testCase.geometryZone, config, 0, 1, driverComm);
+    CLinearFieldInterface interface;
+    interface.BroadcastData(interpolator, nullptr, nullptr, donor, target, config[0], config[1]);
+
+    /*--- The RBF interpolation of the linear field is exact. ---*/
+    const auto markTarget = config[1]->FindInterfaceMarker(0);
+    unsigned long nTarget = 0;
+
+    for (auto iVertex = 0ul; (markTarget >= 0) && (iVertex < target->GetnVertex(markTarget)); ++iVertex) {
+      const auto iPoint = target->vertex[markTarget][iVertex]->GetNode();
+      if (!target->nodes->GetDomain(iPoint)) continue;
+      ++nTarget;
+
+      REQUIRE(interface.targetValue.count(iPoint) == 1);
+      CHECK(SU2_TYPE::GetValue(interface.targetValue[iPoint]) ==
+            Approx(SU2_TYPE::GetValue(linearField(target->nodes->GetCoord(iPoint)))).margin(1e-8));
+    }
+    CHECK(interface.targetValue.size() == nTarget);
+
+    unsigned long nTargetGlobal = 0;
+    SU2_MPI::Allreduce(&nTarget, &nTargetGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, driverComm);
+    CHECK(nTargetGlobal > 0);
+  }
+  SU2_MPI::SetComm(driverComm);
+  SU2_MPI::Comm_free(&zoneComm);
+}
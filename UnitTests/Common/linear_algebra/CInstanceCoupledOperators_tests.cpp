@@ -0,0 +1,118 @@
+/*!
+ * \file CInstanceCoupledOperators_tests.cpp
+ * \brief Unit tests for the operators of the coupled (harmonic balance) system of instances.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CInstanceCoupledOperators.hpp"
+
+TEST_CASE("Coupled product and block preconditioner of two instances", "[LinearAlgebra]") {
+
+  UnitQuadTestCase testCase;
+  testCase.InitConfig();
+  testCase.InitGeometry();
+  const auto config = testCase.config.get();
+  const auto geometry = testCase.geometry.get();
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned long nVar = 2;
+
+  /*--- Diagonal matrices, the instances share the geometry. ---*/
+
+  CSysMatrix<su2mixedfloat> matrix[2];
+  for (int iInst = 0; iInst < 2; ++iInst) {
+    matrix[iInst].Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) matrix[iInst].SetVal2Diag(iPoint, 2.0 + iInst);
+  }
+  const std::vector<CSysMatrix<su2mixedfloat>*> matrices = {&matrix[0], &matrix[1]};
+  const std::vector<CGeometry*> geometries = {geometry, geometry};
+
+  su2double row0[] = {0.0, 1.0}, row1[] = {-1.0, 0.0};
+  const su2double* coupling[] = {row0, row1};
+
+  /*--- Instance 0 is 1, instance 1 is 2. ---*/
+
+  CSysVector<su2mixedfloat> u(2*nPointDomain, 2*nPointDomain, nVar, 1.0), v(2*nPointDomain, 2*nPointDomain, nVar, 0.0);
+  for (auto i = nPointDomain*nVar; i < 2*nPointDomain*nVar; ++i) u[i] = 2.0;
+
+  SECTION("Product") {
+    const CInstanceCoupledProduct<su2mixedfloat> product(matrices, geometries, config, nVar, coupling);
+    product(u, v);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const passivedouble vol = SU2_TYPE::GetValue(geometry->nodes->GetVolume(iPoint));
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        CHECK(v(iPoint, iVar) == Approx(2.0 + vol * 2.0));
+        CHECK(v(nPointDomain + iPoint, iVar) == Approx(6.0 - vol));
+      }
+    }
+  }
+
+  SECTION("Block preconditioner") {
+    CInstanceBlockPreconditioner<su2mixedfloat> precond(JACOBI, matrices, geometries, config, nVar);
+    precond.Build();
+    precond(u, v);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        CHECK(v(iPoint, iVar) == Approx(0.5));
+        CHECK(v(nPointDomain + iPoint, iVar) == Approx(2.0 / 3.0));
+      }
+    }
+  }
+  SECTION("Reuse with new values") {
+    /*--- The operators are built once, the coupling and the matrices change between solves. ---*/
+
+    su2double zero[] = {0.0, 0.0};
+    const su2double* noCoupling[] = {zero, zero};
+    CInstanceCoupledProduct<su2mixedfloat> product(matrices, geometries, config, nVar, noCoupling);
+    CInstanceBlockPreconditioner<su2mixedfloat> precond(JACOBI, matrices, geometries, config, nVar);
+    precond.Build();
+
+    product.SetCoupling(coupling);
+    product(u, v);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const passivedouble vol = SU2_TYPE::GetValue(geometry->nodes->GetVolume(iPoint));
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        CHECK(v(iPoint, iVar) == Approx(2.0 + vol * 2.0));
+        CHECK(v(nPointDomain + iPoint, iVar) == Approx(6.0 - vol));
+      }
+    }
+
+    for (int iInst = 0; iInst < 2; ++iInst)
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) matrix[iInst].SetVal2Diag(iPoint, 4.0);
+    precond.Build();
+    precond(u, v);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        CHECK(v(iPoint, iVar) == Approx(0.25));
+        CHECK(v(nPointDomain + iPoint, iVar) == Approx(0.5));
+      }
+    }
+  }
+}
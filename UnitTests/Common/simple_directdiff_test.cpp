@@ -50,3 +50,21 @@ TEST_CASE("Simple DirectDiff Test", "[Directdiff tests]") {
   CHECK(SU2_TYPE::GetValue(y) == Approx(64));
   CHECK(SU2_TYPE::GetDerivative(y) == Approx(48));
 }
+
+TEST_CASE("Vector DirectDiff Test", "[Directdiff tests]") {
+  /*--- Seed a different input in each tangent direction, the
+   * derivatives w.r.t. all inputs are obtained in one evaluation. ---*/
+  su2double x[SU2_TYPE::nDirections];
+
+  for (auto iDir = 0u; iDir < SU2_TYPE::nDirections; iDir++) {
+    x[iDir] = 1.0 + iDir;
+    SU2_TYPE::SetDerivative(x[iDir], 1.0, iDir);
+  }
+  su2double y = 0.0;
+  for (auto iDir = 0u; iDir < SU2_TYPE::nDirections; iDir++) y += func(x[iDir]);
+
+  for (auto iDir = 0u; iDir < SU2_TYPE::nDirections; iDir++) {
+    CHECK(SU2_TYPE::GetDerivative(y, iDir) == Approx(3 * (1.0 + iDir) * (1.0 + iDir)));
+  }
+  CHECK(SU2_TYPE::GetDerivative(y) == SU2_TYPE::GetDerivative(y, 0));
+}
@@ -0,0 +1,73 @@
+/*!
+ * \file CBinomialCheckpointing_tests.cpp
+ * \brief Unit tests for the CBinomialCheckpointing class, the states of a reverse
+ * sweep should be recomputed with the minimum number of forward steps.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/toolboxes/CBinomialCheckpointing.hpp"
+
+/*--- Reverse nSteps steps, the "state" of a step is its index, returns the number of forward steps. ---*/
+unsigned long long reverseSweep(unsigned long nCheckpoints, long nSteps) {
+  CBinomialCheckpointing checkpoints;
+  checkpoints.Initialize(nCheckpoints, 0);
+
+  unsigned long long nForward = 0;
+
+  for (long target = nSteps-1; target >= 0; --target) {
+    const int iCheck = checkpoints.Latest(target);
+    long current = checkpoints.GetStep(iCheck);
+    if (iCheck >= 0) REQUIRE(checkpoints.GetData(iCheck)[0] == current);
+
+    long next = checkpoints.NextCheckpoint(current, target);
+    while (current < target) {
+      ++current;
+      ++nForward;
+      if (current == next && current < target) {
+        const int iStore = checkpoints.Store(current, target);
+        REQUIRE(iStore >= 0);
+        checkpoints.GetData(iStore).assign(1, current);
+        next = checkpoints.NextCheckpoint(current, target);
+      }
+    }
+  }
+  return nForward;
+}
+
+TEST_CASE("Binomial checkpointing cost", "[Toolboxes]") {
+  /*--- Without checkpoints the sweep is quadratic, with enough of them it is linear. ---*/
+  CHECK(CBinomialCheckpointing::Cost(1, 10) == 45);
+  CHECK(CBinomialCheckpointing::Cost(9, 10) == 9);
+  CHECK(CBinomialCheckpointing::Cost(2, 10) == 20);
+  CHECK(CBinomialCheckpointing::Cost(3, 10) == 15);
+}
+
+TEST_CASE("Binomial checkpointing schedule", "[Toolboxes]") {
+  for (unsigned long nCheck = 0; nCheck < 5; ++nCheck) {
+    for (long nSteps = 1; nSteps < 50; ++nSteps) {
+      CAPTURE(nCheck, nSteps);
+      CHECK(reverseSweep(nCheck, nSteps) == CBinomialCheckpointing::Cost(nCheck+1, nSteps+1));
+    }
+  }
+}
@@ -31,6 +31,7 @@
 #include "../../SU2_CFD/include/solvers/CSolver.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/limiters/computeGradientsAndLimiters.hpp"
 
 /*!
  * \brief Base class for gradient tests using a unit cube geometry.
@@ -131,8 +132,9 @@ void check(const T& ref, const U& calc, su2double tol = 1e-9) {
 }
 
 template<class TestField>
-void testGreenGauss() {
+void testGreenGauss(bool edgeBased) {
   TestField field;
+  field.config->SetEdgeBasedGradients(edgeBased);
   C3DDoubleMatrix gradient(field.geometry->GetnPoint(), field.nVar, field.geometry->GetnDim());
 
   computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, *field.geometry.get(),
@@ -141,8 +143,10 @@ void testGreenGauss() {
 }
 
 template<class TestField>
-void testLeastSquares(bool weighted) {
+void testLeastSquares(bool weighted, bool edgeBased, bool stored = false) {
   TestField field;
+  field.config->SetEdgeBasedGradients(edgeBased);
+  field.config->SetPrecomputeLSWeights(stored);
   const auto nDim = field.geometry->GetnDim();
   C3DDoubleMatrix R(field.geometry->GetnPoint(), nDim, nDim);
   C3DDoubleMatrix gradient(field.geometry->GetnPoint(), field.nVar, nDim);
@@ -150,16 +154,96 @@ void testLeastSquares(bool weighted) {
   computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, *field.geometry.get(),
                                *field.config.get(), weighted, field, 0, field.nVar, gradient, R);
   check(field, gradient);
+
+  if (stored) {
+    /*--- Second call reuses the weights. ---*/
+    computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, *field.geometry.get(),
+                                 *field.config.get(), weighted, field, 0, field.nVar, gradient, R);
+    check(field, gradient);
+  }
 }
 
 TEST_CASE("GG", "[Gradients]") {
-  testGreenGauss<LinearFunction>();
+  testGreenGauss<LinearFunction>(false);
 }
 
 TEST_CASE("LS", "[Gradients]") {
-  testLeastSquares<LinearFunction>(false);
+  testLeastSquares<LinearFunction>(false, false);
 }
 
 TEST_CASE("WLS", "[Gradients]") {
-  testLeastSquares<LinearFunction>(true);
+  testLeastSquares<LinearFunction>(true, false);
+}
+
+TEST_CASE("GG edge-based", "[Gradients]") {
+  testGreenGauss<LinearFunction>(true);
+}
+
+TEST_CASE("LS edge-based", "[Gradients]") {
+  testLeastSquares<LinearFunction>(false, true);
+}
+
+TEST_CASE("WLS edge-based", "[Gradients]") {
+  testLeastSquares<LinearFunction>(true, true);
+}
+
+TEST_CASE("LS stored weights", "[Gradients]") {
+  testLeastSquares<LinearFunction>(false, false, true);
+}
+
+TEST_CASE("WLS stored weights", "[Gradients]") {
+  testLeastSquares<LinearFunction>(true, false, true);
+}
+
+/*!
+ * \brief Compare the fused gradient and limiter computation with the separate one.
+ */
+template<class TestField>
+void testGradientsAndLimiters(ENUM_FLOW_GRADIENT kindGradient) {
+  TestField field;
+  const auto nPoint = field.geometry->GetnPoint();
+  const auto nDim = field.geometry->GetnDim();
+  auto& geometry = *field.geometry.get();
+  const auto& config = *field.config.get();
+
+  su2activematrix values(nPoint, field.nVar), fieldMin(nPoint, field.nVar), fieldMax(nPoint, field.nVar);
+  su2activematrix limiter(nPoint, field.nVar), limiterRef(nPoint, field.nVar);
+  C3DDoubleMatrix R(nPoint, nDim, nDim);
+  C3DDoubleMatrix gradient(nPoint, field.nVar, nDim), gradientRef(nPoint, field.nVar, nDim);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < field.nVar; ++iVar)
+      values(iPoint,iVar) = field(iPoint,iVar);
+
+  if (kindGradient == GREEN_GAUSS) {
+    computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, geometry,
+                               config, values, 0, field.nVar, gradientRef);
+  } else {
+    computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry, config,
+                                 kindGradient == WEIGHTED_LEAST_SQUARES, values, 0, field.nVar, gradientRef, R);
+  }
+  computeLimiters(VENKATAKRISHNAN, nullptr, SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE, geometry,
+                  config, 0, field.nVar, values, gradientRef, fieldMin, fieldMax, limiterRef);
+
+  computeGradientsAndLimiters(kindGradient, VENKATAKRISHNAN, nullptr, SOLUTION_GRADIENT, SOLUTION_LIMITER,
+                              geometry, config, 0, field.nVar, values, gradient, R,
+                              fieldMin, fieldMax, limiter);
+
+  su2double err = 0.0;
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < field.nVar; ++iVar) {
+      err = max(err, abs(limiter(iPoint,iVar) - limiterRef(iPoint,iVar)));
+      for (auto iDim = 0ul; iDim < nDim; ++iDim)
+        err = max(err, abs(gradient(iPoint,iVar,iDim) - gradientRef(iPoint,iVar,iDim)));
+    }
+  }
+  CHECK(err < 1e-12);
+}
+
+TEST_CASE("GG fused limiter", "[Gradients]") {
+  testGradientsAndLimiters<LinearFunction>(GREEN_GAUSS);
+}
+
+TEST_CASE("WLS fused limiter", "[Gradients]") {
+  testGradientsAndLimiters<LinearFunction>(WEIGHTED_LEAST_SQUARES);
 }
@@ -0,0 +1,196 @@
+/*!
+ * \file gradients_ad.cpp
+ * \brief Unit tests for the hand-written reverse of the gradient computations (AD external
+ * functions), the adjoints must match those of the regular recording.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../Common/include/containers/container_decorators.hpp"
+#include "../../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+
+/*!
+ * \brief Unit cube with a smooth field of two variables, the gradients are recorded with or
+ *        without AD_EXTERNAL_GRADIENTS and the adjoints of the field are compared.
+ */
+struct ExternalGradientsTest {
+  const unsigned long nVar = 2;
+
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  su2activematrix field;
+
+  explicit ExternalGradientsTest(bool external) {
+    const string configOptions =
+        "SOLVER= NAVIER_STOKES\n"
+        "MESH_FORMAT= BOX\n"
+        "INIT_OPTION= TD_CONDITIONS\n"
+        "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+        "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+        "MESH_BOX_SIZE= 6,5,4\n"
+        "MESH_BOX_LENGTH= 1,1,1\n"
+        "MESH_BOX_OFFSET= 0,0,0\n"
+        "AD_EXTERNAL_GRADIENTS= " + string(external? "YES" : "NO") + "\n";
+
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    stringstream ss(configOptions);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+    cout.rdbuf(origBuf);
+
+    field.resize(geometry->GetnPoint(), nVar);
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const auto coord = geometry->nodes->GetCoord(iPoint);
+      field(iPoint,0) = sin(2*coord[0]) * cos(coord[1]) + coord[2];
+      field(iPoint,1) = coord[0]*coord[1]*coord[2] + exp(coord[1]);
+    }
+  }
+
+  /*!
+   * \brief Record the gradient of the field, seed its adjoint, and return the adjoint of the field.
+   * \param[in] compute - Callable that computes the gradient.
+   * \param[in] activeCoord - Also register the coordinates as inputs.
+   */
+  template<class F>
+  vector<passivedouble> adjoint(const F& compute, bool activeCoord = false) {
+    const auto nDim = geometry->GetnDim();
+    C3DDoubleMatrix gradient(geometry->GetnPoint(), nVar, nDim);
+
+    geometry->SetPassiveRecording(-1);
+    AD::Reset();
+    AD::StartRecording();
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) AD::RegisterInput(field(iPoint,iVar));
+      if (activeCoord)
+        for (auto iDim = 0u; iDim < nDim; ++iDim) AD::RegisterInput(geometry->nodes->GetCoord(iPoint)[iDim]);
+    }
+
+    compute(gradient);
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto iDim = 0u; iDim < nDim; ++iDim) AD::RegisterOutput(gradient(iPoint,iVar,iDim));
+
+    AD::StopRecording();
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto iDim = 0u; iDim < nDim; ++iDim)
+          SU2_TYPE::SetDerivative(gradient(iPoint,iVar,iDim), cos(1.0 + iPoint + 3*iVar + 5*iDim));
+
+    AD::ComputeAdjoint();
+
+    vector<passivedouble> field_b;
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) field_b.push_back(SU2_TYPE::GetDerivative(field(iPoint,iVar)));
+
+    AD::ClearAdjoints();
+    AD::Reset();
+
+    /*--- Leave the geometry passive for the next recording. ---*/
+    if (activeCoord) {
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+        for (auto iDim = 0u; iDim < nDim; ++iDim) AD::ResetInput(geometry->nodes->GetCoord(iPoint)[iDim]);
+    }
+    return field_b;
+  }
+};
+
+namespace {
+void checkSameAdjoint(const vector<passivedouble>& actual, const vector<passivedouble>& expected) {
+  REQUIRE(actual.size() == expected.size());
+  passivedouble norm = 0.0;
+  for (auto x : expected) norm = max(norm, fabs(x));
+  REQUIRE(norm > 0.0);
+  for (auto i = 0ul; i < actual.size(); ++i) CHECK(actual[i] == Approx(expected[i]).margin(1e-12*norm));
+}
+
+template<class F>
+void compareExternalAndTaped(const F& compute) {
+  ExternalGradientsTest taped(false), external(true);
+
+  const auto ref = taped.adjoint([&](C3DDoubleMatrix& gradient) { compute(taped, gradient); });
+  const auto ext = external.adjoint([&](C3DDoubleMatrix& gradient) { compute(external, gradient); });
+
+  /*--- The external path was taken (and not with the regular recording). ---*/
+  CHECK(taped.geometry->GetPassiveRecording() < 0);
+  CHECK(external.geometry->GetPassiveRecording() == 1);
+  checkSameAdjoint(ext, ref);
+
+  /*--- Active coordinates must fall back to the regular recording. ---*/
+  external.adjoint([&](C3DDoubleMatrix& gradient) { compute(external, gradient); }, true);
+  CHECK(external.geometry->GetPassiveRecording() == 0);
+}
+
+void greenGauss(ExternalGradientsTest& test, C3DDoubleMatrix& gradient, bool edgeBased) {
+  test.config->SetEdgeBasedGradients(edgeBased);
+  computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, *test.geometry, *test.config,
+                             test.field, 0, test.nVar, gradient);
+}
+
+void leastSquares(ExternalGradientsTest& test, C3DDoubleMatrix& gradient, bool weighted, bool stored) {
+  const auto nDim = test.geometry->GetnDim();
+  C3DDoubleMatrix R(test.geometry->GetnPoint(), nDim, nDim);
+  test.config->SetPrecomputeLSWeights(stored);
+  computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, *test.geometry, *test.config,
+                               weighted, test.field, 0, test.nVar, gradient, R);
+}
+}
+
+TEST_CASE("External GG adjoint", "[AD Gradients]") {
+  compareExternalAndTaped([](ExternalGradientsTest& t, C3DDoubleMatrix& g) { greenGauss(t, g, false); });
+}
+
+TEST_CASE("External GG edge-based adjoint", "[AD Gradients]") {
+  compareExternalAndTaped([](ExternalGradientsTest& t, C3DDoubleMatrix& g) { greenGauss(t, g, true); });
+}
+
+TEST_CASE("External LS adjoint", "[AD Gradients]") {
+  compareExternalAndTaped([](ExternalGradientsTest& t, C3DDoubleMatrix& g) { leastSquares(t, g, false, false); });
+}
+
+TEST_CASE("External WLS stored weights adjoint", "[AD Gradients]") {
+  compareExternalAndTaped([](ExternalGradientsTest& t, C3DDoubleMatrix& g) { leastSquares(t, g, true, true); });
+}
@@ -0,0 +1,119 @@
+/*!
+ * \file CMultiGridIntegration_tests.cpp
+ * \brief Unit tests for the restriction of the turbulence variables to the coarse
+ * multigrid levels, the wall values must be imposed as for the flow variables.
+ * \version 7.2.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../SU2_CFD/include/solvers/CTurbSASolver.hpp"
+#include "../../../SU2_CFD/include/solvers/CTurbSSTSolver.hpp"
+#include "../../../SU2_CFD/include/integration/CMultiGridIntegration.hpp"
+
+namespace {
+CTurbSolver* CreateTurbSolver(CGeometry* geometry, CConfig* config, unsigned short iMesh) {
+  if (config->GetKind_Turb_Model() == SST) return new CTurbSSTSolver(geometry, config, iMesh);
+  return new CTurbSASolver(geometry, config, iMesh, nullptr);
+}
+
+/*--- Restrict a uniform turbulence solution to the first coarse level, and check the wall values,
+ *    the optional rough wall (y_plus) must keep the restricted values. ---*/
+void CheckRestrictedWallValues(const std::string& turbModel, unsigned short nVarWall, bool roughWall = false) {
+
+  UnitQuadTestCase testCase;
+  testCase.config_options =
+      "SOLVER= RANS\n"
+      "KIND_TURB_MODEL= " + turbModel + "\n"
+      "MESH_FORMAT= BOX\n"
+      "INIT_OPTION= TD_CONDITIONS\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+      "MESH_BOX_SIZE= 9,9,9\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "MGLEVEL= 1\n"
+      "MG_TURB= YES\n";
+  if (roughWall) testCase.config_options += "WALL_ROUGHNESS= (y_plus, 0.001)\n";
+  testCase.InitConfig();
+  testCase.InitGeometry();
+
+  auto config = testCase.config.get();
+  auto fine_grid = testCase.geometry.get();
+  CGeometry* geometry[] = {fine_grid, nullptr};
+
+  cout.rdbuf(nullptr);
+  std::unique_ptr<CGeometry> coarse_grid(new CMultiGridGeometry(geometry, config, MESH_1));
+  coarse_grid->SetPoint_Connectivity(fine_grid);
+  coarse_grid->SetEdges();
+  coarse_grid->SetVertex(fine_grid, config);
+  coarse_grid->SetControlVolume(config, fine_grid, ALLOCATE);
+  coarse_grid->SetBoundControlVolume(config, fine_grid, ALLOCATE);
+  coarse_grid->SetCoord(fine_grid);
+  coarse_grid->PreprocessP2PComms(coarse_grid.get(), config);
+
+  std::unique_ptr<CTurbSolver> sol_fine(CreateTurbSolver(fine_grid, config, MESH_0));
+  std::unique_ptr<CTurbSolver> sol_coarse(CreateTurbSolver(coarse_grid.get(), config, MESH_1));
+  cout.rdbuf(testCase.orig_buf);
+
+  const auto nVar = sol_fine->GetnVar();
+  for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); ++iPoint)
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      sol_fine->GetNodes()->SetSolution(iPoint, iVar, 1.0);
+
+  CMultiGridIntegration integration;
+  integration.SetRestricted_Solution(RUNTIME_TURB_SYS, sol_fine.get(), sol_coarse.get(), fine_grid, coarse_grid.get(), config);
+
+  std::vector<bool> wall(coarse_grid->GetnPoint(), false);
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); ++iMarker) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+    if (roughWall && config->GetMarker_All_TagBound(iMarker) == "y_plus") continue;
+    for (auto iVertex = 0ul; iVertex < coarse_grid->GetnVertex(iMarker); ++iVertex)
+      wall[coarse_grid->vertex[iMarker][iVertex]->GetNode()] = true;
+  }
+  REQUIRE(std::count(wall.begin(), wall.end(), true) > 0);
+
+  for (auto iPoint = 0ul; iPoint < coarse_grid->GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      const passivedouble ref = (wall[iPoint] && iVar < nVarWall) ? 0.0 : 1.0;
+      CHECK(SU2_TYPE::GetValue(sol_coarse->GetNodes()->GetSolution(iPoint, iVar)) == Approx(ref));
+    }
+  }
+}
+}
+
+TEST_CASE("Restricted SA wall values", "[Integration]") {
+  /*--- nu_tilde is zero at the wall. ---*/
+  CheckRestrictedWallValues("SA", 1);
+}
+
+TEST_CASE("Restricted SST wall values", "[Integration]") {
+  /*--- k is zero at the wall, omega is imposed by the coarse level boundary condition. ---*/
+  CheckRestrictedWallValues("SST", 1);
+}
+
+TEST_CASE("Restricted rough wall values", "[Integration]") {
+  /*--- Rough walls impose nu_tilde through the boundary condition, it is not zeroed. ---*/
+  CheckRestrictedWallValues("SA", 1, true);
+}